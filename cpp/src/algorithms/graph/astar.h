@@ -0,0 +1,83 @@
+#ifndef ALGORITHMS_GRAPH_ASTAR_H
+#define ALGORITHMS_GRAPH_ASTAR_H
+
+#include "pch.h"
+#include "algorithms/graph/shortest_path_context.h"
+#include "data_structures/csr_graph.h"
+
+namespace ads {
+
+/* heuristic that knows nothing, A* with it settles vertices exactly like Dijkstra */
+struct ZeroHeuristic {
+	uint64_t operator()(uint32_t) const { return 0; }
+};
+
+
+/* lower bound for row major grid graphs whose edges all weigh at least minWeight: the Manhattan distance to the target
+   in steps times the cheapest step */
+template<class Distance>
+struct GridManhattanHeuristic {
+	GridManhattanHeuristic(uint32_t width, uint32_t target, Distance minWeight) : width(width), targetX(target % width), targetY(target / width), minWeight(minWeight) {}
+
+	Distance operator()(uint32_t v) const {
+		const uint32_t x = v % width;
+		const uint32_t y = v / width;
+		return minWeight * static_cast<Distance>((x > targetX ? x - targetX : targetX - x) + (y > targetY ? y - targetY : targetY - y));
+	}
+
+	uint32_t width;
+	uint32_t targetX;
+	uint32_t targetY;
+	Distance minWeight;
+};
+
+
+/* A* point to point search: the queue is ordered by distance so far plus heuristic(v), an estimate of what is left to the
+   target, which pulls the search towards the target instead of growing it evenly in all directions, the heuristic must
+   never overestimate for the result to be a shortest path, and with a consistent one, as the grid heuristic is, every
+   vertex is settled at most once, an inconsistent but admissible one still works by reopening vertices */
+template<class Weight>
+class AStar {
+public:
+	using Graph = CsrGraph<Weight>;
+	using Context = ShortestPathContext<Weight>;
+	using Distance = typename Context::Distance;
+
+	// returns whether target is reachable, its distance and path are then in context
+	template<class Heuristic>
+	static bool Run(const Graph& graph, uint32_t source, uint32_t target, Heuristic&& heuristic, Context& context) {
+		context.Begin(graph.VertexCount(), source);
+		IndexedDaryHeap<Distance, 4, std::greater<Distance>>& heap = context.m_heap;
+		heap.Push(source, static_cast<Distance>(heuristic(source)));
+		while (!heap.IsEmpty()) {
+			const uint32_t u = heap.PopTop().id;
+			++context.m_settled;
+			if (u == target)
+				return true;
+			const Distance base = context.m_distances[u];
+			const std::span<const uint32_t> neighbours = graph.OutNeighbors(u);
+			for (size_t i = 0; i < neighbours.size(); ++i) {
+				const uint32_t v = neighbours[i];
+				Distance distance = base;
+				if constexpr (Graph::weighted)
+					distance += PathDistance<Weight>::Of(graph.OutWeights(u)[i]);
+				else
+					distance += 1;
+				// reached vertices only move up the queue, one already settled comes back in when a better path shows up
+				if (context.Improve(v, distance, u))
+					heap.DecreaseKey(v, distance + static_cast<Distance>(heuristic(v)));
+			}
+		}
+		return false;
+	}
+};
+
+
+template<class Weight, class Heuristic>
+bool FindPath(const CsrGraph<Weight>& graph, uint32_t source, uint32_t target, Heuristic&& heuristic, ShortestPathContext<Weight>& context) {
+	return AStar<Weight>::Run(graph, source, target, std::forward<Heuristic>(heuristic), context);
+}
+
+} // namespace ads
+
+#endif // ALGORITHMS_GRAPH_ASTAR_H
\ No newline at end of file
@@ -0,0 +1,169 @@
+#ifndef ALGORITHMS_GRAPH_BFS_H
+#define ALGORITHMS_GRAPH_BFS_H
+
+#include "pch.h"
+#include "algorithms/thread_pool.h"
+#include "data_structures/csr_graph.h"
+
+namespace ads {
+
+struct BfsOptions {
+	bool directionOptimizing = true;	// false keeps every step top-down
+	unsigned alpha = 15;				// go bottom-up once the frontier's edges exceed the unexplored edges / alpha
+	unsigned beta = 18;					// go back top-down once the frontier shrinks below the vertex count / beta
+};
+
+
+struct BfsResult {
+	std::vector<uint32_t> parents;		// the source is its own parent, unreached vertices have CsrGraph::noVertex
+	std::vector<uint32_t> depths;		// noVertex for unreached vertices
+	uint32_t levels = 0;
+	uint32_t topDownSteps = 0;
+	uint32_t bottomUpSteps = 0;
+};
+
+
+/* direction optimizing breadth first search (Beamer): while the frontier is small each frontier vertex pushes to its out
+   neighbours, claiming them with a compare and swap on their parent, once the frontier holds a large share of the remaining
+   edges every unvisited vertex instead scans its in neighbours for one in the frontier and stops at the first hit, which skips
+   most of the edges around the peak levels of low diameter graphs, the bottom-up frontier is a bitmap so membership is one bit
+   test and each thread owns whole words of the next bitmap */
+template<class Weight>
+class DirectionOptimizingBfs {
+public:
+	using Graph = CsrGraph<Weight>;
+
+	static constexpr size_t topDownGrain = 256;
+	static constexpr size_t bottomUpGrainWords = 64;
+
+	// bottom-up steps need the graph's in edges and are skipped without them
+	static BfsResult Run(const Graph& graph, uint32_t source, ThreadPool& pool, const BfsOptions& options = {}) {
+		const size_t vertexCount = graph.VertexCount();
+		BfsResult result;
+		result.parents.assign(vertexCount, Graph::noVertex);
+		result.depths.assign(vertexCount, Graph::noVertex);
+		result.parents[source] = source;
+		result.depths[source] = 0;
+
+		const bool canGoBottomUp = options.directionOptimizing && graph.HasInEdges();
+		const size_t wordCount = (vertexCount + 63) / 64;
+		std::vector<uint64_t> frontierBits;
+		std::vector<uint64_t> nextBits;
+		std::vector<uint32_t> frontier{ source };
+		uint64_t edgesToCheck = graph.EdgeCount();
+		uint64_t scoutCount = graph.OutDegree(source);
+		uint32_t depth = 0;
+		while (!frontier.empty()) {
+			if (canGoBottomUp && scoutCount > edgesToCheck / options.alpha) {
+				frontierBits.assign(wordCount, 0);
+				nextBits.resize(wordCount);
+				for (uint32_t v : frontier)
+					frontierBits[v / 64] |= uint64_t(1) << (v % 64);
+				size_t awake = frontier.size();
+				size_t previousAwake;
+				do {
+					previousAwake = awake;
+					awake = BottomUpStep(graph, result, frontierBits, nextBits, ++depth, pool);
+					frontierBits.swap(nextBits);
+					++result.bottomUpSteps;
+				} while (awake >= previousAwake || awake > vertexCount / options.beta);
+				frontier = BitmapToQueue(frontierBits, pool);
+				scoutCount = 1;
+			} else {
+				edgesToCheck -= std::min(edgesToCheck, scoutCount);
+				scoutCount = TopDownStep(graph, result, frontier, ++depth, pool);
+				++result.topDownSteps;
+			}
+		}
+		// the last step found nothing, so depth counts the levels
+		result.levels = depth;
+		return result;
+	}
+
+private:
+	// replaces frontier with the next level and returns the out degree sum of that level
+	static uint64_t TopDownStep(const Graph& graph, BfsResult& result, std::vector<uint32_t>& frontier, uint32_t depth, ThreadPool& pool) {
+		std::vector<uint32_t> next;
+		std::mutex nextMutex;
+		std::atomic<uint64_t> scoutCount(0);
+		ParallelFor(pool, 0, frontier.size(), topDownGrain, [&](size_t first, size_t last) {
+			std::vector<uint32_t> local;
+			uint64_t scouts = 0;
+			for (size_t i = first; i < last; ++i) {
+				const uint32_t u = frontier[i];
+				for (uint32_t v : graph.OutNeighbors(u)) {
+					std::atomic_ref<uint32_t> parent(result.parents[v]);
+					uint32_t unvisited = Graph::noVertex;
+					if (parent.load(std::memory_order_relaxed) == Graph::noVertex && parent.compare_exchange_strong(unvisited, u, std::memory_order_relaxed)) {
+						result.depths[v] = depth;
+						local.push_back(v);
+						scouts += graph.OutDegree(v);
+					}
+				}
+			}
+			scoutCount.fetch_add(scouts, std::memory_order_relaxed);
+			std::lock_guard<std::mutex> lock(nextMutex);
+			next.insert(next.end(), local.begin(), local.end());
+		});
+		frontier.swap(next);
+		return scoutCount.load(std::memory_order_relaxed);
+	}
+
+	// fills next with the vertices that found a parent in frontier and returns how many there were
+	static size_t BottomUpStep(const Graph& graph, BfsResult& result, const std::vector<uint64_t>& frontier, std::vector<uint64_t>& next,
+		uint32_t depth, ThreadPool& pool) {
+		const size_t vertexCount = graph.VertexCount();
+		std::atomic<size_t> awake(0);
+		ParallelFor(pool, 0, frontier.size(), bottomUpGrainWords, [&](size_t firstWord, size_t lastWord) {
+			size_t found = 0;
+			for (size_t word = firstWord; word < lastWord; ++word) {
+				uint64_t bits = 0;
+				const size_t end = std::min(vertexCount, word * 64 + 64);
+				for (size_t v = word * 64; v < end; ++v) {
+					if (result.parents[v] != Graph::noVertex)
+						continue;
+					for (uint32_t u : graph.InNeighbors(static_cast<uint32_t>(v))) {
+						if ((frontier[u / 64] >> (u % 64)) & 1) {
+							result.parents[v] = u;
+							result.depths[v] = depth;
+							bits |= uint64_t(1) << (v % 64);
+							++found;
+							break;
+						}
+					}
+				}
+				next[word] = bits;
+			}
+			awake.fetch_add(found, std::memory_order_relaxed);
+		});
+		return awake.load(std::memory_order_relaxed);
+	}
+
+	static std::vector<uint32_t> BitmapToQueue(const std::vector<uint64_t>& bits, ThreadPool& pool) {
+		std::vector<uint64_t> counts(bits.size() + 1, 0);
+		ParallelFor(pool, 0, bits.size(), bottomUpGrainWords, [&](size_t first, size_t last) {
+			for (size_t word = first; word < last; ++word)
+				counts[word] = static_cast<uint64_t>(std::popcount(bits[word]));
+		});
+		std::exclusive_scan(counts.begin(), counts.end(), counts.begin(), uint64_t(0));
+		std::vector<uint32_t> queue(counts.back());
+		ParallelFor(pool, 0, bits.size(), bottomUpGrainWords, [&](size_t first, size_t last) {
+			for (size_t word = first; word < last; ++word) {
+				size_t slot = counts[word];
+				for (uint64_t rest = bits[word]; rest != 0; rest &= rest - 1)
+					queue[slot++] = static_cast<uint32_t>(word * 64 + std::countr_zero(rest));
+			}
+		});
+		return queue;
+	}
+};
+
+
+template<class Weight>
+BfsResult BreadthFirstSearch(const CsrGraph<Weight>& graph, uint32_t source, ThreadPool& pool, const BfsOptions& options = {}) {
+	return DirectionOptimizingBfs<Weight>::Run(graph, source, pool, options);
+}
+
+} // namespace ads
+
+#endif // ALGORITHMS_GRAPH_BFS_H
\ No newline at end of file
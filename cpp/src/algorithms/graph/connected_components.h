@@ -0,0 +1,129 @@
+#ifndef ALGORITHMS_GRAPH_CONNECTED_COMPONENTS_H
+#define ALGORITHMS_GRAPH_CONNECTED_COMPONENTS_H
+
+#include "pch.h"
+#include "algorithms/thread_pool.h"
+#include "data_structures/csr_graph.h"
+
+namespace ads {
+
+/* weakly connected components by Afforest (Sutton et al.): a parallel union-find where linking always hooks the larger root
+   under the smaller with a compare and swap, first over a couple of sampled neighbours per vertex, which already merges almost
+   all of a big component, then over the remaining edges of every vertex outside the most frequent component so the giant
+   component's edges are never touched again, labels end up as the smallest vertex id of each component */
+template<class Weight>
+class ConnectedComponents {
+public:
+	using Graph = CsrGraph<Weight>;
+
+	static constexpr size_t grain = 1 << 12;
+	static constexpr unsigned neighbourRounds = 2;
+	static constexpr size_t sampleCount = 1024;
+
+	// a directed graph without in edges still works but can't skip the largest component
+	static std::vector<uint32_t> Run(const Graph& graph, ThreadPool& pool) {
+		const size_t vertexCount = graph.VertexCount();
+		std::vector<uint32_t> labels(vertexCount);
+		ParallelFor(pool, 0, vertexCount, grain, [&](size_t first, size_t last) {
+			for (size_t v = first; v < last; ++v)
+				labels[v] = static_cast<uint32_t>(v);
+		});
+
+		for (unsigned round = 0; round < neighbourRounds; ++round) {
+			ParallelFor(pool, 0, vertexCount, grain, [&](size_t first, size_t last) {
+				for (size_t u = first; u < last; ++u) {
+					const std::span<const uint32_t> neighbours = graph.OutNeighbors(static_cast<uint32_t>(u));
+					if (round < neighbours.size())
+						Link(labels, static_cast<uint32_t>(u), neighbours[round]);
+				}
+			});
+			Compress(labels, pool);
+		}
+
+		// a vertex of the largest component may have an edge into a vertex outside it that only its own out edges list,
+		// the outside vertex finds it through its in edges, without them nothing can be skipped
+		const uint32_t skipped = graph.HasInEdges() ? MostFrequentLabel(labels) : Graph::noVertex;
+		ParallelFor(pool, 0, vertexCount, grain, [&](size_t first, size_t last) {
+			for (size_t u = first; u < last; ++u) {
+				const uint32_t vertex = static_cast<uint32_t>(u);
+				if (std::atomic_ref<uint32_t>(labels[u]).load(std::memory_order_relaxed) == skipped)
+					continue;
+				const std::span<const uint32_t> neighbours = graph.OutNeighbors(vertex);
+				for (size_t i = neighbourRounds; i < neighbours.size(); ++i)
+					Link(labels, vertex, neighbours[i]);
+				if (!graph.IsSymmetric() && graph.HasInEdges()) {
+					for (uint32_t v : graph.InNeighbors(vertex))
+						Link(labels, vertex, v);
+				}
+			}
+		});
+		Compress(labels, pool);
+		return labels;
+	}
+
+	static size_t CountComponents(const std::vector<uint32_t>& labels) {
+		size_t count = 0;
+		for (size_t v = 0; v < labels.size(); ++v)
+			count += labels[v] == v;
+		return count;
+	}
+
+private:
+	// walks both vertices to their roots and hooks the larger root under the smaller, retrying if another thread got there first
+	static void Link(std::vector<uint32_t>& labels, uint32_t u, uint32_t v) {
+		uint32_t a = Load(labels, u);
+		uint32_t b = Load(labels, v);
+		while (a != b) {
+			const uint32_t high = std::max(a, b);
+			const uint32_t low = std::min(a, b);
+			uint32_t highParent = Load(labels, high);
+			if (highParent == low)
+				return;
+			if (highParent == high && std::atomic_ref<uint32_t>(labels[high]).compare_exchange_strong(highParent, low, std::memory_order_relaxed))
+				return;
+			a = Load(labels, Load(labels, high));
+			b = Load(labels, low);
+		}
+	}
+
+	// pointer jumping until every vertex points straight at its root
+	static void Compress(std::vector<uint32_t>& labels, ThreadPool& pool) {
+		ParallelFor(pool, 0, labels.size(), grain, [&](size_t first, size_t last) {
+			for (size_t v = first; v < last; ++v) {
+				uint32_t parent = Load(labels, static_cast<uint32_t>(v));
+				uint32_t grandparent = Load(labels, parent);
+				while (parent != grandparent) {
+					std::atomic_ref<uint32_t>(labels[v]).store(grandparent, std::memory_order_relaxed);
+					parent = grandparent;
+					grandparent = Load(labels, parent);
+				}
+			}
+		});
+	}
+
+	static uint32_t MostFrequentLabel(const std::vector<uint32_t>& labels) {
+		if (labels.empty())
+			return Graph::noVertex;
+		std::unordered_map<uint32_t, size_t> counts;
+		std::mt19937 rng(27491095);
+		std::uniform_int_distribution<size_t> pick(0, labels.size() - 1);
+		for (size_t i = 0; i < sampleCount; ++i)
+			++counts[labels[pick(rng)]];
+		return std::max_element(counts.begin(), counts.end(), [](const auto& a, const auto& b) { return a.second < b.second; })->first;
+	}
+
+	static uint32_t Load(std::vector<uint32_t>& labels, uint32_t v) {
+		return std::atomic_ref<uint32_t>(labels[v]).load(std::memory_order_relaxed);
+	}
+};
+
+
+// one label per vertex, equal labels mean the same weakly connected component
+template<class Weight>
+std::vector<uint32_t> ConnectedComponentLabels(const CsrGraph<Weight>& graph, ThreadPool& pool) {
+	return ConnectedComponents<Weight>::Run(graph, pool);
+}
+
+} // namespace ads
+
+#endif // ALGORITHMS_GRAPH_CONNECTED_COMPONENTS_H
\ No newline at end of file
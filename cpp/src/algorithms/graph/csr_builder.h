@@ -0,0 +1,185 @@
+#ifndef ALGORITHMS_GRAPH_CSR_BUILDER_H
+#define ALGORITHMS_GRAPH_CSR_BUILDER_H
+
+#include "pch.h"
+#include "algorithms/thread_pool.h"
+#include "data_structures/csr_graph.h"
+
+namespace ads {
+
+struct CsrBuildOptions {
+	bool symmetrize = false;		// add every edge in both directions, the result is an undirected graph
+	bool buildInEdges = false;		// directed graphs only, needed by bottom-up BFS and pull PageRank
+	bool removeSelfLoops = true;
+	bool removeDuplicates = true;	// parallel edges collapse into one, weighted graphs keep the lightest
+};
+
+
+// in place exclusive prefix sum over values, which ends with one extra slot that receives the total, blocks are summed
+// in parallel, their totals scanned serially and the blocks then offset in parallel
+inline void ParallelExclusiveScan(ThreadPool& pool, std::vector<uint64_t>& values) {
+	const size_t count = values.size() - 1;
+	const size_t blockCount = std::max<size_t>(1, std::min<size_t>(count / 4096, pool.ThreadCount() * 4));
+	const size_t blockSize = (count + blockCount - 1) / blockCount;
+	std::vector<uint64_t> blockTotals(blockCount + 1, 0);
+	ParallelFor(pool, 0, blockCount, 1, [&](size_t first, size_t last) {
+		for (size_t block = first; block < last; ++block) {
+			uint64_t total = 0;
+			for (size_t i = block * blockSize; i < std::min(count, (block + 1) * blockSize); ++i)
+				total += values[i];
+			blockTotals[block] = total;
+		}
+	});
+	uint64_t running = 0;
+	for (uint64_t& total : blockTotals)
+		running += std::exchange(total, running);
+	ParallelFor(pool, 0, blockCount, 1, [&](size_t first, size_t last) {
+		for (size_t block = first; block < last; ++block) {
+			uint64_t sum = blockTotals[block];
+			for (size_t i = block * blockSize; i < std::min(count, (block + 1) * blockSize); ++i)
+				sum += std::exchange(values[i], sum);
+		}
+	});
+	values[count] = blockTotals[blockCount];
+}
+
+
+/* lays out one direction of a CsrGraph from an edge list: count degrees with atomic adds, scan them into offsets, scatter the
+   edges through per vertex cursors, then sort every neighbourhood and squeeze out duplicates, all but the scan's middle step
+   run on the pool */
+template<class Weight>
+class CsrDirectionBuilder {
+public:
+	static constexpr bool weighted = CsrGraph<Weight>::weighted;
+	static constexpr size_t edgeGrain = 1 << 16;
+	static constexpr size_t vertexGrain = 1 << 12;
+
+	struct Arrays {
+		std::vector<uint64_t> offsets;
+		std::vector<uint32_t> targets;
+		std::vector<Weight> weights;
+	};
+
+
+	// reverse lays out in edges, symmetrize adds both directions of every edge
+	static Arrays Build(uint32_t vertexCount, std::span<const CsrEdge<Weight>> edges, ThreadPool& pool, const CsrBuildOptions& options, bool reverse) {
+		Arrays arrays;
+		arrays.offsets.assign(static_cast<size_t>(vertexCount) + 1, 0);
+		ParallelFor(pool, 0, edges.size(), edgeGrain, [&](size_t first, size_t last) {
+			for (size_t i = first; i < last; ++i) {
+				const CsrEdge<Weight>& edge = edges[i];
+				if (options.removeSelfLoops && edge.source == edge.target)
+					continue;
+				std::atomic_ref<uint64_t>(arrays.offsets[reverse ? edge.target : edge.source]).fetch_add(1, std::memory_order_relaxed);
+				if (options.symmetrize)
+					std::atomic_ref<uint64_t>(arrays.offsets[edge.target]).fetch_add(1, std::memory_order_relaxed);
+			}
+		});
+		ParallelExclusiveScan(pool, arrays.offsets);
+
+		const uint64_t edgeCount = arrays.offsets[vertexCount];
+		arrays.targets.resize(edgeCount);
+		if constexpr (weighted)
+			arrays.weights.resize(edgeCount);
+		std::vector<uint64_t> cursors(arrays.offsets.begin(), arrays.offsets.end() - 1);
+		ParallelFor(pool, 0, edges.size(), edgeGrain, [&](size_t first, size_t last) {
+			for (size_t i = first; i < last; ++i) {
+				const CsrEdge<Weight>& edge = edges[i];
+				if (options.removeSelfLoops && edge.source == edge.target)
+					continue;
+				Place(arrays, cursors, reverse ? edge.target : edge.source, reverse ? edge.source : edge.target, edge.weight);
+				if (options.symmetrize)
+					Place(arrays, cursors, edge.target, edge.source, edge.weight);
+			}
+		});
+		cursors = {};
+
+		SortNeighbourhoods(arrays, vertexCount, pool, options.removeDuplicates);
+		return arrays;
+	}
+
+private:
+	static void Place(Arrays& arrays, std::vector<uint64_t>& cursors, uint32_t from, uint32_t to, const Weight& weight) {
+		const uint64_t slot = std::atomic_ref<uint64_t>(cursors[from]).fetch_add(1, std::memory_order_relaxed);
+		arrays.targets[slot] = to;
+		if constexpr (weighted)
+			arrays.weights[slot] = weight;
+	}
+
+	// sorted neighbourhoods make BFS and merges scan memory in order, deduplicating shrinks each one in place and a second
+	// scan then compacts the arrays
+	static void SortNeighbourhoods(Arrays& arrays, uint32_t vertexCount, ThreadPool& pool, bool removeDuplicates) {
+		std::vector<uint64_t> kept(removeDuplicates ? static_cast<size_t>(vertexCount) + 1 : 0, 0);
+		ParallelFor(pool, 0, vertexCount, vertexGrain, [&](size_t first, size_t last) {
+			std::vector<std::pair<uint32_t, Weight>> scratch;
+			for (size_t v = first; v < last; ++v) {
+				uint32_t* begin = arrays.targets.data() + arrays.offsets[v];
+				uint32_t* end = arrays.targets.data() + arrays.offsets[v + 1];
+				size_t degree = static_cast<size_t>(end - begin);
+				if constexpr (weighted) {
+					// lightest first within equal targets so deduplication keeps the lightest
+					Weight* weights = arrays.weights.data() + arrays.offsets[v];
+					scratch.clear();
+					for (size_t i = 0; i < degree; ++i)
+						scratch.emplace_back(begin[i], weights[i]);
+					std::sort(scratch.begin(), scratch.end());
+					if (removeDuplicates)
+						scratch.erase(std::unique(scratch.begin(), scratch.end(), [](const auto& a, const auto& b) { return a.first == b.first; }), scratch.end());
+					degree = scratch.size();
+					for (size_t i = 0; i < degree; ++i) {
+						begin[i] = scratch[i].first;
+						weights[i] = scratch[i].second;
+					}
+				} else {
+					std::sort(begin, end);
+					if (removeDuplicates)
+						degree = static_cast<size_t>(std::unique(begin, end) - begin);
+				}
+				if (removeDuplicates)
+					kept[v] = degree;
+			}
+		});
+		if (!removeDuplicates)
+			return;
+
+		ParallelExclusiveScan(pool, kept);
+		if (kept[vertexCount] == arrays.targets.size())
+			return;
+		Arrays compact;
+		compact.targets.resize(kept[vertexCount]);
+		if constexpr (weighted)
+			compact.weights.resize(kept[vertexCount]);
+		ParallelFor(pool, 0, vertexCount, vertexGrain, [&](size_t first, size_t last) {
+			for (size_t v = first; v < last; ++v) {
+				const size_t degree = static_cast<size_t>(kept[v + 1] - kept[v]);
+				std::copy_n(arrays.targets.data() + arrays.offsets[v], degree, compact.targets.data() + kept[v]);
+				if constexpr (weighted)
+					std::copy_n(arrays.weights.data() + arrays.offsets[v], degree, compact.weights.data() + kept[v]);
+			}
+		});
+		compact.offsets = std::move(kept);
+		arrays = std::move(compact);
+	}
+};
+
+
+// builds a CsrGraph with vertices [0, vertexCount) from an edge list, every endpoint must be below vertexCount
+template<class Weight>
+CsrGraph<Weight> BuildCsrGraph(uint32_t vertexCount, std::span<const CsrEdge<Weight>> edges, ThreadPool& pool, const CsrBuildOptions& options = {}) {
+	using Builder = CsrDirectionBuilder<Weight>;
+	typename Builder::Arrays out = Builder::Build(vertexCount, edges, pool, options, false);
+	typename Builder::Arrays in;
+	if (options.buildInEdges && !options.symmetrize)
+		in = Builder::Build(vertexCount, edges, pool, options, true);
+	return CsrGraph<Weight>(std::move(out.offsets), std::move(out.targets), std::move(out.weights), std::move(in.offsets),
+		std::move(in.targets), std::move(in.weights), options.symmetrize);
+}
+
+template<class Weight>
+CsrGraph<Weight> BuildCsrGraph(uint32_t vertexCount, const std::vector<CsrEdge<Weight>>& edges, ThreadPool& pool, const CsrBuildOptions& options = {}) {
+	return BuildCsrGraph(vertexCount, std::span<const CsrEdge<Weight>>(edges), pool, options);
+}
+
+} // namespace ads
+
+#endif // ALGORITHMS_GRAPH_CSR_BUILDER_H
\ No newline at end of file
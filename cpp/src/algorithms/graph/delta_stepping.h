@@ -0,0 +1,133 @@
+#ifndef ALGORITHMS_GRAPH_DELTA_STEPPING_H
+#define ALGORITHMS_GRAPH_DELTA_STEPPING_H
+
+#include "pch.h"
+#include "algorithms/graph/shortest_path_context.h"
+#include "algorithms/thread_pool.h"
+#include "data_structures/csr_graph.h"
+
+namespace ads {
+
+/* parallel single source shortest paths by delta-stepping (Meyer and Sanders): tentative distances are bucketed by
+   distance / delta and the lowest non empty bucket is relaxed by all threads at once, each relaxation lowers the target's
+   distance with a compare and swap and files it under its new bucket, a bucket is rerun until it stays empty, entries left
+   behind in a higher bucket by a later improvement are skipped when that bucket comes up; delta trades the extra
+   relaxations of large buckets against the steps of small ones, around the average edge weight times a small factor works */
+template<class Weight>
+class DeltaStepping {
+public:
+	using Graph = CsrGraph<Weight>;
+	using Distance = typename PathDistance<Weight>::Type;
+
+	static constexpr Distance unreached = PathDistance<Weight>::unreached;
+	static constexpr size_t grain = 64;
+
+	// distances is resized to the vertex count, unreachable vertices get unreached, delta has to be positive and not so small
+	// that the longest possible path would be more buckets away than a size_t counts
+	static void Run(const Graph& graph, uint32_t source, ThreadPool& pool, Distance delta, std::vector<Distance>& distances) {
+		// also catches a NaN delta, which would turn every bucket index into garbage
+		if (!(delta > 0))
+			throw std::invalid_argument("delta-stepping needs a positive bucket width");
+		const Distance maxWeight = MaxWeight(graph, pool);
+		const double longestPath = static_cast<double>(maxWeight) * static_cast<double>(graph.VertexCount());
+		if (!(longestPath / static_cast<double>(delta) < static_cast<double>(std::numeric_limits<size_t>::max() / 2)))
+			throw std::invalid_argument("delta-stepping bucket width too small for the graph's distances");
+		distances.assign(graph.VertexCount(), unreached);
+		distances[source] = 0;
+
+		// relaxing bucket b only ever files into buckets b to b + ceil(maxWeight / delta), so that many plus one slots used
+		// cyclically hold every live bucket, one more absorbs the rounding of floating point distances
+		const size_t span = static_cast<size_t>(std::ceil(static_cast<double>(maxWeight) / static_cast<double>(delta)));
+		std::vector<std::vector<uint32_t>> buckets(span + 2);
+		std::mutex bucketsMutex;
+		std::vector<uint32_t> frontier{ source };
+		size_t bucket = 0;
+		while (true) {
+			ParallelFor(pool, 0, frontier.size(), grain, [&](size_t first, size_t last) {
+				std::vector<std::pair<size_t, uint32_t>> filed;
+				for (size_t i = first; i < last; ++i) {
+					const uint32_t u = frontier[i];
+					const Distance base = std::atomic_ref<Distance>(distances[u]).load(std::memory_order_relaxed);
+					// settled through a lower bucket after it was filed here
+					if (BucketOf(base, delta) < bucket)
+						continue;
+					const std::span<const uint32_t> neighbours = graph.OutNeighbors(u);
+					for (size_t j = 0; j < neighbours.size(); ++j) {
+						Distance distance = base;
+						if constexpr (Graph::weighted)
+							distance += PathDistance<Weight>::Of(graph.OutWeights(u)[j]);
+						else
+							distance += 1;
+						if (LowerTo(distances[neighbours[j]], distance))
+							filed.emplace_back(BucketOf(distance, delta) % buckets.size(), neighbours[j]);
+					}
+				}
+				if (filed.empty())
+					return;
+				std::lock_guard<std::mutex> lock(bucketsMutex);
+				for (const auto& [slot, v] : filed)
+					buckets[slot].push_back(v);
+			});
+
+			// the current bucket again if relaxing it refilled it, otherwise the next non empty one, a whole lap of empty
+			// slots means nothing is left
+			size_t empty = 0;
+			while (empty < buckets.size() && buckets[bucket % buckets.size()].empty()) {
+				++bucket;
+				++empty;
+			}
+			if (empty == buckets.size())
+				return;
+			frontier.swap(buckets[bucket % buckets.size()]);
+			buckets[bucket % buckets.size()].clear();
+		}
+	}
+
+private:
+	static size_t BucketOf(Distance distance, Distance delta) {
+		return static_cast<size_t>(distance / delta);
+	}
+
+	static Distance MaxWeight(const Graph& graph, ThreadPool& pool) {
+		if constexpr (!Graph::weighted) {
+			return 1;
+		} else {
+			Distance maxWeight = 0;
+			std::mutex maxMutex;
+			ParallelFor(pool, 0, graph.VertexCount(), 4096, [&](size_t first, size_t last) {
+				Distance local = 0;
+				for (size_t v = first; v < last; ++v) {
+					for (const Weight& weight : graph.OutWeights(static_cast<uint32_t>(v)))
+						local = std::max(local, PathDistance<Weight>::Of(weight));
+				}
+				std::lock_guard<std::mutex> lock(maxMutex);
+				maxWeight = std::max(maxWeight, local);
+			});
+			return maxWeight;
+		}
+	}
+
+	// compare and swap loop that only ever lowers target, returns whether this call lowered it
+	static bool LowerTo(Distance& target, Distance distance) {
+		std::atomic_ref<Distance> slot(target);
+		Distance current = slot.load(std::memory_order_relaxed);
+		while (distance < current) {
+			if (slot.compare_exchange_weak(current, distance, std::memory_order_relaxed))
+				return true;
+		}
+		return false;
+	}
+};
+
+
+template<class Weight>
+std::vector<typename PathDistance<Weight>::Type> DeltaSteppingDistances(const CsrGraph<Weight>& graph, uint32_t source, ThreadPool& pool,
+	typename PathDistance<Weight>::Type delta) {
+	std::vector<typename PathDistance<Weight>::Type> distances;
+	DeltaStepping<Weight>::Run(graph, source, pool, delta, distances);
+	return distances;
+}
+
+} // namespace ads
+
+#endif // ALGORITHMS_GRAPH_DELTA_STEPPING_H
\ No newline at end of file
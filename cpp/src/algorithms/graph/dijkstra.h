@@ -0,0 +1,79 @@
+#ifndef ALGORITHMS_GRAPH_DIJKSTRA_H
+#define ALGORITHMS_GRAPH_DIJKSTRA_H
+
+#include "pch.h"
+#include "algorithms/graph/shortest_path_context.h"
+#include "data_structures/csr_graph.h"
+
+namespace ads {
+
+enum class DijkstraQueue {
+	RadixHeap,	// monotone buckets with lazy deletion, stale entries are skipped when popped
+	DaryHeap	// indexed 4-ary heap with decrease-key, every vertex is queued at most once
+};
+
+
+/* single source shortest paths for non negative weights, vertices are settled in distance order so a point to point query
+   stops as soon as its target is popped */
+template<class Weight, DijkstraQueue Queue = DijkstraQueue::RadixHeap>
+class Dijkstra {
+public:
+	using Graph = CsrGraph<Weight>;
+	using Context = ShortestPathContext<Weight>;
+	using Distance = typename Context::Distance;
+
+	// without a target every vertex reachable from source is settled
+	static void Run(const Graph& graph, uint32_t source, Context& context, uint32_t target = Graph::noVertex) {
+		context.Begin(graph.VertexCount(), source);
+		if constexpr (Queue == DijkstraQueue::RadixHeap) {
+			RadixHeap<uint64_t, uint32_t>& heap = context.m_radixHeap;
+			heap.Push(PathDistance<Weight>::RadixKey(0), source);
+			while (!heap.IsEmpty()) {
+				const auto [key, u] = heap.Pop();
+				if (key != PathDistance<Weight>::RadixKey(context.m_distances[u]))
+					continue;
+				++context.m_settled;
+				if (u == target)
+					return;
+				RelaxOutEdges(graph, u, context, [&heap](uint32_t v, Distance distance) { heap.Push(PathDistance<Weight>::RadixKey(distance), v); });
+			}
+		} else {
+			IndexedDaryHeap<Distance, 4, std::greater<Distance>>& heap = context.m_heap;
+			heap.Push(source, 0);
+			while (!heap.IsEmpty()) {
+				const uint32_t u = heap.PopTop().id;
+				++context.m_settled;
+				if (u == target)
+					return;
+				RelaxOutEdges(graph, u, context, [&heap](uint32_t v, Distance distance) { heap.DecreaseKey(v, distance); });
+			}
+		}
+	}
+
+private:
+	template<class OnImproved>
+	static void RelaxOutEdges(const Graph& graph, uint32_t u, Context& context, OnImproved&& onImproved) {
+		const Distance base = context.m_distances[u];
+		const std::span<const uint32_t> neighbours = graph.OutNeighbors(u);
+		for (size_t i = 0; i < neighbours.size(); ++i) {
+			Distance distance = base;
+			if constexpr (Graph::weighted)
+				distance += PathDistance<Weight>::Of(graph.OutWeights(u)[i]);
+			else
+				distance += 1;
+			if (context.Improve(neighbours[i], distance, u))
+				onImproved(neighbours[i], distance);
+		}
+	}
+};
+
+
+// fills context with distances from source, stopping once target is settled if one is given
+template<DijkstraQueue Queue = DijkstraQueue::RadixHeap, class Weight>
+void ShortestPaths(const CsrGraph<Weight>& graph, uint32_t source, ShortestPathContext<Weight>& context, uint32_t target = CsrGraph<Weight>::noVertex) {
+	Dijkstra<Weight, Queue>::Run(graph, source, context, target);
+}
+
+} // namespace ads
+
+#endif // ALGORITHMS_GRAPH_DIJKSTRA_H
\ No newline at end of file
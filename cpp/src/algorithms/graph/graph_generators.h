@@ -0,0 +1,137 @@
+#ifndef ALGORITHMS_GRAPH_GRAPH_GENERATORS_H
+#define ALGORITHMS_GRAPH_GRAPH_GENERATORS_H
+
+#include "pch.h"
+#include "algorithms/thread_pool.h"
+#include "data_structures/csr_graph.h"
+
+namespace ads {
+
+/* quadrant probabilities of the recursive matrix model, d is whatever a, b and c leave over */
+struct RmatParameters {
+	double a = 0.57;
+	double b = 0.19;
+	double c = 0.19;
+};
+
+
+/* synthetic edge lists for benchmarking, every random draw is a hash of the seed and the draw's position so the output
+   is the same whatever the thread count */
+class GraphGenerator {
+public:
+	static constexpr size_t grain = 1 << 14;
+
+	// splitmix64 finaliser
+	static uint64_t Hash(uint64_t x) {
+		x += 0x9E3779B97F4A7C15ull;
+		x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+		x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+		return x ^ (x >> 31);
+	}
+
+	// uniform in [0, 1) from 32 random bits
+	static double UnitDraw(uint32_t bits) {
+		return static_cast<double>(bits) * 0x1.0p-32;
+	}
+
+	// 2^scale vertices and edgeFactor edges per vertex, every edge descends scale levels of the adjacency matrix picking a
+	// quadrant with the given probabilities, which gives the skewed degrees and small diameter of social and web graphs
+	static std::vector<CsrEdge<>> Rmat(unsigned scale, size_t edgeFactor, uint64_t seed, ThreadPool& pool, const RmatParameters& params = {}) {
+		const size_t edgeCount = (size_t(1) << scale) * edgeFactor;
+		std::vector<CsrEdge<>> edges(edgeCount);
+		const double ab = params.a + params.b;
+		const double abc = ab + params.c;
+		ParallelFor(pool, 0, edgeCount, grain, [&](size_t first, size_t last) {
+			for (size_t i = first; i < last; ++i) {
+				const uint64_t edgeKey = Hash(seed ^ Hash(i));
+				uint32_t source = 0;
+				uint32_t target = 0;
+				uint64_t bits = 0;
+				for (unsigned level = 0; level < scale; ++level) {
+					// one hash feeds two levels
+					bits = level % 2 == 0 ? Hash(edgeKey + level) : bits >> 32;
+					const double r = UnitDraw(static_cast<uint32_t>(bits));
+					// the top half holds quadrants a and b, the bottom half c and d
+					const bool bottom = r >= ab;
+					const bool right = bottom ? r >= abc : r >= params.a;
+					source = (source << 1) | static_cast<uint32_t>(bottom);
+					target = (target << 1) | static_cast<uint32_t>(right);
+				}
+				edges[i] = { source, target, {} };
+			}
+		});
+		return edges;
+	}
+
+	// Graph 500 style Kronecker graph, RMAT with the Graph 500 initiator whose vertex ids are then randomly relabelled and whose
+	// edges are shuffled, so neither high degree vertices nor their edges cluster at low ids
+	static std::vector<CsrEdge<>> Kronecker(unsigned scale, size_t edgeFactor, uint64_t seed, ThreadPool& pool) {
+		std::vector<CsrEdge<>> edges = Rmat(scale, edgeFactor, seed, pool);
+		std::vector<uint32_t> labels(size_t(1) << scale);
+		std::iota(labels.begin(), labels.end(), 0u);
+		std::mt19937_64 rng(Hash(seed + 1));
+		std::shuffle(labels.begin(), labels.end(), rng);
+		ParallelFor(pool, 0, edges.size(), grain, [&](size_t first, size_t last) {
+			for (size_t i = first; i < last; ++i)
+				edges[i] = { labels[edges[i].source], labels[edges[i].target], {} };
+		});
+		std::shuffle(edges.begin(), edges.end(), rng);
+		return edges;
+	}
+
+	// Erdos-Renyi style, edgeCount edges with both ends drawn uniformly
+	static std::vector<CsrEdge<>> Uniform(uint32_t vertexCount, size_t edgeCount, uint64_t seed, ThreadPool& pool) {
+		std::vector<CsrEdge<>> edges(edgeCount);
+		ParallelFor(pool, 0, edgeCount, grain, [&](size_t first, size_t last) {
+			for (size_t i = first; i < last; ++i) {
+				const uint64_t bits = Hash(seed ^ Hash(i));
+				edges[i] = { static_cast<uint32_t>(((bits & 0xFFFFFFFFu) * vertexCount) >> 32), static_cast<uint32_t>(((bits >> 32) * vertexCount) >> 32), {} };
+			}
+		});
+		return edges;
+	}
+	// width x height lattice joining horizontally and vertically adjacent cells, each edge listed once so build it symmetrized,
+	// with random weights it stands in for a road network: planar, low degree and a diameter of width + height steps
+	static std::vector<CsrEdge<>> Grid(uint32_t width, uint32_t height, ThreadPool& pool) {
+		if (width == 0 || height == 0)
+			return {};
+		// every row but the last has width - 1 edges to the right followed by width edges down
+		const size_t rowEdges = 2 * size_t(width) - 1;
+		std::vector<CsrEdge<>> edges((height - 1) * rowEdges + width - 1);
+		ParallelFor(pool, 0, height, 64, [&](size_t first, size_t last) {
+			for (size_t y = first; y < last; ++y) {
+				const uint32_t row = static_cast<uint32_t>(y * width);
+				CsrEdge<>* out = edges.data() + y * rowEdges;
+				for (uint32_t x = 0; x + 1 < width; ++x)
+					*out++ = { row + x, row + x + 1, {} };
+				if (y + 1 < height) {
+					for (uint32_t x = 0; x < width; ++x)
+						*out++ = { row + x, row + width + x, {} };
+				}
+			}
+		});
+		return edges;
+	}
+
+	// the same edges with a uniform random weight in [minWeight, maxWeight] each
+	template<class Weight>
+	static std::vector<CsrEdge<Weight>> Weighted(const std::vector<CsrEdge<>>& edges, Weight minWeight, Weight maxWeight, uint64_t seed, ThreadPool& pool) {
+		std::vector<CsrEdge<Weight>> weighted(edges.size());
+		ParallelFor(pool, 0, edges.size(), grain, [&](size_t first, size_t last) {
+			for (size_t i = first; i < last; ++i) {
+				const uint64_t bits = Hash(seed ^ Hash(i));
+				Weight weight;
+				if constexpr (std::is_floating_point_v<Weight>)
+					weight = minWeight + static_cast<Weight>(static_cast<double>(bits >> 11) * 0x1.0p-53 * static_cast<double>(maxWeight - minWeight));
+				else
+					weight = static_cast<Weight>(minWeight + bits % (static_cast<uint64_t>(maxWeight - minWeight) + 1));
+				weighted[i] = { edges[i].source, edges[i].target, weight };
+			}
+		});
+		return weighted;
+	}
+};
+
+} // namespace ads
+
+#endif // ALGORITHMS_GRAPH_GRAPH_GENERATORS_H
\ No newline at end of file
@@ -0,0 +1,89 @@
+#ifndef ALGORITHMS_GRAPH_PAGE_RANK_H
+#define ALGORITHMS_GRAPH_PAGE_RANK_H
+
+#include "pch.h"
+#include "algorithms/thread_pool.h"
+#include "data_structures/csr_graph.h"
+
+namespace ads {
+
+struct PageRankOptions {
+	double damping = 0.85;
+	double tolerance = 1e-6;			// stop once the ranks move less than this in total (L1)
+	unsigned maxIterations = 100;
+};
+
+
+struct PageRankResult {
+	std::vector<double> ranks;			// sums to 1
+	unsigned iterations = 0;
+	double error = 0.0;					// L1 change of the last iteration
+};
+
+
+/* pull based PageRank: every iteration first spreads each vertex's rank over its out degree, then each vertex sums the shares
+   of its in neighbours, so all writes go to the vertex's own slot and no atomics are needed, the rank of vertices without
+   out edges is handed to everyone evenly */
+template<class Weight>
+class PageRank {
+public:
+	using Graph = CsrGraph<Weight>;
+
+	static constexpr size_t grain = 1 << 12;
+
+	// needs the graph's in edges
+	static PageRankResult Run(const Graph& graph, ThreadPool& pool, const PageRankOptions& options = {}) {
+		if (!graph.HasInEdges())
+			throw std::invalid_argument("PageRank pulls along in edges, build the graph symmetric or with buildInEdges");
+
+		const size_t vertexCount = graph.VertexCount();
+		PageRankResult result;
+		if (vertexCount == 0)
+			return result;
+		const double initial = 1.0 / static_cast<double>(vertexCount);
+		result.ranks.assign(vertexCount, initial);
+		std::vector<double> shares(vertexCount);
+		while (result.iterations < options.maxIterations) {
+			std::atomic<double> danglingRank(0.0);
+			ParallelFor(pool, 0, vertexCount, grain, [&](size_t first, size_t last) {
+				double dangling = 0.0;
+				for (size_t v = first; v < last; ++v) {
+					const size_t degree = graph.OutDegree(static_cast<uint32_t>(v));
+					shares[v] = degree != 0 ? result.ranks[v] / static_cast<double>(degree) : 0.0;
+					dangling += degree != 0 ? 0.0 : result.ranks[v];
+				}
+				danglingRank.fetch_add(dangling, std::memory_order_relaxed);
+			});
+
+			const double base = (1.0 - options.damping + options.damping * danglingRank.load(std::memory_order_relaxed)) * initial;
+			std::atomic<double> error(0.0);
+			ParallelFor(pool, 0, vertexCount, grain, [&](size_t first, size_t last) {
+				double localError = 0.0;
+				for (size_t v = first; v < last; ++v) {
+					double sum = 0.0;
+					for (uint32_t u : graph.InNeighbors(static_cast<uint32_t>(v)))
+						sum += shares[u];
+					const double rank = base + options.damping * sum;
+					localError += std::abs(rank - result.ranks[v]);
+					result.ranks[v] = rank;
+				}
+				error.fetch_add(localError, std::memory_order_relaxed);
+			});
+			++result.iterations;
+			result.error = error.load(std::memory_order_relaxed);
+			if (result.error < options.tolerance)
+				break;
+		}
+		return result;
+	}
+};
+
+
+template<class Weight>
+PageRankResult ComputePageRank(const CsrGraph<Weight>& graph, ThreadPool& pool, const PageRankOptions& options = {}) {
+	return PageRank<Weight>::Run(graph, pool, options);
+}
+
+} // namespace ads
+
+#endif // ALGORITHMS_GRAPH_PAGE_RANK_H
\ No newline at end of file
@@ -0,0 +1,142 @@
+#ifndef ALGORITHMS_GRAPH_SHORTEST_PATH_CONTEXT_H
+#define ALGORITHMS_GRAPH_SHORTEST_PATH_CONTEXT_H
+
+#include "pch.h"
+#include "data_structures/csr_graph.h"
+#include "data_structures/dary_heap.h"
+#include "data_structures/radix_heap.h"
+
+namespace ads {
+
+enum class DijkstraQueue;
+
+template<class Weight, DijkstraQueue Queue>
+class Dijkstra;
+
+template<class Weight>
+class AStar;
+
+
+/* distance type shortest path searches sum edge weights into, integer weights add up in 64 bits and unweighted edges count 1 */
+template<class Weight>
+struct PathDistance {
+	static_assert(std::is_same_v<Weight, Unweighted> || std::is_arithmetic_v<Weight>, "shortest paths need numeric edge weights");
+
+	using Type = std::conditional_t<std::is_floating_point_v<Weight>, double, uint64_t>;
+
+	static constexpr Type unreached = std::is_floating_point_v<Weight> ? std::numeric_limits<Type>::infinity() : std::numeric_limits<Type>::max();
+
+	static Type Of(const Weight& weight) {
+		if constexpr (std::is_same_v<Weight, Unweighted>)
+			return 1;
+		else
+			return static_cast<Type>(weight);
+	}
+
+	// order preserving radix heap key, non negative doubles already order like their bit patterns
+	static uint64_t RadixKey(Type distance) {
+		if constexpr (std::is_floating_point_v<Type>)
+			return std::bit_cast<uint64_t>(distance);
+		else
+			return distance;
+	}
+};
+
+
+/* the per query state of Dijkstra and A*, kept between queries so they reuse its memory and only allocate when a query
+   queues more than any before it: distances and parents are only valid where a vertex's stamp matches the current generation,
+   so starting a query bumps the generation instead of clearing the arrays, and the heaps keep their capacity */
+template<class Weight>
+class ShortestPathContext {
+public:
+	using Distance = typename PathDistance<Weight>::Type;
+
+	static constexpr Distance unreached = PathDistance<Weight>::unreached;
+	static constexpr uint32_t noVertex = CsrGraph<Weight>::noVertex;
+
+	// new stamps are 0 and generations start at 1, so nothing counts as reached before the first query
+	ShortestPathContext() : m_source(noVertex), m_generation(1), m_settled(0) {}
+
+	explicit ShortestPathContext(size_t vertexCount) : ShortestPathContext() {
+		Reserve(vertexCount);
+	}
+
+	// sizes every per vertex array for graphs of up to vertexCount vertices
+	void Reserve(size_t vertexCount) {
+		if (vertexCount <= m_stamps.size())
+			return;
+		m_distances.resize(vertexCount);
+		m_parents.resize(vertexCount);
+		m_stamps.resize(vertexCount, 0);
+		m_heap.Clear();
+		m_heap.ResizeIds(vertexCount);
+		m_heap.Reserve(vertexCount);
+		m_radixHeap.Reserve(vertexCount);
+	}
+
+	uint32_t Source() const		{ return m_source; }
+	// vertices popped by the last query, the work an A* heuristic saves shows up here
+	size_t SettledCount() const	{ return m_settled; }
+
+	bool IsReached(uint32_t v) const		{ return m_stamps[v] == m_generation; }
+	Distance DistanceTo(uint32_t v) const	{ return IsReached(v) ? m_distances[v] : unreached; }
+	uint32_t ParentOf(uint32_t v) const		{ return IsReached(v) ? m_parents[v] : noVertex; }
+
+	// fills path with the vertices from the source to target, leaves it empty if target wasn't reached
+	void PathTo(uint32_t target, std::vector<uint32_t>& path) const {
+		path.clear();
+		if (!IsReached(target))
+			return;
+		for (uint32_t v = target; ; v = m_parents[v]) {
+			path.push_back(v);
+			if (v == m_source)
+				break;
+		}
+		std::reverse(path.begin(), path.end());
+	}
+
+private:
+	template<class, DijkstraQueue> friend class Dijkstra;
+	template<class> friend class AStar;
+
+	void Begin(size_t vertexCount, uint32_t source) {
+		Reserve(vertexCount);
+		m_heap.Clear();
+		m_radixHeap.Clear();
+		m_settled = 0;
+		m_source = source;
+		// stamps of a wrapped counter could match, so start over from clean stamps
+		if (++m_generation == 0) {
+			std::fill(m_stamps.begin(), m_stamps.end(), 0);
+			m_generation = 1;
+		}
+		Reach(source, 0, source);
+	}
+
+	void Reach(uint32_t v, Distance distance, uint32_t parent) {
+		m_stamps[v] = m_generation;
+		m_distances[v] = distance;
+		m_parents[v] = parent;
+	}
+
+	// records distance for v if it beats what v has, returns whether it did
+	bool Improve(uint32_t v, Distance distance, uint32_t parent) {
+		if (IsReached(v) && !(distance < m_distances[v]))
+			return false;
+		Reach(v, distance, parent);
+		return true;
+	}
+
+	std::vector<Distance> m_distances;
+	std::vector<uint32_t> m_parents;
+	std::vector<uint32_t> m_stamps;
+	IndexedDaryHeap<Distance, 4, std::greater<Distance>> m_heap;
+	RadixHeap<uint64_t, uint32_t> m_radixHeap;
+	uint32_t m_source;
+	uint32_t m_generation;
+	size_t m_settled;
+};
+
+} // namespace ads
+
+#endif // ALGORITHMS_GRAPH_SHORTEST_PATH_CONTEXT_H
\ No newline at end of file
@@ -0,0 +1,32 @@
+#ifndef ALGORITHMS_SEARCH_BRANCHLESS_SEARCH_H
+#define ALGORITHMS_SEARCH_BRANCHLESS_SEARCH_H
+
+#include "pch.h"
+#include "data_structures/cache_line.h"
+
+namespace ads {
+
+// std::lower_bound without a data dependent branch: the trip count only depends on the length and each step is a conditional add,
+// so nothing is mispredicted and both midpoints the next step can pick are prefetched while this one is compared
+template<std::random_access_iterator It, class T, class Compare = std::less<>>
+It BranchlessLowerBound(It first, It last, const T& value, Compare comp = {}) {
+	using Difference = std::iter_difference_t<It>;
+	Difference length = last - first;
+	if (length == 0)
+		return first;
+
+	while (length > 1) {
+		const Difference half = length / 2;
+		length -= half;
+		if constexpr (std::contiguous_iterator<It>) {
+			PrefetchRead(std::to_address(first) + length / 2);
+			PrefetchRead(std::to_address(first) + (half + length / 2));
+		}
+		first += static_cast<Difference>(comp(first[half - 1], value)) * half;
+	}
+	return first + static_cast<Difference>(comp(*first, value));
+}
+
+} // namespace ads
+
+#endif // ALGORITHMS_SEARCH_BRANCHLESS_SEARCH_H
\ No newline at end of file
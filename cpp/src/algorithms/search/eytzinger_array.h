@@ -0,0 +1,79 @@
+#ifndef ALGORITHMS_SEARCH_EYTZINGER_ARRAY_H
+#define ALGORITHMS_SEARCH_EYTZINGER_ARRAY_H
+
+#include "pch.h"
+#include "data_structures/cache_line.h"
+
+namespace ads {
+
+/* static sorted set stored in breadth first order of an implicit binary tree (1 is the root, k's children are 2k and 2k + 1), so the
+   first levels of every search share a few hot cache lines; the descent is branchless and prefetches the line holding the node's
+   descendants a few levels down, which the array's cache line alignment keeps on a single line */
+template<class T, class Compare = std::less<T>>
+class EytzingerArray {
+public:
+	// the descendants of k that many levels down are the consecutive indices k * prefetchStride onwards
+	static constexpr size_t prefetchStride = std::bit_floor(std::max<size_t>(1, cacheLineSize / sizeof(T)));
+
+	explicit EytzingerArray(Compare comp = Compare()) : m_comp(comp) {}
+
+	// builds the layout from a sorted range in one in-order pass
+	template<std::forward_iterator It>
+	EytzingerArray(It first, It last, Compare comp = Compare()) : m_comp(comp) {
+		const size_t size = static_cast<size_t>(std::distance(first, last));
+		if (size == 0)
+			return;
+		// slot 0 is never searched, it only keeps the root at index 1
+		m_values.assign(size + 1, *first);
+		Build(1, first);
+	}
+
+	size_t Size() const		{ return m_values.empty() ? 0 : m_values.size() - 1; }
+	bool IsEmpty() const	{ return m_values.size() <= 1; }
+
+	// the first value not less than key, or nullptr if every value is less
+	const T* LowerBound(const T& key) const {
+		const size_t index = LowerBoundIndex(key);
+		return index != 0 ? &m_values[index] : nullptr;
+	}
+
+	bool Contains(const T& key) const {
+		const T* found = LowerBound(key);
+		return found != nullptr && !m_comp(key, *found);
+	}
+
+	// layout index of the first value not less than key, 0 if there is none
+	size_t LowerBoundIndex(const T& key) const {
+		const size_t size = Size();
+		const uintptr_t base = reinterpret_cast<uintptr_t>(m_values.data());
+		size_t k = 1;
+		while (k <= size) {
+			// integer arithmetic, the prefetched address is usually past the end on the last few levels
+			PrefetchRead(reinterpret_cast<const void*>(base + k * prefetchStride * sizeof(T)));
+			k = 2 * k + static_cast<size_t>(m_comp(m_values[k], key));
+		}
+		// every right turn appended a 1, the answer is where the path last went left
+		return k >> (std::countr_one(k) + 1);
+	}
+
+	// index 0 is unused, the rest is the tree in breadth first order
+	std::span<const T> Layout() const { return m_values; }
+
+private:
+	template<class It>
+	void Build(size_t k, It& it) {
+		if (k > Size())
+			return;
+		Build(2 * k, it);
+		m_values[k] = *it;
+		++it;
+		Build(2 * k + 1, it);
+	}
+
+	std::vector<T, CacheAlignedAllocator<T>> m_values;
+	ADS_NO_UNIQUE_ADDRESS Compare m_comp;
+};
+
+} // namespace ads
+
+#endif // ALGORITHMS_SEARCH_EYTZINGER_ARRAY_H
\ No newline at end of file
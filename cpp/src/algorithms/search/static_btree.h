@@ -0,0 +1,171 @@
+#ifndef ALGORITHMS_SEARCH_STATIC_BTREE_H
+#define ALGORITHMS_SEARCH_STATIC_BTREE_H
+
+#include "pch.h"
+#include "data_structures/cache_line.h"
+#include "data_structures/simd.h"
+
+namespace ads {
+
+// how many of the Count sorted keys in node are less than key, compared a whole vector at a time for 32 and 64 bit integers and
+// floats under std::less; there's no early exit, the lane masks are joined and the sorted keys make the rank their run of low ones,
+// which is a bit scan rather than a popcount that baseline x64 has no instruction for
+template<class T, size_t Count, class Compare>
+size_t NodeRank(const T* node, const T& key, const Compare& comp) {
+	[[maybe_unused]] constexpr bool plainLess = std::is_same_v<Compare, std::less<T>> || std::is_same_v<Compare, std::less<>>;
+
+	if constexpr (plainLess && std::is_integral_v<T> && sizeof(T) == 4 && Count % 4 == 0) {
+		// unsigned keys are flipped into signed order, the lane compares are signed
+		[[maybe_unused]] const int32_t flip = std::is_signed_v<T> ? 0 : INT32_MIN;
+#if defined(ADS_AVX2)
+		if constexpr (Count % 8 == 0) {
+			const __m256i bias = _mm256_set1_epi32(flip);
+			const __m256i needle = _mm256_set1_epi32(static_cast<int32_t>(key) ^ flip);
+			uint32_t less = 0;
+			for (size_t i = 0; i < Count; i += 8) {
+				const __m256i block = _mm256_xor_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(node + i)), bias);
+				less |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(needle, block)))) << i;
+			}
+			return std::countr_one(less);
+		}
+#endif
+#if defined(ADS_SSE2)
+		const __m128i bias = _mm_set1_epi32(flip);
+		const __m128i needle = _mm_set1_epi32(static_cast<int32_t>(key) ^ flip);
+		uint32_t less = 0;
+		for (size_t i = 0; i < Count; i += 4) {
+			const __m128i block = _mm_xor_si128(_mm_load_si128(reinterpret_cast<const __m128i*>(node + i)), bias);
+			less |= static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(needle, block)))) << i;
+		}
+		return std::countr_one(less);
+#endif
+	} else if constexpr (plainLess && std::is_integral_v<T> && sizeof(T) == 8 && Count % 4 == 0) {
+#if defined(ADS_AVX2)
+		const int64_t flip = std::is_signed_v<T> ? 0 : INT64_MIN;
+		const __m256i bias = _mm256_set1_epi64x(flip);
+		const __m256i needle = _mm256_set1_epi64x(static_cast<int64_t>(key) ^ flip);
+		uint32_t less = 0;
+		for (size_t i = 0; i < Count; i += 4) {
+			const __m256i block = _mm256_xor_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(node + i)), bias);
+			less |= static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(needle, block)))) << i;
+		}
+		return std::countr_one(less);
+#endif
+	} else if constexpr (plainLess && std::is_same_v<T, float> && Count % 4 == 0) {
+#if defined(ADS_AVX2)
+		if constexpr (Count % 8 == 0) {
+			const __m256 needle = _mm256_set1_ps(key);
+			uint32_t less = 0;
+			for (size_t i = 0; i < Count; i += 8)
+				less |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_load_ps(node + i), needle, _CMP_LT_OQ))) << i;
+			return std::countr_one(less);
+		}
+#endif
+#if defined(ADS_SSE2)
+		const __m128 needle = _mm_set1_ps(key);
+		uint32_t less = 0;
+		for (size_t i = 0; i < Count; i += 4)
+			less |= static_cast<uint32_t>(_mm_movemask_ps(_mm_cmplt_ps(_mm_load_ps(node + i), needle))) << i;
+		return std::countr_one(less);
+#endif
+	} else if constexpr (plainLess && std::is_same_v<T, double> && Count % 2 == 0) {
+#if defined(ADS_SSE2)
+		const __m128d needle = _mm_set1_pd(key);
+		uint32_t less = 0;
+		for (size_t i = 0; i < Count; i += 2)
+			less |= static_cast<uint32_t>(_mm_movemask_pd(_mm_cmplt_pd(_mm_load_pd(node + i), needle))) << i;
+		return std::countr_one(less);
+#endif
+	}
+
+	size_t rank = 0;
+	for (size_t i = 0; i < Count; ++i)
+		rank += static_cast<size_t>(comp(node[i], key));
+	return rank;
+}
+
+
+/* static sorted set laid out as an implicit B+1-ary search tree of cache line sized nodes (the S-tree), node k's children are
+   k * (keysPerNode + 1) + 1 onwards so there are no pointers; a lookup touches one line per level, log base 17 of n lines for
+   32 bit keys against log base 2 for a binary search, and ranks each node with NodeRank */
+template<class T, class Compare = std::less<T>>
+class StaticBTree {
+public:
+	static constexpr size_t keysPerNode = std::max<size_t>(2, cacheLineSize / sizeof(T));
+
+	explicit StaticBTree(Compare comp = Compare()) : m_size(0), m_nodeCount(0), m_comp(comp) {}
+
+	// builds the layout from a sorted range in one in-order pass, the last node is padded with copies of the largest value
+	template<std::forward_iterator It>
+	StaticBTree(It first, It last, Compare comp = Compare()) : m_size(static_cast<size_t>(std::distance(first, last))),
+		m_nodeCount((m_size + keysPerNode - 1) / keysPerNode), m_comp(comp) {
+		if (m_size == 0)
+			return;
+		m_keys.assign(m_nodeCount * keysPerNode, *first);
+		size_t written = 0;
+		size_t lastIndex = 0;
+		Build(0, first, written, lastIndex);
+	}
+
+	size_t Size() const		{ return m_size; }
+	bool IsEmpty() const	{ return m_size == 0; }
+	size_t Height() const {
+		size_t height = 0;
+		for (size_t k = 0; k < m_nodeCount; k = Child(k, 0))
+			++height;
+		return height;
+	}
+
+	// the first value not less than key, or nullptr if every value is less
+	const T* LowerBound(const T& key) const {
+		const T* result = nullptr;
+		for (size_t k = 0; k < m_nodeCount;) {
+			const T* node = &m_keys[k * keysPerNode];
+			const size_t rank = NodeRank<T, keysPerNode>(node, key, m_comp);
+			// a key found here is the smallest candidate so far, child rank only holds smaller ones
+			result = rank < keysPerNode ? node + rank : result;
+			k = Child(k, rank);
+		}
+		return result;
+	}
+
+	bool Contains(const T& key) const {
+		const T* found = LowerBound(key);
+		return found != nullptr && !m_comp(key, *found);
+	}
+
+	// nodes one after another, keysPerNode keys each
+	std::span<const T> Layout() const { return m_keys; }
+
+private:
+	static size_t Child(size_t k, size_t i) { return k * (keysPerNode + 1) + i + 1; }
+
+	// in-order walk, so every node's keys separate the subtrees between them
+	template<class It>
+	void Build(size_t k, It& it, size_t& written, size_t& lastIndex) {
+		if (k >= m_nodeCount)
+			return;
+		for (size_t i = 0; i < keysPerNode; ++i) {
+			Build(Child(k, i), it, written, lastIndex);
+			const size_t index = k * keysPerNode + i;
+			if (written < m_size) {
+				m_keys[index] = *it;
+				++it;
+				++written;
+				lastIndex = index;
+			} else {
+				m_keys[index] = m_keys[lastIndex];
+			}
+		}
+		Build(Child(k, keysPerNode), it, written, lastIndex);
+	}
+
+	std::vector<T, CacheAlignedAllocator<T>> m_keys;
+	size_t m_size;
+	size_t m_nodeCount;
+	ADS_NO_UNIQUE_ADDRESS Compare m_comp;
+};
+
+} // namespace ads
+
+#endif // ALGORITHMS_SEARCH_STATIC_BTREE_H
\ No newline at end of file
@@ -0,0 +1,18 @@
+#ifndef ALGORITHMS_SORT_BUFFERED_SORT_H
+#define ALGORITHMS_SORT_BUFFERED_SORT_H
+
+#include "pch.h"
+
+namespace ads {
+
+// moves [first, last) into a vector, runs sort on the vector's range and moves the sorted values back, for ranges like the ads lists that can't be indexed
+template<std::forward_iterator It, class SortFn>
+void SortThroughBuffer(It first, It last, SortFn&& sort) {
+	std::vector<std::iter_value_t<It>> buffer(std::make_move_iterator(first), std::make_move_iterator(last));
+	sort(buffer.begin(), buffer.end());
+	std::move(buffer.begin(), buffer.end(), first);
+}
+
+} // namespace ads
+
+#endif // ALGORITHMS_SORT_BUFFERED_SORT_H
\ No newline at end of file
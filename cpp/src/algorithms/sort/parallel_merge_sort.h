@@ -0,0 +1,139 @@
+#ifndef ALGORITHMS_SORT_PARALLEL_MERGE_SORT_H
+#define ALGORITHMS_SORT_PARALLEL_MERGE_SORT_H
+
+#include "pch.h"
+#include "algorithms/sort/buffered_sort.h"
+#include "algorithms/thread_pool.h"
+
+namespace ads {
+
+/* stable top-down merge sort that ping-pongs between the range and one buffer of the same length, both recursive halves and
+   the merges themselves are forked onto a ThreadPool until pieces drop below the grain, so the final merge isn't a serial bottleneck */
+template<std::random_access_iterator It, class Compare>
+class ParallelMergeSorter {
+public:
+	using value_type = std::iter_value_t<It>;
+	using BufferIterator = typename std::vector<value_type>::iterator;
+
+	static constexpr size_t insertionSortThreshold = 32;
+	static constexpr size_t minGrain = size_t(1) << 13;
+
+	ParallelMergeSorter(ThreadPool& pool, Compare& comp) : m_pool(pool), m_comp(comp), m_grain(minGrain) {}
+
+	void Sort(It first, It last) {
+		const size_t size = static_cast<size_t>(last - first);
+		if (size < 2)
+			return;
+		// a few pieces per thread so a slow thread doesn't hold up the rest
+		m_grain = std::max(minGrain, size / (8 * m_pool.ThreadCount()));
+		std::vector<value_type> buffer(size);
+		SortInPlace(first, last, buffer.begin());
+	}
+
+private:
+	// scratch is at least as long as the range and its contents are clobbered
+	void SortInPlace(It first, It last, BufferIterator scratch) {
+		const size_t size = static_cast<size_t>(last - first);
+		if (size <= insertionSortThreshold) {
+			InsertionSort(first, last);
+			return;
+		}
+		const size_t half = size / 2;
+		Fork(size,
+			[&]() { SortInto(first, first + half, scratch); },
+			[&]() { SortInto(first + half, last, scratch + half); });
+		Merge(scratch, scratch + half, scratch + half, scratch + size, first);
+	}
+
+	// leaves the sorted values in out, the range itself is used as scratch
+	void SortInto(It first, It last, BufferIterator out) {
+		const size_t size = static_cast<size_t>(last - first);
+		if (size <= insertionSortThreshold) {
+			InsertionSort(first, last);
+			std::move(first, last, out);
+			return;
+		}
+		const size_t half = size / 2;
+		Fork(size,
+			[&]() { SortInPlace(first, first + half, out); },
+			[&]() { SortInPlace(first + half, last, out + half); });
+		Merge(first, first + half, first + half, last, out);
+	}
+
+	// moves both sorted runs into out, ties take from the first run so the sort stays stable
+	template<class Src, class Dst>
+	void Merge(Src aFirst, Src aLast, Src bFirst, Src bLast, Dst out) {
+		const size_t aSize = static_cast<size_t>(aLast - aFirst);
+		const size_t bSize = static_cast<size_t>(bLast - bFirst);
+		if (aSize + bSize < m_grain || m_pool.ThreadCount() == 1) {
+			while (aFirst != aLast && bFirst != bLast)
+				*out++ = m_comp(*bFirst, *aFirst) ? std::move(*bFirst++) : std::move(*aFirst++);
+			out = std::move(aFirst, aLast, out);
+			std::move(bFirst, bLast, out);
+			return;
+		}
+
+		// split the longer run in the middle and binary search the matching split in the other, equal keys stay on the side that keeps a before b
+		Src aSplit;
+		Src bSplit;
+		if (aSize >= bSize) {
+			aSplit = aFirst + aSize / 2;
+			bSplit = std::lower_bound(bFirst, bLast, *aSplit, m_comp);
+		} else {
+			bSplit = bFirst + bSize / 2;
+			aSplit = std::upper_bound(aFirst, aLast, *bSplit, m_comp);
+		}
+		const Dst outSplit = out + ((aSplit - aFirst) + (bSplit - bFirst));
+		Fork(aSize + bSize,
+			[&]() { Merge(aFirst, aSplit, bFirst, bSplit, out); },
+			[&]() { Merge(aSplit, aLast, bSplit, bLast, outSplit); });
+	}
+
+	template<class Left, class Right>
+	void Fork(size_t size, Left&& left, Right&& right) {
+		if (size < m_grain || m_pool.ThreadCount() == 1) {
+			left();
+			right();
+			return;
+		}
+		TaskGroup group(m_pool);
+		group.Run(left);
+		right();
+		group.Wait();
+	}
+
+	void InsertionSort(It first, It last) {
+		for (It cur = first + (first != last); cur < last; ++cur) {
+			if (!m_comp(*cur, *(cur - 1)))
+				continue;
+			value_type tmp = std::move(*cur);
+			It sift = cur;
+			do {
+				*sift = std::move(*(sift - 1));
+				--sift;
+			} while (sift != first && m_comp(tmp, *(sift - 1)));
+			*sift = std::move(tmp);
+		}
+	}
+
+	ThreadPool& m_pool;
+	Compare& m_comp;
+	size_t m_grain;
+};
+
+
+// stable, allocates one buffer of last - first default constructed elements
+template<std::random_access_iterator It, class Compare = std::less<>>
+void ParallelMergeSort(It first, It last, ThreadPool& pool, Compare comp = {}) {
+	ParallelMergeSorter<It, Compare>(pool, comp).Sort(first, last);
+}
+
+// ranges that can't be indexed are sorted through a vector
+template<std::forward_iterator It, class Compare = std::less<>> requires (!std::random_access_iterator<It>)
+void ParallelMergeSort(It first, It last, ThreadPool& pool, Compare comp = {}) {
+	SortThroughBuffer(first, last, [&pool, &comp](auto bufferFirst, auto bufferLast) { ParallelMergeSort(bufferFirst, bufferLast, pool, comp); });
+}
+
+} // namespace ads
+
+#endif // ALGORITHMS_SORT_PARALLEL_MERGE_SORT_H
\ No newline at end of file
@@ -0,0 +1,350 @@
+/*
+	PdqSorter is an altered version of pdqsort.h from https://github.com/orlp/pdqsort, adapted to this library's naming
+	and iterator concepts; it is not the original software.
+
+	pdqsort.h - Pattern-defeating quicksort.
+
+	Copyright (c) 2021 Orson Peters
+
+	This software is provided 'as-is', without any express or implied warranty. In no event will the
+	authors be held liable for any damages arising from the use of this software.
+
+	Permission is granted to anyone to use this software for any purpose, including commercial
+	applications, and to alter it and redistribute it freely, subject to the following restrictions:
+
+	1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+	   original software. If you use this software in a product, an acknowledgment in the product
+	   documentation would be appreciated but is not required.
+
+	2. Altered source versions must be plainly marked as such, and must not be misrepresented as
+	   being the original software.
+
+	3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef ALGORITHMS_SORT_PDQ_SORT_H
+#define ALGORITHMS_SORT_PDQ_SORT_H
+
+#include "pch.h"
+#include "algorithms/sort/buffered_sort.h"
+
+namespace ads {
+
+/* pattern-defeating quicksort (Orson Peters, see the notice above): introsort that spots already partitioned ranges and finishes them with a bounded insertion sort,
+   shuffles around pivots that split badly and falls back to heapsort when that keeps happening, so it stays O(n log n) on any input;
+   arithmetic values under std::less or std::greater are partitioned in blocks without branching on the comparison (Edelkamp and Weiss) */
+template<std::random_access_iterator It, class Compare>
+class PdqSorter {
+public:
+	using value_type = std::iter_value_t<It>;
+
+	static constexpr std::ptrdiff_t insertionSortThreshold = 24;
+	static constexpr std::ptrdiff_t nintherThreshold = 128;
+	static constexpr std::ptrdiff_t partialInsertionSortLimit = 8;
+	static constexpr size_t blockSize = 64;
+
+	static constexpr bool branchless = std::is_arithmetic_v<value_type> &&
+		(std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<value_type>> ||
+		 std::is_same_v<Compare, std::greater<>> || std::is_same_v<Compare, std::greater<value_type>>);
+
+	static void Sort(It first, It last, Compare& comp) {
+		if (last - first < 2)
+			return;
+		Loop(first, last, comp, std::bit_width(static_cast<size_t>(last - first)), true);
+	}
+
+private:
+	static void InsertionSort(It first, It last, Compare& comp) {
+		if (first == last)
+			return;
+		for (It cur = first + 1; cur != last; ++cur) {
+			It sift = cur;
+			It prev = cur - 1;
+			if (comp(*sift, *prev)) {
+				value_type tmp = std::move(*sift);
+				do {
+					*sift-- = std::move(*prev);
+				} while (sift != first && comp(tmp, *--prev));
+				*sift = std::move(tmp);
+			}
+		}
+	}
+
+	// the element before first must not be greater than anything in the range, so the inner loop needs no bounds check
+	static void UnguardedInsertionSort(It first, It last, Compare& comp) {
+		if (first == last)
+			return;
+		for (It cur = first + 1; cur != last; ++cur) {
+			It sift = cur;
+			It prev = cur - 1;
+			if (comp(*sift, *prev)) {
+				value_type tmp = std::move(*sift);
+				do {
+					*sift-- = std::move(*prev);
+				} while (comp(tmp, *--prev));
+				*sift = std::move(tmp);
+			}
+		}
+	}
+
+	// gives up and returns false once more than partialInsertionSortLimit elements have been moved
+	static bool PartialInsertionSort(It first, It last, Compare& comp) {
+		if (first == last)
+			return true;
+		std::ptrdiff_t moved = 0;
+		for (It cur = first + 1; cur != last; ++cur) {
+			It sift = cur;
+			It prev = cur - 1;
+			if (comp(*sift, *prev)) {
+				value_type tmp = std::move(*sift);
+				do {
+					*sift-- = std::move(*prev);
+				} while (sift != first && comp(tmp, *--prev));
+				*sift = std::move(tmp);
+				moved += cur - sift;
+			}
+			if (moved > partialInsertionSortLimit)
+				return false;
+		}
+		return true;
+	}
+
+	static void Sort2(It a, It b, Compare& comp) {
+		if (comp(*b, *a))
+			std::iter_swap(a, b);
+	}
+
+	static void Sort3(It a, It b, It c, Compare& comp) {
+		Sort2(a, b, comp);
+		Sort2(b, c, comp);
+		Sort2(a, b, comp);
+	}
+
+	// moves num misplaced pairs across, a rotation through one temporary unless both sides had the same count
+	static void SwapOffsets(It first, It last, const unsigned char* offsetsLeft, const unsigned char* offsetsRight, size_t num, bool useSwaps) {
+		if (useSwaps) {
+			for (size_t i = 0; i < num; ++i)
+				std::iter_swap(first + offsetsLeft[i], last - offsetsRight[i]);
+		} else if (num > 0) {
+			It left = first + offsetsLeft[0];
+			It right = last - offsetsRight[0];
+			value_type tmp = std::move(*left);
+			*left = std::move(*right);
+			for (size_t i = 1; i < num; ++i) {
+				left = first + offsetsLeft[i];
+				*right = std::move(*left);
+				right = last - offsetsRight[i];
+				*left = std::move(*right);
+			}
+			*right = std::move(tmp);
+		}
+	}
+
+	// partitions around *first, elements equal to the pivot go right; also reports whether no element had to move
+	static std::pair<It, bool> PartitionRight(It begin, It end, Compare& comp) {
+		value_type pivot = std::move(*begin);
+		It first = begin;
+		It last = end;
+
+		// the median of three guarantees an element not less than the pivot exists, so the first scan needs no bounds check
+		while (comp(*++first, pivot));
+		if (first - 1 == begin)
+			while (first < last && !comp(*--last, pivot));
+		else
+			while (!comp(*--last, pivot));
+
+		const bool alreadyPartitioned = first >= last;
+		if constexpr (branchless) {
+			if (!alreadyPartitioned)
+				BlockPartition(first, last, pivot, comp);
+		} else {
+			while (first < last) {
+				std::iter_swap(first, last);
+				while (comp(*++first, pivot));
+				while (!comp(*--last, pivot));
+			}
+		}
+
+		const It pivotPos = first - 1;
+		*begin = std::move(*pivotPos);
+		*pivotPos = std::move(pivot);
+		return { pivotPos, alreadyPartitioned };
+	}
+
+	// first and last are the two elements on the wrong side found by the guarded scans, leaves first one past the left part
+	static void BlockPartition(It& first, It& last, const value_type& pivot, Compare& comp) {
+		std::iter_swap(first, last);
+		++first;
+
+		alignas(64) unsigned char offsetsLeft[blockSize];
+		alignas(64) unsigned char offsetsRight[blockSize];
+		It offsetsLeftBase = first;
+		It offsetsRightBase = last;
+		size_t numLeft = 0;
+		size_t numRight = 0;
+		size_t startLeft = 0;
+		size_t startRight = 0;
+
+		while (first < last) {
+			// only refill the side that ran out, split the unknown range evenly when both did
+			const size_t unknown = static_cast<size_t>(last - first);
+			const size_t leftSplit = numLeft == 0 ? (numRight == 0 ? unknown / 2 : unknown) : 0;
+			const size_t rightSplit = numRight == 0 ? unknown - leftSplit : 0;
+
+			// record the offset of every element unconditionally and only advance the count when it is misplaced
+			const size_t leftCount = std::min(leftSplit, blockSize);
+			for (size_t i = 0; i < leftCount; ++i) {
+				offsetsLeft[numLeft] = static_cast<unsigned char>(i);
+				numLeft += !comp(*first, pivot);
+				++first;
+			}
+			const size_t rightCount = std::min(rightSplit, blockSize);
+			for (size_t i = 0; i < rightCount;) {
+				offsetsRight[numRight] = static_cast<unsigned char>(++i);
+				numRight += comp(*--last, pivot);
+			}
+
+			const size_t num = std::min(numLeft, numRight);
+			SwapOffsets(offsetsLeftBase, offsetsRightBase, offsetsLeft + startLeft, offsetsRight + startRight, num, numLeft == numRight);
+			numLeft -= num;
+			numRight -= num;
+			startLeft += num;
+			startRight += num;
+			if (numLeft == 0) {
+				startLeft = 0;
+				offsetsLeftBase = first;
+			}
+			if (numRight == 0) {
+				startRight = 0;
+				offsetsRightBase = last;
+			}
+		}
+
+		// one side still has misplaced elements, swap them into the boundary
+		if (numLeft != 0) {
+			const unsigned char* offsets = offsetsLeft + startLeft;
+			while (numLeft--)
+				std::iter_swap(offsetsLeftBase + offsets[numLeft], --last);
+			first = last;
+		}
+		if (numRight != 0) {
+			const unsigned char* offsets = offsetsRight + startRight;
+			while (numRight--)
+				std::iter_swap(offsetsRightBase - offsets[numRight], first++);
+			last = first;
+		}
+	}
+
+	// used when the pivot equals the element before the range, puts everything equal to it left and returns the pivot's position
+	static It PartitionLeft(It begin, It end, Compare& comp) {
+		value_type pivot = std::move(*begin);
+		It first = begin;
+		It last = end;
+
+		while (comp(pivot, *--last));
+		if (last + 1 == end)
+			while (first < last && !comp(pivot, *++first));
+		else
+			while (!comp(pivot, *++first));
+
+		while (first < last) {
+			std::iter_swap(first, last);
+			while (comp(pivot, *--last));
+			while (!comp(pivot, *++first));
+		}
+
+		const It pivotPos = last;
+		*begin = std::move(*pivotPos);
+		*pivotPos = std::move(pivot);
+		return pivotPos;
+	}
+
+	// recurses into the left part and loops on the right, badAllowed counts down the unbalanced partitions tolerated before heapsort
+	static void Loop(It begin, It end, Compare& comp, int badAllowed, bool leftmost) {
+		while (true) {
+			const std::ptrdiff_t size = end - begin;
+			if (size < insertionSortThreshold) {
+				if (leftmost)
+					InsertionSort(begin, end, comp);
+				else
+					UnguardedInsertionSort(begin, end, comp);
+				return;
+			}
+
+			// median of three, or Tukey's ninther for big ranges, moved to begin
+			const std::ptrdiff_t half = size / 2;
+			if (size > nintherThreshold) {
+				Sort3(begin, begin + half, end - 1, comp);
+				Sort3(begin + 1, begin + (half - 1), end - 2, comp);
+				Sort3(begin + 2, begin + (half + 1), end - 3, comp);
+				Sort3(begin + (half - 1), begin + half, begin + (half + 1), comp);
+				std::iter_swap(begin, begin + half);
+			} else {
+				Sort3(begin + half, begin, end - 1, comp);
+			}
+
+			// a pivot equal to the previous range's pivot means this range is full of equal elements, skip them all in one go
+			if (!leftmost && !comp(*(begin - 1), *begin)) {
+				begin = PartitionLeft(begin, end, comp) + 1;
+				continue;
+			}
+
+			const auto [pivotPos, alreadyPartitioned] = PartitionRight(begin, end, comp);
+			const std::ptrdiff_t leftSize = pivotPos - begin;
+			const std::ptrdiff_t rightSize = end - (pivotPos + 1);
+
+			if (leftSize < size / 8 || rightSize < size / 8) {
+				if (--badAllowed == 0) {
+					std::make_heap(begin, end, comp);
+					std::sort_heap(begin, end, comp);
+					return;
+				}
+				// break up whatever pattern produced the bad pivot
+				if (leftSize >= insertionSortThreshold) {
+					std::iter_swap(begin, begin + leftSize / 4);
+					std::iter_swap(pivotPos - 1, pivotPos - leftSize / 4);
+					if (leftSize > nintherThreshold) {
+						std::iter_swap(begin + 1, begin + (leftSize / 4 + 1));
+						std::iter_swap(begin + 2, begin + (leftSize / 4 + 2));
+						std::iter_swap(pivotPos - 2, pivotPos - (leftSize / 4 + 1));
+						std::iter_swap(pivotPos - 3, pivotPos - (leftSize / 4 + 2));
+					}
+				}
+				if (rightSize >= insertionSortThreshold) {
+					std::iter_swap(pivotPos + 1, pivotPos + (1 + rightSize / 4));
+					std::iter_swap(end - 1, end - rightSize / 4);
+					if (rightSize > nintherThreshold) {
+						std::iter_swap(pivotPos + 2, pivotPos + (2 + rightSize / 4));
+						std::iter_swap(pivotPos + 3, pivotPos + (3 + rightSize / 4));
+						std::iter_swap(end - 2, end - (1 + rightSize / 4));
+						std::iter_swap(end - 3, end - (2 + rightSize / 4));
+					}
+				}
+			} else if (alreadyPartitioned && PartialInsertionSort(begin, pivotPos, comp) && PartialInsertionSort(pivotPos + 1, end, comp)) {
+				// nothing moved during partitioning and both sides turned out nearly sorted
+				return;
+			}
+
+			Loop(begin, pivotPos, comp, badAllowed, leftmost);
+			begin = pivotPos + 1;
+			leftmost = false;
+		}
+	}
+};
+
+
+// not stable, sorts in place without allocating
+template<std::random_access_iterator It, class Compare = std::less<>>
+void PdqSort(It first, It last, Compare comp = {}) {
+	PdqSorter<It, Compare>::Sort(first, last, comp);
+}
+
+// ranges that can't be indexed are sorted through a vector
+template<std::forward_iterator It, class Compare = std::less<>> requires (!std::random_access_iterator<It>)
+void PdqSort(It first, It last, Compare comp = {}) {
+	SortThroughBuffer(first, last, [&comp](auto bufferFirst, auto bufferLast) { PdqSort(bufferFirst, bufferLast, comp); });
+}
+
+} // namespace ads
+
+#endif // ALGORITHMS_SORT_PDQ_SORT_H
\ No newline at end of file
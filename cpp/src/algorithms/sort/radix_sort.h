@@ -0,0 +1,108 @@
+#ifndef ALGORITHMS_SORT_RADIX_SORT_H
+#define ALGORITHMS_SORT_RADIX_SORT_H
+
+#include "pch.h"
+#include "algorithms/sort/buffered_sort.h"
+
+namespace ads {
+
+template<size_t Bytes>
+using UnsignedOfSize = std::conditional_t<Bytes == 1, uint8_t, std::conditional_t<Bytes == 2, uint16_t, std::conditional_t<Bytes == 4, uint32_t, uint64_t>>>;
+
+// order preserving map from an integer or floating point key to an unsigned integer of the same width, so keys can be sorted digit by digit
+template<class Key>
+auto RadixKeyBits(Key key) {
+	static_assert(std::is_arithmetic_v<Key> && !std::is_same_v<Key, bool> && sizeof(Key) <= 8, "radix keys are integers or floats of at most 64 bits");
+	using Bits = UnsignedOfSize<sizeof(Key)>;
+	constexpr Bits signBit = static_cast<Bits>(Bits(1) << (sizeof(Bits) * 8 - 1));
+
+	if constexpr (std::is_floating_point_v<Key>) {
+		static_assert(sizeof(Key) == 4 || sizeof(Key) == 8, "only binary32 and binary64 floats are supported");
+		const Bits bits = std::bit_cast<Bits>(key);
+		// negatives order backwards by magnitude so every bit of those flips, positives only need the sign bit set
+		const Bits mask = static_cast<Bits>(static_cast<Bits>(0 - (bits >> (sizeof(Bits) * 8 - 1))) | signBit);
+		return static_cast<Bits>(bits ^ mask);
+	} else if constexpr (std::is_signed_v<Key>) {
+		return static_cast<Bits>(static_cast<Bits>(key) ^ signBit);
+	} else {
+		return static_cast<Bits>(key);
+	}
+}
+
+
+inline constexpr size_t radixSortInsertionThreshold = 64;
+
+/* stable LSD radix sort on 8 bit digits, keyFn maps an element to an integer or floating point key; needs a buffer of size default constructed elements
+   and skips the pass for any digit all keys share, so small keys in wide types only pay for the digits they use */
+template<std::random_access_iterator It, class KeyFn = std::identity>
+void RadixSort(It first, It last, KeyFn keyFn = {}) {
+	using T = std::iter_value_t<It>;
+	using Key = std::remove_cvref_t<std::invoke_result_t<KeyFn&, std::iter_reference_t<It>>>;
+	using Bits = decltype(RadixKeyBits(std::declval<Key>()));
+	constexpr size_t digitCount = sizeof(Bits);
+
+	const size_t size = static_cast<size_t>(last - first);
+	const auto bitsOf = [&keyFn](auto& val) { return RadixKeyBits(static_cast<Key>(keyFn(val))); };
+
+	if (size < radixSortInsertionThreshold) {
+		for (It cur = first + (size != 0); cur < last; ++cur) {
+			const Bits bits = bitsOf(*cur);
+			if (bits >= bitsOf(*(cur - 1)))
+				continue;
+			T tmp = std::move(*cur);
+			It sift = cur;
+			do {
+				*sift = std::move(*(sift - 1));
+				--sift;
+			} while (sift != first && bits < bitsOf(*(sift - 1)));
+			*sift = std::move(tmp);
+		}
+		return;
+	}
+
+	// one read of the input builds the histogram of every digit
+	std::array<std::array<size_t, 256>, digitCount> counts{};
+	for (It it = first; it != last; ++it) {
+		const Bits bits = bitsOf(*it);
+		for (size_t digit = 0; digit < digitCount; ++digit)
+			++counts[digit][(bits >> (digit * 8)) & 0xFF];
+	}
+
+	std::vector<T> buffer(size);
+	bool inBuffer = false;
+	const auto scatter = [&bitsOf](auto src, auto srcEnd, auto dst, size_t shift, std::array<size_t, 256>& offsets) {
+		for (; src != srcEnd; ++src)
+			dst[offsets[(bitsOf(*src) >> shift) & 0xFF]++] = std::move(*src);
+	};
+
+	for (size_t digit = 0; digit < digitCount; ++digit) {
+		std::array<size_t, 256>& count = counts[digit];
+		const size_t shift = digit * 8;
+		const size_t frontDigit = ((inBuffer ? bitsOf(buffer.front()) : bitsOf(*first)) >> shift) & 0xFF;
+		if (count[frontDigit] == size)
+			continue;
+
+		size_t offset = 0;
+		for (size_t& c : count)
+			offset += std::exchange(c, offset);
+
+		if (inBuffer)
+			scatter(buffer.begin(), buffer.end(), first, shift, count);
+		else
+			scatter(first, last, buffer.begin(), shift, count);
+		inBuffer = !inBuffer;
+	}
+
+	if (inBuffer)
+		std::move(buffer.begin(), buffer.end(), first);
+}
+
+// ranges that can't be indexed are sorted through a vector
+template<std::forward_iterator It, class KeyFn = std::identity> requires (!std::random_access_iterator<It>)
+void RadixSort(It first, It last, KeyFn keyFn = {}) {
+	SortThroughBuffer(first, last, [&keyFn](auto bufferFirst, auto bufferLast) { RadixSort(bufferFirst, bufferLast, keyFn); });
+}
+
+} // namespace ads
+
+#endif // ALGORITHMS_SORT_RADIX_SORT_H
\ No newline at end of file
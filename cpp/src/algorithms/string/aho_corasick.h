@@ -0,0 +1,265 @@
+#ifndef ALGORITHMS_STRING_AHO_CORASICK_H
+#define ALGORITHMS_STRING_AHO_CORASICK_H
+
+#include "pch.h"
+
+namespace ads {
+
+/* multi-pattern matcher (Aho and Corasick) laid out to stay in cache: bytes that appear in no pattern share one class, states are
+   numbered breadth first and only the shallowest ones, where a scan spends nearly all its time, get a full row of transitions in
+   a dense table of denseBytes; deeper states keep just their few edges plus a failure link; a flag bit on every transition says
+   whether the target state ends a pattern, so the scan loop never touches the output lists unless something matched */
+class AhoCorasick {
+public:
+	static constexpr size_t defaultDenseBytes = 128 * 1024;
+
+	// empty patterns never match, duplicates each report their own index
+	template<class Range>
+	explicit AhoCorasick(const Range& patterns, size_t denseBytes = defaultDenseBytes) {
+		std::vector<std::string_view> views;
+		for (const auto& pattern : patterns)
+			views.emplace_back(pattern);
+		Build(views, denseBytes);
+	}
+
+	AhoCorasick(std::initializer_list<std::string_view> patterns, size_t denseBytes = defaultDenseBytes) {
+		Build(std::vector<std::string_view>(patterns), denseBytes);
+	}
+
+	size_t PatternCount() const			{ return m_patternLengths.size(); }
+	size_t StateCount() const			{ return m_outputLink.size(); }
+	size_t DenseStateCount() const		{ return m_denseCount; }
+	size_t ClassCount() const			{ return m_classCount; }
+
+	// bytes of transition data the scan loop reads, the output lists only matter on a match
+	size_t AutomatonBytes() const {
+		return sizeof(m_classOf) + m_dense.size() * sizeof(uint32_t) + m_sparseStart.size() * sizeof(uint32_t)
+			+ m_edgeClasses.size() * sizeof(uint8_t) + m_edgeTargets.size() * sizeof(uint32_t) + m_sparseFail.size() * sizeof(uint32_t);
+	}
+
+	// onMatch(pattern, position) for every occurrence of every pattern, position is where the match starts
+	template<class Fn>
+	void FindAll(std::string_view text, Fn&& onMatch) const {
+		Scan(0, text, 0, onMatch);
+	}
+
+
+	/* scan position in a text fed chunk by chunk, the automaton state carries matches across chunk boundaries for free */
+	class Stream {
+	public:
+		explicit Stream(const AhoCorasick& automaton) : m_automaton(&automaton), m_state(0), m_consumed(0) {}
+
+		uint64_t Consumed() const { return m_consumed; }
+
+		// onMatch(pattern, position) for every match that ends inside chunk, positions count from the start of the stream
+		template<class Fn>
+		void Feed(std::string_view chunk, Fn&& onMatch) {
+			m_state = m_automaton->Scan(m_state, chunk, m_consumed, onMatch);
+			m_consumed += chunk.size();
+		}
+
+		void Reset() {
+			m_state = 0;
+			m_consumed = 0;
+		}
+
+	private:
+		const AhoCorasick* m_automaton;
+		uint32_t m_state;	// as a code
+		uint64_t m_consumed;
+	};
+
+private:
+	static constexpr uint32_t outputFlag = 0x80000000u;
+	static constexpr uint32_t stateMask = ~outputFlag;
+	static constexpr uint32_t none = 0xFFFFFFFFu;
+
+	struct TrieNode {
+		std::vector<std::pair<uint8_t, uint32_t>> edges;	// by class, sorted
+		std::vector<uint32_t> patterns;						// ending exactly here
+
+		uint32_t Child(uint8_t cls) const {
+			const auto it = std::lower_bound(edges.begin(), edges.end(), std::pair<uint8_t, uint32_t>(cls, 0));
+			return it != edges.end() && it->first == cls ? it->second : none;
+		}
+	};
+
+	void Build(const std::vector<std::string_view>& patterns, size_t denseBytes) {
+		// unused bytes share class 0 unless every byte value is used
+		bool used[256] = {};
+		for (std::string_view pattern : patterns) {
+			for (char c : pattern)
+				used[static_cast<unsigned char>(c)] = true;
+		}
+		const size_t usedCount = static_cast<size_t>(std::count(std::begin(used), std::end(used), true));
+		size_t nextClass = usedCount == 256 ? 0 : 1;
+		for (size_t b = 0; b < 256; ++b)
+			m_classOf[b] = used[b] ? static_cast<uint8_t>(nextClass++) : 0;
+		m_classCount = std::max<size_t>(nextClass, 1);
+
+		// plain trie first
+		std::vector<TrieNode> trie(1);
+		m_patternLengths.reserve(patterns.size());
+		for (size_t p = 0; p < patterns.size(); ++p) {
+			m_patternLengths.push_back(patterns[p].size());
+			if (patterns[p].empty())
+				continue;
+			uint32_t node = 0;
+			for (char c : patterns[p]) {
+				const uint8_t cls = m_classOf[static_cast<unsigned char>(c)];
+				uint32_t child = trie[node].Child(cls);
+				if (child == none) {
+					child = static_cast<uint32_t>(trie.size());
+					auto& edges = trie[node].edges;
+					edges.insert(std::lower_bound(edges.begin(), edges.end(), std::pair<uint8_t, uint32_t>(cls, 0)), { cls, child });
+					trie.emplace_back();
+				}
+				node = child;
+			}
+			trie[node].patterns.push_back(static_cast<uint32_t>(p));
+		}
+
+		// breadth first renumbering puts shallow states first, so the dense ones are a prefix and every failure link points backwards
+		std::vector<uint32_t> order;
+		std::vector<uint32_t> id(trie.size());
+		order.reserve(trie.size());
+		order.push_back(0);
+		for (size_t i = 0; i < order.size(); ++i) {
+			id[order[i]] = static_cast<uint32_t>(i);
+			for (const auto& edge : trie[order[i]].edges)
+				order.push_back(edge.second);
+		}
+		const size_t stateCount = order.size();
+
+		// failure links, output links to the nearest proper suffix state that ends a pattern, and the flattened output lists
+		std::vector<uint32_t> failLinks(stateCount, 0);
+		m_outputLink.assign(stateCount, none);
+		m_outputStart.assign(stateCount + 1, 0);
+		for (size_t s = 0; s < stateCount; ++s) {
+			const TrieNode& node = trie[order[s]];
+			m_outputStart[s] = static_cast<uint32_t>(m_outputs.size());
+			m_outputs.insert(m_outputs.end(), node.patterns.begin(), node.patterns.end());
+			for (const auto& [cls, child] : node.edges) {
+				uint32_t fail = 0;
+				if (s != 0) {
+					uint32_t f = failLinks[s];
+					while (f != 0 && trie[order[f]].Child(cls) == none)
+						f = failLinks[f];
+					const uint32_t target = trie[order[f]].Child(cls);
+					fail = target != none ? id[target] : 0;
+				}
+				const uint32_t t = id[child];
+				failLinks[t] = fail;
+				m_outputLink[t] = !trie[order[fail]].patterns.empty() ? fail : m_outputLink[fail];
+			}
+		}
+		m_outputStart[stateCount] = static_cast<uint32_t>(m_outputs.size());
+
+		// full rows for as many shallow states as fit, missing edges resolved through the failure link's row
+		m_denseCount = static_cast<uint32_t>(std::clamp<size_t>(denseBytes / (m_classCount * sizeof(uint32_t)), 1, stateCount));
+		m_denseLimit = static_cast<uint32_t>(m_denseCount * m_classCount);
+		m_dense.assign(m_denseLimit, 0);
+
+		const auto encode = [this](uint32_t target) {
+			const bool matches = m_outputStart[target] != m_outputStart[target + 1] || m_outputLink[target] != none;
+			return CodeOf(target) | (matches ? outputFlag : 0);
+		};
+		for (size_t s = 0; s < m_denseCount; ++s) {
+			const TrieNode& node = trie[order[s]];
+			for (size_t cls = 0; cls < m_classCount; ++cls) {
+				const uint32_t child = node.Child(static_cast<uint8_t>(cls));
+				if (child != none)
+					m_dense[s * m_classCount + cls] = encode(id[child]);
+				else
+					m_dense[s * m_classCount + cls] = s == 0 ? encode(0) : m_dense[CodeOf(failLinks[s]) + cls];
+			}
+		}
+
+		// the rest keep only their own edges
+		m_sparseStart.assign(stateCount - m_denseCount + 1, 0);
+		m_sparseFail.assign(stateCount - m_denseCount, 0);
+		for (size_t s = m_denseCount; s < stateCount; ++s) {
+			m_sparseStart[s - m_denseCount] = static_cast<uint32_t>(m_edgeTargets.size());
+			m_sparseFail[s - m_denseCount] = CodeOf(failLinks[s]);
+			for (const auto& [cls, child] : trie[order[s]].edges) {
+				m_edgeClasses.push_back(cls);
+				m_edgeTargets.push_back(encode(id[child]));
+			}
+		}
+		m_sparseStart.back() = static_cast<uint32_t>(m_edgeTargets.size());
+	}
+
+	// states are passed around as codes: a dense state's row offset, or denseLimit plus its index among the sparse states,
+	// which saves the scan loop a multiply per byte
+	uint32_t CodeOf(uint32_t state) const {
+		return state < m_denseCount ? static_cast<uint32_t>(state * m_classCount) : m_denseLimit + (state - m_denseCount);
+	}
+
+	uint32_t StateOf(uint32_t code) const {
+		return code < m_denseLimit ? static_cast<uint32_t>(code / m_classCount) : m_denseCount + (code - m_denseLimit);
+	}
+
+	template<class Fn>
+	uint32_t Scan(uint32_t code, std::string_view text, uint64_t offset, Fn& onMatch) const {
+		const uint32_t* dense = m_dense.data();
+		const uint32_t denseLimit = m_denseLimit;
+		for (size_t i = 0; i < text.size(); ++i) {
+			const uint8_t cls = m_classOf[static_cast<unsigned char>(text[i])];
+			uint32_t next;
+			while (true) {
+				if (code < denseLimit) {
+					next = dense[code + cls];
+					break;
+				}
+				// a sparse state without the edge falls back along its failure links until one has it or a dense row answers
+				const uint32_t sparse = code - denseLimit;
+				next = SparseNext(sparse, cls);
+				if (next != none)
+					break;
+				code = m_sparseFail[sparse];
+			}
+			code = next & stateMask;
+			if ((next & outputFlag) != 0)
+				Report(StateOf(code), offset + i + 1, onMatch);
+		}
+		return code;
+	}
+
+	uint32_t SparseNext(uint32_t sparse, uint8_t cls) const {
+		for (uint32_t e = m_sparseStart[sparse]; e != m_sparseStart[sparse + 1]; ++e) {
+			if (m_edgeClasses[e] == cls)
+				return m_edgeTargets[e];
+		}
+		return none;
+	}
+
+	// end is one past the last matched byte
+	template<class Fn>
+	void Report(uint32_t state, uint64_t end, Fn& onMatch) const {
+		for (uint32_t s = state; s != none; s = m_outputLink[s]) {
+			for (uint32_t o = m_outputStart[s]; o != m_outputStart[s + 1]; ++o)
+				onMatch(static_cast<size_t>(m_outputs[o]), end - m_patternLengths[m_outputs[o]]);
+		}
+	}
+
+	// hot, read for every byte
+	uint8_t m_classOf[256];
+	size_t m_classCount;
+	uint32_t m_denseCount;
+	uint32_t m_denseLimit;					// denseCount * classCount, codes below it are dense
+	std::vector<uint32_t> m_dense;			// denseCount rows of classCount target codes with the output flag
+	std::vector<uint32_t> m_sparseStart;	// edges of sparse state i are [start[i], start[i + 1])
+	std::vector<uint8_t> m_edgeClasses;
+	std::vector<uint32_t> m_edgeTargets;
+	std::vector<uint32_t> m_sparseFail;
+
+	// cold, only read on a match
+	std::vector<uint32_t> m_outputLink;
+	std::vector<uint32_t> m_outputStart;
+	std::vector<uint32_t> m_outputs;
+	std::vector<size_t> m_patternLengths;
+};
+
+} // namespace ads
+
+#endif // ALGORITHMS_STRING_AHO_CORASICK_H
\ No newline at end of file
@@ -0,0 +1,144 @@
+#ifndef ALGORITHMS_STRING_SUBSTRING_SEARCH_H
+#define ALGORITHMS_STRING_SUBSTRING_SEARCH_H
+
+#include "pch.h"
+#include "data_structures/simd.h"
+
+namespace ads {
+
+/* substring search that compares the needle's first and last byte against 32 (AVX2) or 16 (SSE2) candidate positions at once
+   and only runs memcmp on the middle where both matched (Mula); two bytes far apart rarely match together by chance, so on
+   text the verification almost never runs; builds without SIMD skip to candidates with memchr instead */
+class SubstringSearcher {
+public:
+	static constexpr size_t npos = std::string_view::npos;
+
+	// the needle is copied, the searcher doesn't depend on it staying alive
+	explicit SubstringSearcher(std::string_view needle) : m_needle(needle) {}
+
+	size_t NeedleSize() const { return m_needle.size(); }
+
+	// position of the first match starting at or after from, npos if there is none
+	size_t Find(std::string_view text, size_t from = 0) const {
+		const size_t m = m_needle.size();
+		const size_t n = text.size();
+		if (from > n || n - from < m)
+			return npos;
+		if (m == 0)
+			return from;
+
+		const char* s = text.data();
+		const char* needle = m_needle.data();
+		if (m == 1) {
+			const void* found = std::memchr(s + from, needle[0], n - from);
+			return found != nullptr ? static_cast<size_t>(static_cast<const char*>(found) - s) : npos;
+		}
+
+		// every start in [i, lastStart] is a candidate, a vector step needs its whole block of starts to be candidates
+		const size_t lastStart = n - m;
+		size_t i = from;
+#if defined(ADS_AVX2)
+		const __m256i first32 = _mm256_set1_epi8(needle[0]);
+		const __m256i last32 = _mm256_set1_epi8(needle[m - 1]);
+		for (; i + 32 <= lastStart + 1; i += 32) {
+			const __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+			const __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + m - 1));
+			uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first32), _mm256_cmpeq_epi8(blockLast, last32))));
+			while (mask != 0) {
+				const size_t candidate = i + static_cast<size_t>(std::countr_zero(mask));
+				if (std::memcmp(s + candidate + 1, needle + 1, m - 2) == 0)
+					return candidate;
+				mask &= mask - 1;
+			}
+		}
+#endif
+#if defined(ADS_SSE2)
+		const __m128i first16 = _mm_set1_epi8(needle[0]);
+		const __m128i last16 = _mm_set1_epi8(needle[m - 1]);
+		for (; i + 16 <= lastStart + 1; i += 16) {
+			const __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+			const __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + m - 1));
+			uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, first16), _mm_cmpeq_epi8(blockLast, last16))));
+			while (mask != 0) {
+				const size_t candidate = i + static_cast<size_t>(std::countr_zero(mask));
+				if (std::memcmp(s + candidate + 1, needle + 1, m - 2) == 0)
+					return candidate;
+				mask &= mask - 1;
+			}
+		}
+#endif
+
+		// fewer starts left than a vector covers, or no SIMD at all
+		while (i <= lastStart) {
+			const void* found = std::memchr(s + i, needle[0], lastStart + 1 - i);
+			if (found == nullptr)
+				return npos;
+			i = static_cast<size_t>(static_cast<const char*>(found) - s);
+			if (s[i + m - 1] == needle[m - 1] && std::memcmp(s + i + 1, needle + 1, m - 2) == 0)
+				return i;
+			++i;
+		}
+		return npos;
+	}
+
+private:
+	std::string m_needle;
+};
+
+
+/* feeds a text to a single pattern searcher chunk by chunk and reports every match, including the ones that straddle chunks,
+   with its position from the start of the stream; keeps the last NeedleSize() - 1 bytes seen so no chunk has to stay alive */
+template<class Searcher>
+class StreamingSearch {
+public:
+	explicit StreamingSearch(Searcher searcher) : m_searcher(std::move(searcher)), m_consumed(0) {}
+
+	const Searcher& GetSearcher() const	{ return m_searcher; }
+	uint64_t Consumed() const			{ return m_consumed; }
+
+	// onMatch(position) runs for every match that ends inside chunk, overlapping matches included; an empty needle never matches
+	template<class Fn>
+	void Feed(std::string_view chunk, Fn&& onMatch) {
+		const size_t m = m_searcher.NeedleSize();
+		if (m == 0) {
+			m_consumed += chunk.size();
+			return;
+		}
+
+		// the carried tail is shorter than the needle, so any match starting in it ends in this chunk
+		if (!m_tail.empty()) {
+			m_seam.assign(m_tail);
+			m_seam.append(chunk.substr(0, m - 1));
+			for (size_t pos = m_searcher.Find(m_seam, 0); pos != std::string_view::npos && pos < m_tail.size(); pos = m_searcher.Find(m_seam, pos + 1))
+				onMatch(m_consumed - m_tail.size() + pos);
+		}
+
+		for (size_t pos = m_searcher.Find(chunk, 0); pos != std::string_view::npos; pos = m_searcher.Find(chunk, pos + 1))
+			onMatch(m_consumed + pos);
+
+		if (chunk.size() >= m - 1) {
+			m_tail.assign(chunk.substr(chunk.size() - (m - 1)));
+		} else {
+			m_tail.append(chunk);
+			if (m_tail.size() > m - 1)
+				m_tail.erase(0, m_tail.size() - (m - 1));
+		}
+		m_consumed += chunk.size();
+	}
+
+	// forget everything fed so far, positions start from zero again
+	void Reset() {
+		m_tail.clear();
+		m_consumed = 0;
+	}
+
+private:
+	Searcher m_searcher;
+	std::string m_tail;
+	std::string m_seam;
+	uint64_t m_consumed;
+};
+
+} // namespace ads
+
+#endif // ALGORITHMS_STRING_SUBSTRING_SEARCH_H
\ No newline at end of file
@@ -0,0 +1,158 @@
+#ifndef ALGORITHMS_STRING_TWO_WAY_SEARCH_H
+#define ALGORITHMS_STRING_TWO_WAY_SEARCH_H
+
+#include "pch.h"
+
+namespace ads {
+
+/* Two-Way string matching (Crochemore and Perrin): the needle is split at a critical factorisation, the right part is matched
+   left to right and the left part right to left, and the shift after a mismatch comes from the needle's period; linear on any
+   input with constant extra memory, where the first and last byte filter can go quadratic on inputs like a^n. Like glibc, every
+   window first checks its last byte against a Horspool shift table, which skips most of a text the needle doesn't fit */
+class TwoWaySearcher {
+public:
+	static constexpr size_t npos = std::string_view::npos;
+
+	explicit TwoWaySearcher(std::string_view needle) : m_needle(needle), m_shift{}, m_criticalPos(-1), m_period(1), m_periodic(false) {
+		const std::ptrdiff_t m = static_cast<std::ptrdiff_t>(m_needle.size());
+		if (m == 0)
+			return;
+
+		// distance from a byte's last occurrence before the final position to the end, 0 for the final byte itself
+		m_shift.fill(static_cast<size_t>(m));
+		for (std::ptrdiff_t i = 0; i < m; ++i)
+			m_shift[static_cast<unsigned char>(m_needle[static_cast<size_t>(i)])] = static_cast<size_t>(m - 1 - i);
+
+		// the later of the two maximal suffixes, under < and under >, is a critical position
+		std::ptrdiff_t period = 1;
+		std::ptrdiff_t reversedPeriod = 1;
+		const std::ptrdiff_t suffix = MaximalSuffix(false, period);
+		const std::ptrdiff_t reversedSuffix = MaximalSuffix(true, reversedPeriod);
+		if (suffix > reversedSuffix) {
+			m_criticalPos = suffix;
+			m_period = period;
+		} else {
+			m_criticalPos = reversedSuffix;
+			m_period = reversedPeriod;
+		}
+
+		// the left part repeating one period later means the whole needle has that period
+		m_periodic = m_period < m && std::memcmp(m_needle.data(), m_needle.data() + m_period, static_cast<size_t>(m_criticalPos + 1)) == 0;
+		if (!m_periodic)
+			m_period = std::max(m_criticalPos + 1, m - m_criticalPos - 1) + 1;
+	}
+
+	size_t NeedleSize() const { return m_needle.size(); }
+
+	// position of the first match starting at or after from, npos if there is none
+	size_t Find(std::string_view text, size_t from = 0) const {
+		const size_t m = m_needle.size();
+		const size_t n = text.size();
+		if (from > n || n - from < m)
+			return npos;
+		if (m == 0)
+			return from;
+
+		const unsigned char* x = reinterpret_cast<const unsigned char*>(m_needle.data());
+		const unsigned char* y = reinterpret_cast<const unsigned char*>(text.data());
+		const std::ptrdiff_t needleSize = static_cast<std::ptrdiff_t>(m);
+		const std::ptrdiff_t lastStart = static_cast<std::ptrdiff_t>(n - m);
+		const std::ptrdiff_t ell = m_criticalPos;
+
+		std::ptrdiff_t j = static_cast<std::ptrdiff_t>(from);
+		if (m_periodic) {
+			// memory is how much of the left part the previous period shift already proved equal
+			std::ptrdiff_t memory = -1;
+			while (j <= lastStart) {
+				std::ptrdiff_t shift = static_cast<std::ptrdiff_t>(m_shift[y[j + needleSize - 1]]);
+				if (shift > 0) {
+					// a short shift would break what memory says about the window, fall back to the period shift
+					if (memory >= 0 && shift < m_period)
+						shift = needleSize - m_period;
+					memory = -1;
+					j += shift;
+					continue;
+				}
+				std::ptrdiff_t i = std::max(ell, memory) + 1;
+				while (i < needleSize && x[i] == y[i + j])
+					++i;
+				if (i < needleSize) {
+					j += i - ell;
+					memory = -1;
+					continue;
+				}
+				i = ell;
+				while (i > memory && x[i] == y[i + j])
+					--i;
+				if (i <= memory)
+					return static_cast<size_t>(j);
+				j += m_period;
+				memory = needleSize - m_period - 1;
+			}
+		} else {
+			while (j <= lastStart) {
+				const std::ptrdiff_t shift = static_cast<std::ptrdiff_t>(m_shift[y[j + needleSize - 1]]);
+				if (shift > 0) {
+					j += shift;
+					continue;
+				}
+				std::ptrdiff_t i = ell + 1;
+				while (i < needleSize && x[i] == y[i + j])
+					++i;
+				if (i < needleSize) {
+					j += i - ell;
+					continue;
+				}
+				i = ell;
+				while (i >= 0 && x[i] == y[i + j])
+					--i;
+				if (i < 0)
+					return static_cast<size_t>(j);
+				j += m_period;
+			}
+		}
+		return npos;
+	}
+
+private:
+	// start - 1 of the lexicographically largest suffix under < (or > when reversed), period is that suffix's period
+	std::ptrdiff_t MaximalSuffix(bool reversed, std::ptrdiff_t& period) const {
+		const unsigned char* x = reinterpret_cast<const unsigned char*>(m_needle.data());
+		const std::ptrdiff_t m = static_cast<std::ptrdiff_t>(m_needle.size());
+		std::ptrdiff_t suffix = -1;
+		std::ptrdiff_t j = 0;
+		std::ptrdiff_t k = 1;
+		period = 1;
+		while (j + k < m) {
+			const unsigned char a = x[j + k];
+			const unsigned char b = x[suffix + k];
+			if (reversed ? a > b : a < b) {
+				j += k;
+				k = 1;
+				period = j - suffix;
+			} else if (a == b) {
+				if (k != period) {
+					++k;
+				} else {
+					j += period;
+					k = 1;
+				}
+			} else {
+				suffix = j;
+				j = suffix + 1;
+				k = period = 1;
+			}
+		}
+		return suffix;
+	}
+
+	std::string m_needle;
+	std::array<size_t, 256> m_shift;
+	std::ptrdiff_t m_criticalPos;	// last index of the left part, -1 when it is empty
+	std::ptrdiff_t m_period;		// the needle's period when periodic, otherwise the safe shift after a full match
+	bool m_periodic;
+};
+
+} // namespace ads
+
+#endif // ALGORITHMS_STRING_TWO_WAY_SEARCH_H
\ No newline at end of file
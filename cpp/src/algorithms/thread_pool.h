@@ -0,0 +1,200 @@
+#ifndef ALGORITHMS_THREAD_POOL_H
+#define ALGORITHMS_THREAD_POOL_H
+
+#include "pch.h"
+#include "data_structures/cache_line.h"
+
+namespace ads {
+
+/* work-stealing pool: each worker pushes and pops tasks at the back of its own deque and, when that runs dry, steals the oldest task from
+   the front of another one, threads outside the pool feed a shared injection deque; the thread that waits on a TaskGroup counts as one of the threads */
+class ThreadPool {
+public:
+	// threadCount includes the caller, so a pool of 1 starts no workers and runs everything inside TaskGroup::Wait
+	explicit ThreadPool(unsigned threadCount = std::thread::hardware_concurrency()) : m_threadCount(std::max(1u, threadCount)), m_queues(m_threadCount),
+		m_queued(0), m_sleeping(0), m_stopping(false) {
+		m_workers.reserve(m_threadCount - 1);
+		for (unsigned i = 1; i < m_threadCount; ++i)
+			m_workers.emplace_back([this, i]() { WorkerLoop(i); });
+	}
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	// queued tasks that nobody waited for are dropped
+	~ThreadPool() {
+		{
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+			m_stopping.store(true);
+		}
+		m_wake.notify_all();
+		for (std::thread& worker : m_workers)
+			worker.join();
+	}
+
+	unsigned ThreadCount() const { return m_threadCount; }
+
+	void Submit(std::function<void()> task) {
+		// counted before the push so the count never dips below zero, and ordered against the sleeping count a worker publishes
+		// before it checks m_queued, one of the two sides always sees the other
+		m_queued.fetch_add(1);
+		Queue& queue = m_queues[QueueIndex()];
+		{
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			queue.tasks.push_back(std::move(task));
+		}
+		if (m_sleeping.load() != 0) {
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+			m_wake.notify_one();
+		}
+	}
+
+	// runs one queued task on the calling thread, own deque first and then stolen, returns false if every deque was empty
+	bool TryRunOne() {
+		const unsigned self = QueueIndex();
+		std::function<void()> task;
+		if (!PopBack(self, task) && !Steal(self, task))
+			return false;
+		task();
+		return true;
+	}
+
+private:
+	struct alignas(cacheLineSize) Queue {
+		std::mutex mutex;
+		std::deque<std::function<void()>> tasks;
+	};
+
+
+	// workers own queue 1..n-1, every other thread shares the injection queue 0
+	unsigned QueueIndex() const {
+		return t_pool == this ? t_queueIndex : 0;
+	}
+
+	// newest first, the task this thread just spawned is the one most likely to still be in cache
+	bool PopBack(unsigned index, std::function<void()>& task) {
+		Queue& queue = m_queues[index];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.tasks.empty())
+			return false;
+		task = std::move(queue.tasks.back());
+		queue.tasks.pop_back();
+		m_queued.fetch_sub(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	// thieves take the oldest, which for divide and conquer is the biggest piece of work
+	bool Steal(unsigned self, std::function<void()>& task) {
+		for (unsigned i = 1; i < m_threadCount; ++i) {
+			Queue& queue = m_queues[(self + i) % m_threadCount];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (queue.tasks.empty())
+				continue;
+			task = std::move(queue.tasks.front());
+			queue.tasks.pop_front();
+			m_queued.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+		return false;
+	}
+
+	void WorkerLoop(unsigned index) {
+		t_pool = this;
+		t_queueIndex = index;
+		while (!m_stopping.load(std::memory_order_relaxed)) {
+			if (TryRunOne())
+				continue;
+			std::unique_lock<std::mutex> lock(m_sleepMutex);
+			m_sleeping.fetch_add(1);
+			m_wake.wait(lock, [this]() { return m_stopping.load() || m_queued.load() != 0; });
+			m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	static inline thread_local const ThreadPool* t_pool = nullptr;
+	static inline thread_local unsigned t_queueIndex = 0;
+
+	const unsigned m_threadCount;
+	std::vector<std::thread> m_workers;
+	std::vector<Queue> m_queues;
+	alignas(cacheLineSize) std::atomic<size_t> m_queued;	// tasks sitting in any deque
+	std::atomic<unsigned> m_sleeping;
+	std::atomic<bool> m_stopping;
+	std::mutex m_sleepMutex;
+	std::condition_variable m_wake;
+};
+
+
+/* fork-join scope over a ThreadPool, Wait runs queued tasks itself instead of blocking so nested groups can't deadlock the pool */
+class TaskGroup {
+public:
+	explicit TaskGroup(ThreadPool& pool) : m_pool(pool), m_pending(0) {}
+
+	TaskGroup(const TaskGroup&) = delete;
+	TaskGroup& operator=(const TaskGroup&) = delete;
+
+	~TaskGroup() {
+		WaitNoThrow();
+	}
+
+	template<class Fn>
+	void Run(Fn&& fn) {
+		m_pending.fetch_add(1, std::memory_order_relaxed);
+		m_pool.Submit([this, fn = std::forward<Fn>(fn)]() mutable {
+			try {
+				fn();
+			} catch (...) {
+				std::lock_guard<std::mutex> lock(m_errorMutex);
+				if (!m_error)
+					m_error = std::current_exception();
+			}
+			m_pending.fetch_sub(1, std::memory_order_release);
+		});
+	}
+
+	// rethrows the first exception any task threw
+	void Wait() {
+		WaitNoThrow();
+		if (m_error) {
+			std::exception_ptr error = std::exchange(m_error, nullptr);
+			std::rethrow_exception(error);
+		}
+	}
+
+private:
+	void WaitNoThrow() {
+		while (m_pending.load(std::memory_order_acquire) != 0) {
+			if (!m_pool.TryRunOne())
+				std::this_thread::yield();
+		}
+	}
+
+	ThreadPool& m_pool;
+	std::atomic<size_t> m_pending;
+	std::mutex m_errorMutex;
+	std::exception_ptr m_error;
+};
+
+
+// calls fn(first, last) on pieces of [begin, end) no longer than grain, the range is halved recursively so thieves pick up the biggest halves first
+template<class Fn>
+void ParallelFor(ThreadPool& pool, size_t begin, size_t end, size_t grain, const Fn& fn) {
+	grain = std::max<size_t>(grain, 1);
+	if (end - begin <= grain || pool.ThreadCount() == 1) {
+		if (begin < end)
+			fn(begin, end);
+		return;
+	}
+	TaskGroup group(pool);
+	while (end - begin > grain) {
+		const size_t mid = begin + (end - begin) / 2;
+		group.Run([&pool, mid, end, grain, &fn]() { ParallelFor(pool, mid, end, grain, fn); });
+		end = mid;
+	}
+	fn(begin, end);
+	group.Wait();
+}
+
+} // namespace ads
+
+#endif // ALGORITHMS_THREAD_POOL_H
\ No newline at end of file
@@ -0,0 +1,98 @@
+#ifndef BENCHMARKS_ALLOCATION_COUNTER_H
+#define BENCHMARKS_ALLOCATION_COUNTER_H
+
+#include "pch.h"
+
+// replaces the global operator new/delete so the benchmarks can report allocations per operation,
+// include from exactly one translation unit (the benchmark entry point)
+
+struct AllocationCounters {
+	std::atomic<uint64_t> allocations = 0;
+	std::atomic<uint64_t> frees = 0;
+	std::atomic<uint64_t> bytes = 0;
+};
+
+inline AllocationCounters g_allocationCounters;
+
+struct AllocationSnapshot {
+	uint64_t allocations;
+	uint64_t frees;
+	uint64_t bytes;
+
+	static AllocationSnapshot Take() {
+		return {
+			g_allocationCounters.allocations.load(std::memory_order_relaxed),
+			g_allocationCounters.frees.load(std::memory_order_relaxed),
+			g_allocationCounters.bytes.load(std::memory_order_relaxed)
+		};
+	}
+
+	AllocationSnapshot operator-(const AllocationSnapshot& other) const {
+		return { allocations - other.allocations, frees - other.frees, bytes - other.bytes };
+	}
+};
+
+// the replacements live in the same translation unit as their callers, and once gcc inlines a delete it pairs the free
+// inside with the operator new call and warns about a mismatch, kept out of line they pair up as new and delete
+#if defined(_MSC_VER)
+	#define ALLOCATION_COUNTER_NOINLINE __declspec(noinline)
+#else
+	#define ALLOCATION_COUNTER_NOINLINE __attribute__((noinline))
+#endif
+
+void* operator new(std::size_t size) {
+	g_allocationCounters.allocations.fetch_add(1, std::memory_order_relaxed);
+	g_allocationCounters.bytes.fetch_add(size, std::memory_order_relaxed);
+	if (void* p = std::malloc(size != 0 ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+	g_allocationCounters.allocations.fetch_add(1, std::memory_order_relaxed);
+	g_allocationCounters.bytes.fetch_add(size, std::memory_order_relaxed);
+	const size_t alignment = static_cast<size_t>(align);
+#if defined(_WIN32)
+	void* p = _aligned_malloc(size != 0 ? size : 1, alignment);
+#else
+	// aligned_alloc wants the size to be a multiple of the alignment
+	void* p = std::aligned_alloc(alignment, (std::max<size_t>(size, 1) + alignment - 1) / alignment * alignment);
+#endif
+	if (p != nullptr)
+		return p;
+	throw std::bad_alloc();
+}
+
+ALLOCATION_COUNTER_NOINLINE void operator delete(void* p) noexcept {
+	if (p != nullptr)
+		g_allocationCounters.frees.fetch_add(1, std::memory_order_relaxed);
+	std::free(p);
+}
+
+ALLOCATION_COUNTER_NOINLINE void operator delete(void* p, std::size_t) noexcept {
+	if (p != nullptr)
+		g_allocationCounters.frees.fetch_add(1, std::memory_order_relaxed);
+	std::free(p);
+}
+
+ALLOCATION_COUNTER_NOINLINE void operator delete(void* p, std::align_val_t) noexcept {
+	if (p != nullptr)
+		g_allocationCounters.frees.fetch_add(1, std::memory_order_relaxed);
+#if defined(_WIN32)
+	_aligned_free(p);
+#else
+	std::free(p);
+#endif
+}
+
+ALLOCATION_COUNTER_NOINLINE void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+	if (p != nullptr)
+		g_allocationCounters.frees.fetch_add(1, std::memory_order_relaxed);
+#if defined(_WIN32)
+	_aligned_free(p);
+#else
+	std::free(p);
+#endif
+}
+
+#endif // BENCHMARKS_ALLOCATION_COUNTER_H
\ No newline at end of file
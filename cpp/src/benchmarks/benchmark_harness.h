@@ -0,0 +1,161 @@
+#ifndef BENCHMARKS_BENCHMARK_HARNESS_H
+#define BENCHMARKS_BENCHMARK_HARNESS_H
+
+#include "pch.h"
+#include "benchmarks/allocation_counter.h"
+
+/* one measured operation, all per-op figures are averaged over ops */
+struct BenchmarkResult {
+	std::string container;
+	std::string operation;
+	size_t size;
+	uint64_t ops;
+	double nsPerOp;
+	double allocationsPerOp;
+	double freesPerOp;
+	double bytesPerOp;
+};
+
+/* command line options shared by every benchmark suite */
+struct BenchmarkOptions {
+	enum class Format {
+		Table,
+		Csv,
+		Json
+	};
+
+	Format format = Format::Table;
+	size_t minSize = 10;
+	size_t maxSize = 10000000;
+	size_t elementsPerSize = 2000000;	// repetitions are picked so every size processes about this many elements
+	unsigned maxThreads = std::max(2u, std::thread::hardware_concurrency());
+	std::string filter;					// only run suites/containers whose name contains this
+	std::string outputPath;				// write the report here instead of stdout
+
+	// --format=table|csv|json --min-size=N --max-size=N --elements=N --threads=N --filter=name --output=path
+	static BenchmarkOptions Parse(int argc, char* argv[]) {
+		BenchmarkOptions options;
+		for (int i = 1; i < argc; ++i) {
+			const std::string arg = argv[i];
+			const size_t eq = arg.find('=');
+			const std::string key = arg.substr(0, eq);
+			const std::string value = eq != std::string::npos ? arg.substr(eq + 1) : std::string();
+			if (key == "--format")
+				options.format = value == "csv" ? Format::Csv : value == "json" ? Format::Json : Format::Table;
+			else if (key == "--min-size")
+				options.minSize = std::stoull(value);
+			else if (key == "--max-size")
+				options.maxSize = std::stoull(value);
+			else if (key == "--elements")
+				options.elementsPerSize = std::stoull(value);
+			else if (key == "--threads")
+				options.maxThreads = static_cast<unsigned>(std::stoul(value));
+			else if (key == "--filter")
+				options.filter = value;
+			else if (key == "--output")
+				options.outputPath = value;
+			else
+				std::cerr << "unknown benchmark option " << arg << std::endl;
+		}
+		return options;
+	}
+
+	bool IsSelected(const std::string& name) const {
+		return filter.empty() || name.find(filter) != std::string::npos;
+	}
+
+	// decade steps from minSize to maxSize
+	std::vector<size_t> Sizes() const {
+		std::vector<size_t> sizes;
+		for (size_t size = minSize; size <= maxSize; size *= 10)
+			sizes.push_back(size);
+		return sizes;
+	}
+
+	size_t RepetitionsFor(size_t size) const {
+		return std::max<size_t>(1, elementsPerSize / size);
+	}
+};
+
+
+/* collects results and writes them as an aligned table, csv or json */
+class BenchmarkReport {
+public:
+	explicit BenchmarkReport(std::ostream* pProgress = nullptr) : m_pProgress(pProgress) {}
+
+	const std::vector<BenchmarkResult>& Results() const { return m_results; }
+
+	void Add(const BenchmarkResult& result) {
+		m_results.push_back(result);
+		if (m_pProgress != nullptr)
+			*m_pProgress << result.container << " " << result.operation << " " << result.size << ": " << result.nsPerOp << " ns/op" << std::endl;
+	}
+
+	void Write(std::ostream& os, BenchmarkOptions::Format format) const {
+		switch (format) {
+		case BenchmarkOptions::Format::Csv:
+			os << "container,operation,size,ops,ns_per_op,allocations_per_op,frees_per_op,bytes_per_op\n";
+			for (const BenchmarkResult& r : m_results) {
+				os << r.container << "," << r.operation << "," << r.size << "," << r.ops << "," << r.nsPerOp << ","
+					<< r.allocationsPerOp << "," << r.freesPerOp << "," << r.bytesPerOp << "\n";
+			}
+			break;
+		case BenchmarkOptions::Format::Json:
+			os << "[\n";
+			for (size_t i = 0; i < m_results.size(); ++i) {
+				const BenchmarkResult& r = m_results[i];
+				os << "  {\"container\": \"" << r.container << "\", \"operation\": \"" << r.operation << "\", \"size\": " << r.size
+					<< ", \"ops\": " << r.ops << ", \"ns_per_op\": " << r.nsPerOp << ", \"allocations_per_op\": " << r.allocationsPerOp
+					<< ", \"frees_per_op\": " << r.freesPerOp << ", \"bytes_per_op\": " << r.bytesPerOp << "}" << (i + 1 < m_results.size() ? ",\n" : "\n");
+			}
+			os << "]\n";
+			break;
+		default:
+			os << std::left << std::setw(28) << "container" << std::setw(22) << "operation" << std::right << std::setw(10) << "size"
+				<< std::setw(12) << "ns/op" << std::setw(12) << "allocs/op" << std::setw(12) << "frees/op" << std::setw(12) << "bytes/op" << "\n";
+			for (const BenchmarkResult& r : m_results) {
+				os << std::left << std::setw(28) << r.container << std::setw(22) << r.operation << std::right << std::setw(10) << r.size
+					<< std::fixed << std::setprecision(2) << std::setw(12) << r.nsPerOp << std::setw(12) << r.allocationsPerOp
+					<< std::setw(12) << r.freesPerOp << std::setw(12) << r.bytesPerOp << std::defaultfloat << "\n";
+			}
+			break;
+		}
+	}
+
+private:
+	std::ostream* m_pProgress;
+	std::vector<BenchmarkResult> m_results;
+};
+
+
+// keeps a computed value alive so the optimiser can't drop the loop that produced it
+inline volatile uint64_t g_benchmarkSink;
+
+template<class T>
+void KeepAlive(const T& val) {
+	g_benchmarkSink = static_cast<uint64_t>(val);
+}
+
+// nearest rank percentile of sorted samples
+inline double LatencyPercentile(const std::vector<int64_t>& sorted, double percentile) {
+	if (sorted.empty())
+		return 0.0;
+	const size_t rank = static_cast<size_t>(percentile / 100.0 * static_cast<double>(sorted.size() - 1) + 0.5);
+	return static_cast<double>(sorted[rank]);
+}
+
+// runs fn once, which must perform ops operations, and records time and allocations per op
+template<class Fn>
+void Measure(BenchmarkReport& report, const std::string& container, const std::string& operation, size_t size, uint64_t ops, Fn&& fn) {
+	const AllocationSnapshot before = AllocationSnapshot::Take();
+	const auto begin = std::chrono::steady_clock::now();
+	fn();
+	const auto end = std::chrono::steady_clock::now();
+	const AllocationSnapshot delta = AllocationSnapshot::Take() - before;
+
+	const double count = static_cast<double>(std::max<uint64_t>(ops, 1));
+	report.Add({ container, operation, size, ops, std::chrono::duration<double, std::nano>(end - begin).count() / count,
+		delta.allocations / count, delta.frees / count, delta.bytes / count });
+}
+
+#endif // BENCHMARKS_BENCHMARK_HARNESS_H
\ No newline at end of file
@@ -0,0 +1,136 @@
+#ifndef BENCHMARKS_BTREE_MAP_BENCHMARKS_H
+#define BENCHMARKS_BTREE_MAP_BENCHMARKS_H
+
+#include "pch.h"
+#include "benchmarks/benchmark_harness.h"
+#include "data_structures/btree_map.h"
+
+using TimestampEntry = std::pair<uint64_t, uint64_t>;
+
+/* common surface over the ordered maps, a sorted vector is the read only baseline */
+template<size_t NodeBytes>
+struct BTreeMapBench {
+	using Map = ads::BTreeMap<uint64_t, uint64_t, NodeBytes>;
+	static constexpr bool canInsert = true;
+
+	static void Load(Map& map, const std::vector<TimestampEntry>& sorted)	{ map.BulkLoad(sorted.begin(), sorted.end()); }
+	static void Insert(Map& map, uint64_t key, uint64_t val)				{ map.TryEmplace(key, val); }
+
+	// sums the values of up to count entries from the first key not less than key
+	static uint64_t Scan(const Map& map, uint64_t key, size_t count) {
+		uint64_t sum = 0;
+		for (auto it = map.LowerBound(key); it != map.end() && count > 0; ++it, --count)
+			sum += it.Value();
+		return sum;
+	}
+};
+
+struct StdMapBench {
+	using Map = std::map<uint64_t, uint64_t>;
+	static constexpr bool canInsert = true;
+
+	static void Load(Map& map, const std::vector<TimestampEntry>& sorted)	{ map = Map(sorted.begin(), sorted.end()); }
+	static void Insert(Map& map, uint64_t key, uint64_t val)				{ map.try_emplace(key, val); }
+
+	static uint64_t Scan(const Map& map, uint64_t key, size_t count) {
+		uint64_t sum = 0;
+		for (auto it = map.lower_bound(key); it != map.end() && count > 0; ++it, --count)
+			sum += it->second;
+		return sum;
+	}
+};
+
+struct SortedVectorBench {
+	using Map = std::vector<TimestampEntry>;
+	static constexpr bool canInsert = false;	// every insert shifts half the array
+
+	static void Load(Map& map, const std::vector<TimestampEntry>& sorted)	{ map = sorted; }
+	static void Insert(Map&, uint64_t, uint64_t)							{}
+
+	static uint64_t Scan(const Map& map, uint64_t key, size_t count) {
+		uint64_t sum = 0;
+		auto it = std::lower_bound(map.begin(), map.end(), key, [](const TimestampEntry& entry, uint64_t k) { return entry.first < k; });
+		for (; it != map.end() && count > 0; ++it, --count)
+			sum += it->second;
+		return sum;
+	}
+};
+
+// bulk load and one at a time inserts of jittered timestamps, then random lower bounds and 100 entry range scans
+template<class Bench>
+void RunOrderedMapBenchmarks(BenchmarkReport& report, const BenchmarkOptions& options, const std::string& name) {
+	if (!options.IsSelected(name))
+		return;
+
+	using Map = typename Bench::Map;
+	constexpr size_t scanLength = 100;
+	for (size_t size : options.Sizes()) {
+		const size_t repetitions = options.RepetitionsFor(size);
+		std::mt19937_64 rng(42);
+		std::vector<TimestampEntry> sorted(size);
+		for (size_t i = 0; i < size; ++i)
+			sorted[i] = { i * 16 + rng() % 16, i };
+		std::vector<TimestampEntry> shuffled = sorted;
+		std::shuffle(shuffled.begin(), shuffled.end(), rng);
+
+		Measure(report, name, "bulk_load", size, repetitions * size, [&]() {
+			for (size_t r = 0; r < repetitions; ++r) {
+				Map map;
+				Bench::Load(map, sorted);
+				KeepAlive(Bench::Scan(map, 0, 1));
+			}
+		});
+
+		if constexpr (Bench::canInsert) {
+			Measure(report, name, "insert_sequential", size, repetitions * size, [&]() {
+				for (size_t r = 0; r < repetitions; ++r) {
+					Map map;
+					for (const TimestampEntry& entry : sorted)
+						Bench::Insert(map, entry.first, entry.second);
+					KeepAlive(Bench::Scan(map, 0, 1));
+				}
+			});
+
+			Measure(report, name, "insert_random", size, repetitions * size, [&]() {
+				for (size_t r = 0; r < repetitions; ++r) {
+					Map map;
+					for (const TimestampEntry& entry : shuffled)
+						Bench::Insert(map, entry.first, entry.second);
+					KeepAlive(Bench::Scan(map, 0, 1));
+				}
+			});
+		}
+
+		Map map;
+		Bench::Load(map, sorted);
+		const uint64_t lookups = std::max<uint64_t>(options.elementsPerSize, size);
+		std::vector<uint64_t> probes(std::min<uint64_t>(lookups, 1 << 20));
+		for (uint64_t& probe : probes)
+			probe = rng() % (size * 16);
+
+		Measure(report, name, "lower_bound", size, lookups, [&]() {
+			uint64_t sum = 0;
+			for (uint64_t i = 0; i < lookups; ++i)
+				sum += Bench::Scan(map, probes[i % probes.size()], 1);
+			KeepAlive(sum);
+		});
+
+		const uint64_t scans = std::max<uint64_t>(1, lookups / scanLength);
+		Measure(report, name, "range_scan_100", size, scans * scanLength, [&]() {
+			uint64_t sum = 0;
+			for (uint64_t i = 0; i < scans; ++i)
+				sum += Bench::Scan(map, probes[i % probes.size()], scanLength);
+			KeepAlive(sum);
+		});
+	}
+}
+
+void BenchmarkOrderedMaps(BenchmarkReport& report, const BenchmarkOptions& options) {
+	RunOrderedMapBenchmarks<BTreeMapBench<256>>(report, options, "ads::BTreeMap<256>");
+	RunOrderedMapBenchmarks<BTreeMapBench<512>>(report, options, "ads::BTreeMap<512>");
+	RunOrderedMapBenchmarks<BTreeMapBench<4096>>(report, options, "ads::BTreeMap<4096>");
+	RunOrderedMapBenchmarks<StdMapBench>(report, options, "std::map");
+	RunOrderedMapBenchmarks<SortedVectorBench>(report, options, "sorted_std_vector");
+}
+
+#endif // BENCHMARKS_BTREE_MAP_BENCHMARKS_H
\ No newline at end of file
@@ -0,0 +1,96 @@
+#ifndef BENCHMARKS_CACHE_BENCHMARKS_H
+#define BENCHMARKS_CACHE_BENCHMARKS_H
+
+#include "pch.h"
+#include "benchmarks/benchmark_harness.h"
+#include "data_structures/lfu_cache.h"
+#include "data_structures/lru_cache.h"
+
+/* the hand rolled std::list + std::unordered_map LRU the ads caches replace */
+template<class K, class V>
+class StdLruCache {
+public:
+	explicit StdLruCache(size_t capacity) : m_capacity(capacity) {
+		m_index.reserve(capacity);
+	}
+
+	V* Get(const K& key) {
+		auto it = m_index.find(key);
+		if (it == m_index.end())
+			return nullptr;
+		m_recency.splice(m_recency.begin(), m_recency, it->second);
+		return &it->second->second;
+	}
+
+	void Put(const K& key, const V& value) {
+		auto it = m_index.find(key);
+		if (it != m_index.end()) {
+			it->second->second = value;
+			m_recency.splice(m_recency.begin(), m_recency, it->second);
+			return;
+		}
+		m_recency.emplace_front(key, value);
+		m_index.emplace(key, m_recency.begin());
+		if (m_index.size() > m_capacity) {
+			m_index.erase(m_recency.back().first);
+			m_recency.pop_back();
+		}
+	}
+
+private:
+	size_t m_capacity;
+	std::list<std::pair<K, V>> m_recency;
+	std::unordered_map<K, typename std::list<std::pair<K, V>>::iterator> m_index;
+};
+
+// lookups that always hit, then a skewed get-or-put stream over four times as many keys as fit
+template<class Cache>
+void RunCacheBenchmark(BenchmarkReport& report, const BenchmarkOptions& options, const std::string& name) {
+	if (!options.IsSelected(name))
+		return;
+
+	for (size_t capacity : options.Sizes()) {
+		const uint64_t ops = std::max<uint64_t>(options.elementsPerSize, capacity);
+		Cache cache(capacity);
+		for (uint64_t key = 0; key < capacity; ++key)
+			cache.Put(key, key);
+
+		// multiplicative stride visits every resident key in a cache unfriendly order
+		Measure(report, name, "get_hit", capacity, ops, [&]() {
+			uint64_t sum = 0;
+			uint64_t key = 0;
+			for (uint64_t i = 0; i < ops; ++i) {
+				key = (key + 0x9E3779B97F4A7C15ull) % capacity;
+				sum += *cache.Get(key);
+			}
+			KeepAlive(sum);
+		});
+
+		// squaring a uniform draw skews the stream towards low keys
+		std::mt19937_64 rng(42);
+		std::vector<uint64_t> keys(ops);
+		const double keySpace = static_cast<double>(capacity) * 4;
+		for (uint64_t& key : keys) {
+			const double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+			key = static_cast<uint64_t>(u * u * keySpace);
+		}
+		Measure(report, name, "get_or_put_skewed", capacity, ops, [&]() {
+			uint64_t sum = 0;
+			for (uint64_t key : keys) {
+				if (uint64_t* value = cache.Get(key))
+					sum += *value;
+				else
+					cache.Put(key, key);
+			}
+			KeepAlive(sum);
+		});
+	}
+}
+
+void BenchmarkCaches(BenchmarkReport& report, const BenchmarkOptions& options) {
+	RunCacheBenchmark<ads::LruCache<uint64_t, uint64_t>>(report, options, "ads::LruCache");
+	RunCacheBenchmark<ads::LfuCache<uint64_t, uint64_t>>(report, options, "ads::LfuCache");
+	RunCacheBenchmark<StdLruCache<uint64_t, uint64_t>>(report, options, "std_list_unordered_map_lru");
+}
+
+#endif // BENCHMARKS_CACHE_BENCHMARKS_H
\ No newline at end of file
@@ -0,0 +1,101 @@
+#ifndef BENCHMARKS_CONCURRENT_QUEUE_BENCHMARKS_H
+#define BENCHMARKS_CONCURRENT_QUEUE_BENCHMARKS_H
+
+#include "pch.h"
+#include "benchmarks/benchmark_harness.h"
+#include "data_structures/bounded_mpmc_queue.h"
+#include "data_structures/concurrent_queue.h"
+
+/* mutex guarded std::queue, the baseline the lock-free queues replace */
+template<class T>
+class MutexQueue {
+public:
+	void Push(const T& val) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_queue.push(val);
+	}
+
+	bool TryPop(T& out) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_queue.empty())
+			return false;
+		out = m_queue.front();
+		m_queue.pop();
+		return true;
+	}
+
+private:
+	std::mutex m_mutex;
+	std::queue<T> m_queue;
+};
+
+// runs producers x itemsPerProducer pushes against consumers poppers and returns millions of items moved per second
+template<class PushFn, class PopFn>
+double RunQueueThroughput(unsigned producers, unsigned consumers, size_t itemsPerProducer, PushFn push, PopFn pop) {
+	const size_t totalItems = producers * itemsPerProducer;
+	std::atomic<bool> start = false;
+	std::atomic<size_t> popped = 0;
+	std::vector<std::thread> threads;
+
+	for (unsigned p = 0; p < producers; ++p) {
+		threads.emplace_back([&, p]() {
+			while (!start.load(std::memory_order_acquire)) {}
+			for (size_t i = 0; i < itemsPerProducer; ++i) {
+				const uint64_t val = static_cast<uint64_t>(p) * itemsPerProducer + i;
+				while (!push(val))
+					std::this_thread::yield();
+			}
+		});
+	}
+	for (unsigned c = 0; c < consumers; ++c) {
+		threads.emplace_back([&]() {
+			while (!start.load(std::memory_order_acquire)) {}
+			uint64_t val;
+			while (popped.load(std::memory_order_relaxed) < totalItems) {
+				if (pop(val))
+					popped.fetch_add(1, std::memory_order_relaxed);
+				else
+					std::this_thread::yield();
+			}
+		});
+	}
+
+	const auto begin = std::chrono::steady_clock::now();
+	start.store(true, std::memory_order_release);
+	for (std::thread& thread : threads)
+		thread.join();
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+	return totalItems / elapsed.count() / 1e6;
+}
+
+// scales producers from 1 to maxThreads against one consumer, then runs the multi consumer queues with as many consumers as producers
+void BenchmarkConcurrentQueues(BenchmarkReport& report, const BenchmarkOptions& options, size_t itemsPerProducer = 1000000) {
+	auto run = [&](const char* name, unsigned producers, unsigned consumers, auto& queue, auto push) {
+		if (!options.IsSelected(name))
+			return;
+		const AllocationSnapshot before = AllocationSnapshot::Take();
+		const double rate = RunQueueThroughput(producers, consumers, itemsPerProducer,
+			[&](uint64_t val) { return push(queue, val); },
+			[&](uint64_t& out) { return queue.TryPop(out); });
+		const AllocationSnapshot delta = AllocationSnapshot::Take() - before;
+		const double ops = static_cast<double>(producers * itemsPerProducer);
+		report.Add({ name, "push_pop_p" + std::to_string(producers) + "_c" + std::to_string(consumers), producers * itemsPerProducer,
+			producers * itemsPerProducer, 1e3 / rate, delta.allocations / ops, delta.frees / ops, delta.bytes / ops });
+	};
+	auto pushAlways = [](auto& queue, uint64_t val) { queue.Push(val); return true; };
+	auto tryPush = [](auto& queue, uint64_t val) { return queue.TryPush(val); };
+
+	for (unsigned producers = 1; producers <= options.maxThreads; producers *= 2) {
+		{ MutexQueue<uint64_t> queue; run("mutex_std_queue", producers, 1, queue, pushAlways); }
+		{ ads::MpscQueue<uint64_t> queue; run("ads::MpscQueue", producers, 1, queue, pushAlways); }
+		{ ads::ConcurrentQueue<uint64_t> queue; run("ads::ConcurrentQueue", producers, 1, queue, pushAlways); }
+		{ ads::BoundedMpmcQueue<uint64_t> queue(1 << 16); run("ads::BoundedMpmcQueue", producers, 1, queue, tryPush); }
+	}
+	for (unsigned threads = 1; threads <= options.maxThreads / 2; threads *= 2) {
+		{ MutexQueue<uint64_t> queue; run("mutex_std_queue", threads, threads, queue, pushAlways); }
+		{ ads::ConcurrentQueue<uint64_t> queue; run("ads::ConcurrentQueue", threads, threads, queue, pushAlways); }
+		{ ads::BoundedMpmcQueue<uint64_t> queue(1 << 16); run("ads::BoundedMpmcQueue", threads, threads, queue, tryPush); }
+	}
+}
+
+#endif // BENCHMARKS_CONCURRENT_QUEUE_BENCHMARKS_H
\ No newline at end of file
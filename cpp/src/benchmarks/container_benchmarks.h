@@ -0,0 +1,284 @@
+#ifndef BENCHMARKS_CONTAINER_BENCHMARKS_H
+#define BENCHMARKS_CONTAINER_BENCHMARKS_H
+
+#include "pch.h"
+#include "benchmarks/benchmark_harness.h"
+#include "data_structures/array_linked_list.h"
+#include "data_structures/doubly_linked_list.h"
+#include "data_structures/intrusive_list.h"
+#include "data_structures/linked_list.h"
+#include "data_structures/unrolled_list.h"
+
+/* adapters that give every container the same Prepare/Append/Prepend/Traverse/RemoveValue surface */
+
+template<class List>
+struct AdsListBench {
+	static constexpr bool canRemove = requires(List& list) { list.Remove(uint64_t()); };
+	static constexpr size_t maxPrependSize = SIZE_MAX;
+
+	void Prepare(size_t) {}
+	void Append(uint64_t val)		{ list.Append(val); }
+	void Prepend(uint64_t val)		{ list.EmplaceFront(val); }
+	void RemoveValue(uint64_t val)	{ if constexpr (canRemove) list.Remove(val); }
+
+	uint64_t Traverse() const {
+		uint64_t sum = 0;
+		if constexpr (requires { list.ForEach([](uint64_t) {}); }) {
+			list.ForEach([&sum](uint64_t val) { sum += val; });
+		} else {
+			for (uint64_t val : list)
+				sum += val;
+		}
+		return sum;
+	}
+
+	List list;
+};
+
+struct IntrusiveListBench {
+	struct Item {
+		uint64_t value;
+		ads::IntrusiveListHook hook;
+	};
+	typedef ads::IntrusiveList<Item, offsetof(Item, hook)> List;
+
+	static constexpr bool canRemove = true;
+	static constexpr size_t maxPrependSize = SIZE_MAX;
+
+	// the objects live in a preallocated array, as they would in an engine pool
+	void Prepare(size_t size) {
+		items = std::make_unique<Item[]>(size);
+		used = 0;
+	}
+
+	void Append(uint64_t val) {
+		Item& item = items[used++];
+		item.value = val;
+		list.Append(item);
+	}
+
+	void Prepend(uint64_t val) {
+		Item& item = items[used++];
+		item.value = val;
+		list.Prepend(item);
+	}
+
+	void RemoveValue(uint64_t val) {
+		for (auto it = list.begin(); it != list.end();) {
+			if (it->value == val)
+				it = list.Erase(it);
+			else
+				++it;
+		}
+	}
+
+	uint64_t Traverse() const {
+		uint64_t sum = 0;
+		for (const Item& item : list)
+			sum += item.value;
+		return sum;
+	}
+
+	std::unique_ptr<Item[]> items;
+	size_t used = 0;
+	List list;
+};
+
+struct StdListBench {
+	static constexpr bool canRemove = true;
+	static constexpr size_t maxPrependSize = SIZE_MAX;
+
+	void Prepare(size_t) {}
+	void Append(uint64_t val)		{ list.push_back(val); }
+	void Prepend(uint64_t val)		{ list.push_front(val); }
+	void RemoveValue(uint64_t val)	{ list.remove(val); }
+
+	uint64_t Traverse() const {
+		uint64_t sum = 0;
+		for (uint64_t val : list)
+			sum += val;
+		return sum;
+	}
+
+	std::list<uint64_t> list;
+};
+
+struct StdForwardListBench {
+	static constexpr bool canRemove = true;
+	static constexpr size_t maxPrependSize = SIZE_MAX;
+
+	void Prepare(size_t) {}
+	void Append(uint64_t val)		{ last = list.insert_after(last, val); }
+	void RemoveValue(uint64_t val)	{ list.remove(val); }
+
+	void Prepend(uint64_t val) {
+		list.push_front(val);
+		if (last == list.before_begin())
+			last = list.begin();
+	}
+
+	uint64_t Traverse() const {
+		uint64_t sum = 0;
+		for (uint64_t val : list)
+			sum += val;
+		return sum;
+	}
+
+	std::forward_list<uint64_t> list;
+	std::forward_list<uint64_t>::iterator last = list.before_begin();
+};
+
+struct StdVectorBench {
+	static constexpr bool canRemove = true;
+	static constexpr size_t maxPrependSize = 100000;	// front insertion is quadratic
+
+	void Prepare(size_t) {}
+	void Append(uint64_t val)		{ vector.push_back(val); }
+	void Prepend(uint64_t val)		{ vector.insert(vector.begin(), val); }
+	void RemoveValue(uint64_t val)	{ std::erase(vector, val); }
+
+	uint64_t Traverse() const {
+		uint64_t sum = 0;
+		for (uint64_t val : vector)
+			sum += val;
+		return sum;
+	}
+
+	std::vector<uint64_t> vector;
+};
+
+
+// measures append, traverse, destroy, prepend and remove-all for Bench at every size, repetitions keep small sizes above timer noise
+template<class Bench>
+void RunContainerBenchmarks(BenchmarkReport& report, const BenchmarkOptions& options, const std::string& name) {
+	if (!options.IsSelected(name))
+		return;
+
+	for (size_t size : options.Sizes()) {
+		const size_t reps = options.RepetitionsFor(size);
+		const uint64_t ops = static_cast<uint64_t>(size) * reps;
+		auto makeBenches = [&]() {
+			auto benches = std::make_unique<Bench[]>(reps);
+			for (size_t r = 0; r < reps; ++r)
+				benches[r].Prepare(size);
+			return benches;
+		};
+
+		std::unique_ptr<Bench[]> benches = makeBenches();
+		Measure(report, name, "append", size, ops, [&]() {
+			for (size_t r = 0; r < reps; ++r) {
+				for (size_t i = 0; i < size; ++i)
+					benches[r].Append(i);
+			}
+		});
+		Measure(report, name, "traverse", size, ops, [&]() {
+			uint64_t sum = 0;
+			for (size_t r = 0; r < reps; ++r)
+				sum += benches[r].Traverse();
+			KeepAlive(sum);
+		});
+		Measure(report, name, "destroy", size, ops, [&]() {
+			benches.reset();
+		});
+
+		if (size <= Bench::maxPrependSize) {
+			benches = makeBenches();
+			Measure(report, name, "prepend", size, ops, [&]() {
+				for (size_t r = 0; r < reps; ++r) {
+					for (size_t i = 0; i < size; ++i)
+						benches[r].Prepend(i);
+				}
+			});
+			benches.reset();
+		}
+
+		if constexpr (Bench::canRemove) {
+			// alternate two values so the first pass removes every other node and the second empties the container
+			benches = makeBenches();
+			for (size_t r = 0; r < reps; ++r) {
+				for (size_t i = 0; i < size; ++i)
+					benches[r].Append(i & 1);
+			}
+			Measure(report, name, "remove_all", size, ops, [&]() {
+				for (size_t r = 0; r < reps; ++r) {
+					benches[r].RemoveValue(1);
+					benches[r].RemoveValue(0);
+				}
+			});
+			benches.reset();
+		}
+	}
+}
+
+// streaming edit passes over a TrackedLinkedList: a run of values inserted after every node, one at a time and as a batch, then erasing every other node through the cursor
+void BenchmarkTrackedCursor(BenchmarkReport& report, const BenchmarkOptions& options) {
+	const std::string name = "ads::TrackedLinkedList";
+	if (!options.IsSelected(name))
+		return;
+
+	constexpr size_t runLength = 4;
+	const uint64_t run[runLength] = { 1, 2, 3, 4 };
+	for (size_t size : options.Sizes()) {
+		const size_t reps = options.RepetitionsFor(size);
+		const uint64_t ops = static_cast<uint64_t>(size) * reps * runLength;
+		auto makeLists = [&]() {
+			auto lists = std::make_unique<ads::TrackedLinkedList<uint64_t>[]>(reps);
+			for (size_t r = 0; r < reps; ++r) {
+				for (size_t i = 0; i < size; ++i)
+					lists[r].Append(i);
+			}
+			return lists;
+		};
+
+		auto lists = makeLists();
+		Measure(report, name, "cursor_insert_single", size, ops, [&]() {
+			for (size_t r = 0; r < reps; ++r) {
+				lists[r].Reset();
+				while (lists[r].IsCurrentValid()) {
+					// inserting after the cursor reverses the run, so insert it back to front
+					for (size_t i = runLength; i > 0; --i)
+						lists[r].Insert(run[i - 1]);
+					lists[r].Advance(runLength + 1);
+				}
+			}
+		});
+
+		lists = makeLists();
+		Measure(report, name, "cursor_insert_batch", size, ops, [&]() {
+			for (size_t r = 0; r < reps; ++r) {
+				lists[r].Reset();
+				while (lists[r].IsCurrentValid()) {
+					lists[r].InsertRange(std::begin(run), std::end(run));
+					lists[r].Advance(runLength + 1);
+				}
+			}
+		});
+
+		// every other node of the grown list
+		Measure(report, name, "cursor_erase", size, static_cast<uint64_t>(size) * reps * (runLength + 1) / 2, [&]() {
+			for (size_t r = 0; r < reps; ++r) {
+				lists[r].Reset();
+				while (lists[r].IsCurrentValid()) {
+					lists[r].EraseCurrent();
+					lists[r].Advance(1);
+				}
+			}
+		});
+	}
+}
+
+// every ads:: sequence container against the std baselines
+void BenchmarkContainers(BenchmarkReport& report, const BenchmarkOptions& options) {
+	RunContainerBenchmarks<AdsListBench<ads::LinkedList<uint64_t>>>(report, options, "ads::LinkedList");
+	RunContainerBenchmarks<AdsListBench<ads::TrackedLinkedList<uint64_t>>>(report, options, "ads::TrackedLinkedList");
+	BenchmarkTrackedCursor(report, options);
+	RunContainerBenchmarks<AdsListBench<ads::DoublyLinkedList<uint64_t>>>(report, options, "ads::DoublyLinkedList");
+	RunContainerBenchmarks<AdsListBench<ads::UnrolledList<uint64_t>>>(report, options, "ads::UnrolledList");
+	RunContainerBenchmarks<AdsListBench<ads::ArrayLinkedList<uint64_t>>>(report, options, "ads::ArrayLinkedList");
+	RunContainerBenchmarks<IntrusiveListBench>(report, options, "ads::IntrusiveList");
+	RunContainerBenchmarks<StdListBench>(report, options, "std::list");
+	RunContainerBenchmarks<StdForwardListBench>(report, options, "std::forward_list");
+	RunContainerBenchmarks<StdVectorBench>(report, options, "std::vector");
+}
+
+#endif // BENCHMARKS_CONTAINER_BENCHMARKS_H
\ No newline at end of file
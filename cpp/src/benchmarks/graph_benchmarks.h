@@ -0,0 +1,96 @@
+#ifndef BENCHMARKS_GRAPH_BENCHMARKS_H
+#define BENCHMARKS_GRAPH_BENCHMARKS_H
+
+#include "pch.h"
+#include "algorithms/graph/bfs.h"
+#include "algorithms/graph/connected_components.h"
+#include "algorithms/graph/csr_builder.h"
+#include "algorithms/graph/graph_generators.h"
+#include "algorithms/graph/page_rank.h"
+#include "algorithms/thread_pool.h"
+#include "benchmarks/benchmark_harness.h"
+#include "data_structures/linked_list.h"
+
+// the baseline CsrGraph replaces: one linked list of out neighbours per vertex, searched with a plain queue BFS
+uint64_t LinkedListAdjacencyBfs(const std::vector<ads::LinkedList<uint32_t>>& adjacency, uint32_t source) {
+	std::vector<uint32_t> depths(adjacency.size(), ads::CsrGraph<>::noVertex);
+	std::vector<uint32_t> queue{ source };
+	depths[source] = 0;
+	for (size_t head = 0; head < queue.size(); ++head) {
+		const uint32_t u = queue[head];
+		for (uint32_t v : adjacency[u]) {
+			if (depths[v] == ads::CsrGraph<>::noVertex) {
+				depths[v] = depths[u] + 1;
+				queue.push_back(v);
+			}
+		}
+	}
+	return queue.size();
+}
+
+// sizes are vertex counts rounded up to a power of two, each with an undirected Graph 500 style Kronecker graph of 16 edges
+// per vertex; ns/op is per directed edge stored (build, bfs, cc) or per edge and iteration (pagerank), so 1 / ns_per_op
+// for bfs is billions of traversed edges per second; _tN rows show scaling on the work-stealing pool
+void BenchmarkGraphs(BenchmarkReport& report, const BenchmarkOptions& options) {
+	const bool csrSelected = options.IsSelected("ads::CsrGraph");
+	const bool listSelected = options.IsSelected("ads::LinkedList");
+	if (!csrSelected && !listSelected)
+		return;
+
+	constexpr size_t edgeFactor = 16;
+	for (size_t size : options.Sizes()) {
+		const unsigned scale = std::max(4u, static_cast<unsigned>(std::bit_width(size - 1)));
+		const uint32_t vertexCount = uint32_t(1) << scale;
+		ads::ThreadPool generatorPool(options.maxThreads);
+		const std::vector<ads::CsrEdge<>> edges = ads::GraphGenerator::Kronecker(scale, edgeFactor, 42, generatorPool);
+		const ads::CsrGraph<> graph = ads::BuildCsrGraph(vertexCount, edges, generatorPool, { .symmetrize = true });
+		const size_t edgeCount = graph.EdgeCount();
+		const size_t repetitions = options.RepetitionsFor(edgeCount);
+		// an endpoint of a generated edge, which almost surely sits in the giant component
+		const uint32_t source = edges.front().source;
+
+		if (listSelected) {
+			std::vector<ads::LinkedList<uint32_t>> adjacency(vertexCount);
+			for (uint32_t u = 0; u < vertexCount; ++u) {
+				for (uint32_t v : graph.OutNeighbors(u))
+					adjacency[u].Append(v);
+			}
+			Measure(report, "ads::LinkedList", "bfs_adjacency", vertexCount, repetitions * edgeCount, [&]() {
+				for (size_t rep = 0; rep < repetitions; ++rep)
+					KeepAlive(LinkedListAdjacencyBfs(adjacency, source));
+			});
+		}
+		if (!csrSelected)
+			continue;
+
+		ads::ThreadPool single(1);
+		Measure(report, "ads::CsrGraph", "bfs_top_down_t1", vertexCount, repetitions * edgeCount, [&]() {
+			for (size_t rep = 0; rep < repetitions; ++rep)
+				KeepAlive(ads::BreadthFirstSearch(graph, source, single, { .directionOptimizing = false }).levels);
+		});
+		for (unsigned threadCount = 1; threadCount <= options.maxThreads; threadCount *= 2) {
+			ads::ThreadPool pool(threadCount);
+			const std::string suffix = "_t" + std::to_string(threadCount);
+			Measure(report, "ads::CsrGraph", "build" + suffix, vertexCount, repetitions * edgeCount, [&]() {
+				for (size_t rep = 0; rep < repetitions; ++rep)
+					KeepAlive(ads::BuildCsrGraph(vertexCount, edges, pool, { .symmetrize = true }).EdgeCount());
+			});
+			Measure(report, "ads::CsrGraph", "bfs" + suffix, vertexCount, repetitions * edgeCount, [&]() {
+				for (size_t rep = 0; rep < repetitions; ++rep)
+					KeepAlive(ads::BreadthFirstSearch(graph, source, pool).levels);
+			});
+			Measure(report, "ads::CsrGraph", "cc" + suffix, vertexCount, repetitions * edgeCount, [&]() {
+				for (size_t rep = 0; rep < repetitions; ++rep)
+					KeepAlive(ads::ConnectedComponentLabels(graph, pool)[source]);
+			});
+			// a fixed iteration count so every thread count does the same work
+			constexpr unsigned iterations = 10;
+			Measure(report, "ads::CsrGraph", "pagerank" + suffix, vertexCount, repetitions * edgeCount * iterations, [&]() {
+				for (size_t rep = 0; rep < repetitions; ++rep)
+					KeepAlive(ads::ComputePageRank(graph, pool, { .tolerance = 0.0, .maxIterations = iterations }).iterations);
+			});
+		}
+	}
+}
+
+#endif // BENCHMARKS_GRAPH_BENCHMARKS_H
\ No newline at end of file
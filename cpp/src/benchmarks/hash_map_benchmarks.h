@@ -0,0 +1,113 @@
+#ifndef BENCHMARKS_HASH_MAP_BENCHMARKS_H
+#define BENCHMARKS_HASH_MAP_BENCHMARKS_H
+
+#include "pch.h"
+#include "benchmarks/benchmark_harness.h"
+#include "data_structures/flat_hash_map.h"
+
+/* common surface over ads::FlatHashMap and std::unordered_map */
+template<class K, class V>
+struct FlatHashMapBench {
+	using Map = ads::FlatHashMap<K, V>;
+
+	static void Reserve(Map& map, size_t count)			{ map.Reserve(count); }
+	static void Insert(Map& map, const K& key, V val)	{ map.TryEmplace(key, val); }
+	static const V* Find(const Map& map, const K& key)	{ return map.Get(key); }
+	static size_t Erase(Map& map, const K& key)			{ return map.Erase(key); }
+};
+
+template<class K, class V>
+struct StdUnorderedMapBench {
+	using Map = std::unordered_map<K, V>;
+
+	static void Reserve(Map& map, size_t count)			{ map.reserve(count); }
+	static void Insert(Map& map, const K& key, V val)	{ map.try_emplace(key, val); }
+	static size_t Erase(Map& map, const K& key)			{ return map.erase(key); }
+
+	static const V* Find(const Map& map, const K& key) {
+		auto it = map.find(key);
+		return it != map.end() ? &it->second : nullptr;
+	}
+};
+
+// splitmix64, distinct for distinct inputs so keys never collide
+inline uint64_t HashMapBenchmarkKey(uint64_t i) {
+	uint64_t z = i + 0x9E3779B97F4A7C15ull;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+// insert with and without reserve, lookups that all hit or all miss, and a sliding window of insert + erase pairs
+template<class Bench>
+void RunHashMapBenchmarks(BenchmarkReport& report, const BenchmarkOptions& options, const std::string& name) {
+	if (!options.IsSelected(name))
+		return;
+
+	using Map = typename Bench::Map;
+	for (size_t size : options.Sizes()) {
+		const size_t repetitions = options.RepetitionsFor(size);
+		std::vector<uint64_t> keys(size);
+		for (size_t i = 0; i < size; ++i)
+			keys[i] = HashMapBenchmarkKey(i);
+
+		Measure(report, name, "insert", size, repetitions * size, [&]() {
+			for (size_t r = 0; r < repetitions; ++r) {
+				Map map;
+				for (uint64_t key : keys)
+					Bench::Insert(map, key, key);
+				KeepAlive(*Bench::Find(map, keys.back()));
+			}
+		});
+
+		Measure(report, name, "insert_reserved", size, repetitions * size, [&]() {
+			for (size_t r = 0; r < repetitions; ++r) {
+				Map map;
+				Bench::Reserve(map, size);
+				for (uint64_t key : keys)
+					Bench::Insert(map, key, key);
+				KeepAlive(*Bench::Find(map, keys.back()));
+			}
+		});
+
+		Map map;
+		Bench::Reserve(map, size);
+		for (uint64_t key : keys)
+			Bench::Insert(map, key, key);
+
+		// at least elementsPerSize lookups so small tables aren't timed on a handful of calls
+		const uint64_t lookups = std::max<uint64_t>(options.elementsPerSize, size);
+		Measure(report, name, "hit", size, lookups, [&]() {
+			uint64_t sum = 0;
+			for (uint64_t i = 0; i < lookups; ++i)
+				sum += *Bench::Find(map, keys[i % size]);
+			KeepAlive(sum);
+		});
+
+		// keys past the inserted range of the same sequence, so misses probe like real absent keys
+		Measure(report, name, "miss", size, lookups, [&]() {
+			uint64_t missed = 0;
+			for (uint64_t i = 0; i < lookups; ++i)
+				missed += Bench::Find(map, HashMapBenchmarkKey(size + i % size)) == nullptr;
+			KeepAlive(missed);
+		});
+
+		// every insert of a new key erases the oldest one, the table stays full while tombstones pile up
+		Measure(report, name, "erase_heavy", size, 2 * lookups, [&]() {
+			uint64_t erased = 0;
+			for (uint64_t i = 0; i < lookups; ++i) {
+				Bench::Insert(map, HashMapBenchmarkKey(size + i), i);
+				erased += Bench::Erase(map, HashMapBenchmarkKey(i));
+			}
+			KeepAlive(erased);
+		});
+	}
+}
+
+// pass --max-size=100000000 for the 100M key tables, they need several GB
+void BenchmarkHashMaps(BenchmarkReport& report, const BenchmarkOptions& options) {
+	RunHashMapBenchmarks<FlatHashMapBench<uint64_t, uint64_t>>(report, options, "ads::FlatHashMap");
+	RunHashMapBenchmarks<StdUnorderedMapBench<uint64_t, uint64_t>>(report, options, "std::unordered_map");
+}
+
+#endif // BENCHMARKS_HASH_MAP_BENCHMARKS_H
\ No newline at end of file
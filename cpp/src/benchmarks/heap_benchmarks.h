@@ -0,0 +1,152 @@
+#ifndef BENCHMARKS_HEAP_BENCHMARKS_H
+#define BENCHMARKS_HEAP_BENCHMARKS_H
+
+#include "pch.h"
+#include "benchmarks/benchmark_harness.h"
+#include "data_structures/dary_heap.h"
+#include "data_structures/radix_heap.h"
+
+/* common surface over the heaps, all of them are min heaps on 64 bit keys */
+template<size_t D>
+struct DaryHeapBench {
+	using Heap = ads::DaryHeap<uint64_t, D, std::greater<uint64_t>>;
+
+	static void Reserve(Heap& heap, size_t count)	{ heap.Reserve(count); }
+	static void Push(Heap& heap, uint64_t key)		{ heap.Push(key); }
+	static uint64_t Pop(Heap& heap)					{ return heap.PopTop(); }
+};
+
+struct StdPriorityQueueBench {
+	using Heap = std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>>;
+
+	static void Reserve(Heap&, size_t) {}
+	static void Push(Heap& heap, uint64_t key) { heap.push(key); }
+
+	static uint64_t Pop(Heap& heap) {
+		const uint64_t key = heap.top();
+		heap.pop();
+		return key;
+	}
+};
+
+struct RadixHeapBench {
+	using Heap = ads::RadixHeap<uint64_t, uint32_t>;
+
+	static void Reserve(Heap& heap, size_t count)	{ heap.Reserve(count); }
+	static void Push(Heap& heap, uint64_t key)	{ heap.Push(key, 0); }
+	static uint64_t Pop(Heap& heap)				{ return heap.Pop().first; }
+};
+
+// push_pop_all fills a heap with size random keys and empties it again, only for heaps that take any key order
+template<class Bench>
+void RunHeapRandomBenchmarks(BenchmarkReport& report, const BenchmarkOptions& options, const std::string& name) {
+	if (!options.IsSelected(name))
+		return;
+
+	using Heap = typename Bench::Heap;
+	for (size_t size : options.Sizes()) {
+		const size_t repetitions = options.RepetitionsFor(size);
+		std::mt19937_64 rng(size);
+		std::vector<uint64_t> keys(size);
+		for (uint64_t& key : keys)
+			key = rng();
+
+		Heap heap;
+		Bench::Reserve(heap, size);
+		Measure(report, name, "push_pop_all", size, 2 * repetitions * size, [&]() {
+			uint64_t sum = 0;
+			for (size_t rep = 0; rep < repetitions; ++rep) {
+				for (uint64_t key : keys)
+					Bench::Push(heap, key);
+				for (size_t i = 0; i < size; ++i)
+					sum += Bench::Pop(heap);
+			}
+			KeepAlive(sum);
+		});
+	}
+}
+
+// keeps size keys queued while every pop pushes back the popped key plus a random weight, which is how Dijkstra
+// with lazy deletion drives its queue and the only pattern a radix heap accepts
+template<class Bench>
+void RunHeapMonotoneBenchmarks(BenchmarkReport& report, const BenchmarkOptions& options, const std::string& name) {
+	if (!options.IsSelected(name))
+		return;
+
+	using Heap = typename Bench::Heap;
+	for (size_t size : options.Sizes()) {
+		const size_t ops = options.RepetitionsFor(size) * size;
+		std::mt19937_64 rng(size);
+		std::vector<uint32_t> weights(4096);
+		for (uint32_t& weight : weights)
+			weight = static_cast<uint32_t>(rng() % 100000);
+
+		Heap heap;
+		Bench::Reserve(heap, size + 1);
+		for (size_t i = 0; i < size; ++i)
+			Bench::Push(heap, rng() % 100000);
+
+		Measure(report, name, "monotone_pop_push", size, ops, [&]() {
+			uint64_t sum = 0;
+			for (size_t i = 0; i < ops; ++i) {
+				const uint64_t key = Bench::Pop(heap);
+				Bench::Push(heap, key + weights[i & (weights.size() - 1)]);
+				sum += key;
+			}
+			KeepAlive(sum);
+		});
+	}
+}
+
+// size ids queued, then random ids get a lower priority the way edge relaxation lowers tentative distances
+template<size_t D>
+void RunIndexedHeapBenchmarks(BenchmarkReport& report, const BenchmarkOptions& options, const std::string& name) {
+	if (!options.IsSelected(name))
+		return;
+
+	for (size_t size : options.Sizes()) {
+		const size_t ops = options.RepetitionsFor(size) * size;
+		std::mt19937_64 rng(size);
+		ads::IndexedDaryHeap<uint64_t, D, std::greater<uint64_t>> heap(size);
+		heap.Reserve(size);
+		for (size_t id = 0; id < size; ++id)
+			heap.Push(static_cast<uint32_t>(id), (rng() >> 4) + (1ull << 60));
+
+		// starting priorities leave room for far more decrements than any run performs
+		std::vector<uint32_t> ids(4096);
+		std::vector<uint32_t> deltas(4096);
+		for (size_t i = 0; i < ids.size(); ++i) {
+			ids[i] = static_cast<uint32_t>(rng() % size);
+			deltas[i] = 1 + static_cast<uint32_t>(rng() % (1u << 20));
+		}
+
+		Measure(report, name, "decrease_key", size, ops, [&]() {
+			for (size_t i = 0; i < ops; ++i) {
+				const uint32_t id = ids[i & (ids.size() - 1)];
+				heap.DecreaseKey(id, heap.PriorityOf(id) - deltas[i & (deltas.size() - 1)]);
+			}
+			KeepAlive(heap.TopPriority());
+		});
+	}
+}
+
+// binary heaps touch a new cache line at almost every level of a sift, wider nodes trade more comparisons per level
+// for fewer levels and keep a node's children on one or two lines
+void BenchmarkHeaps(BenchmarkReport& report, const BenchmarkOptions& options) {
+	RunHeapRandomBenchmarks<StdPriorityQueueBench>(report, options, "std::priority_queue");
+	RunHeapRandomBenchmarks<DaryHeapBench<2>>(report, options, "ads::DaryHeap<2>");
+	RunHeapRandomBenchmarks<DaryHeapBench<4>>(report, options, "ads::DaryHeap<4>");
+	RunHeapRandomBenchmarks<DaryHeapBench<8>>(report, options, "ads::DaryHeap<8>");
+
+	RunHeapMonotoneBenchmarks<StdPriorityQueueBench>(report, options, "std::priority_queue");
+	RunHeapMonotoneBenchmarks<DaryHeapBench<2>>(report, options, "ads::DaryHeap<2>");
+	RunHeapMonotoneBenchmarks<DaryHeapBench<4>>(report, options, "ads::DaryHeap<4>");
+	RunHeapMonotoneBenchmarks<DaryHeapBench<8>>(report, options, "ads::DaryHeap<8>");
+	RunHeapMonotoneBenchmarks<RadixHeapBench>(report, options, "ads::RadixHeap");
+
+	RunIndexedHeapBenchmarks<2>(report, options, "ads::IndexedDaryHeap<2>");
+	RunIndexedHeapBenchmarks<4>(report, options, "ads::IndexedDaryHeap<4>");
+	RunIndexedHeapBenchmarks<8>(report, options, "ads::IndexedDaryHeap<8>");
+}
+
+#endif // BENCHMARKS_HEAP_BENCHMARKS_H
\ No newline at end of file
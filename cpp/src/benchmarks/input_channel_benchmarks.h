@@ -0,0 +1,93 @@
+#ifndef BENCHMARKS_INPUT_CHANNEL_BENCHMARKS_H
+#define BENCHMARKS_INPUT_CHANNEL_BENCHMARKS_H
+
+#include "pch.h"
+#include "benchmarks/benchmark_harness.h"
+#include "engine/input/input_channel.h"
+
+/* the lock based hand-off the channel replaces */
+class MutexInputQueue {
+public:
+	explicit MutexInputQueue(size_t) {}
+
+	bool Push(const engine::InputEvent& event) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_queue.push(event);
+		return true;
+	}
+
+	size_t Drain(std::span<engine::InputEvent> out) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		size_t count = 0;
+		for (; !m_queue.empty() && count < out.size(); ++count) {
+			out[count] = m_queue.front();
+			m_queue.pop();
+		}
+		return count;
+	}
+
+private:
+	std::mutex m_mutex;
+	std::queue<engine::InputEvent> m_queue;
+};
+
+// the capture thread stamps and pushes size events, the update thread drains them and records now - timestamp for each,
+// a burst run pushes as fast as it can, a paced run leaves pace between events like a fast mouse would
+template<class Channel>
+void RunInputChannelLatency(BenchmarkReport& report, const std::string& name, const std::string& operation, size_t size, int64_t pace) {
+	Channel channel(4096);
+	std::vector<int64_t> latencies;
+	latencies.reserve(size);
+
+	const auto begin = std::chrono::steady_clock::now();
+	std::thread consumer([&]() {
+		engine::InputEvent batch[256];
+		while (latencies.size() < size) {
+			const size_t count = channel.Drain(batch);
+			const int64_t now = engine::InputChannel::Now();
+			for (size_t i = 0; i < count; ++i)
+				latencies.push_back(now - batch[i].GetTimestamp());
+		}
+	});
+	for (size_t i = 0; i < size; ++i) {
+		const int64_t stamp = engine::InputChannel::Now();
+		while (!channel.Push(engine::InputEvent(engine::MouseEvent(engine::MouseEvent::EventType::Move, static_cast<int>(i), 0), stamp)))
+			std::this_thread::yield();
+		if (pace > 0) {
+			while (engine::InputChannel::Now() - stamp < pace)
+				;
+		}
+	}
+	consumer.join();
+	const double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+
+	std::sort(latencies.begin(), latencies.end());
+	report.Add({ name, operation, size, size, elapsed / static_cast<double>(size), 0.0, 0.0, 0.0 });
+	for (double percentile : { 50.0, 99.0, 99.9 }) {
+		std::ostringstream label;
+		label << operation << "_p" << percentile;
+		report.Add({ name, label.str(), size, size, LatencyPercentile(latencies, percentile), 0.0, 0.0, 0.0 });
+	}
+}
+
+// ns/op of the plain rows is throughput, the _pN rows hold enqueue to dequeue latency percentiles in ns
+template<class Channel>
+void RunInputChannelBenchmarks(BenchmarkReport& report, const BenchmarkOptions& options, const std::string& name) {
+	if (!options.IsSelected(name))
+		return;
+
+	// a million events is hours of real input, larger runs say nothing new
+	for (size_t size : options.Sizes()) {
+		if (size > 1000000)
+			break;
+		RunInputChannelLatency<Channel>(report, name, "burst", size, 0);
+		RunInputChannelLatency<Channel>(report, name, "paced_2us", size, 2000);
+	}
+}
+
+void BenchmarkInputChannels(BenchmarkReport& report, const BenchmarkOptions& options) {
+	RunInputChannelBenchmarks<engine::InputChannel>(report, options, "engine::InputChannel");
+	RunInputChannelBenchmarks<MutexInputQueue>(report, options, "std_mutex_queue_channel");
+}
+
+#endif // BENCHMARKS_INPUT_CHANNEL_BENCHMARKS_H
\ No newline at end of file
@@ -0,0 +1,100 @@
+#ifndef BENCHMARKS_RING_BUFFER_BENCHMARKS_H
+#define BENCHMARKS_RING_BUFFER_BENCHMARKS_H
+
+#include "pch.h"
+#include "benchmarks/benchmark_harness.h"
+#include "data_structures/ring_buffer.h"
+
+// same shape as engine::MouseEvent
+struct PumpedEvent {
+	int type;
+	int x;
+	int y;
+};
+
+/* common surface over the input queues, a frame pushes events one by one and then drains them */
+struct RingBufferBench {
+	using Queue = ads::RingBuffer<PumpedEvent>;
+
+	static void Push(Queue& queue, const PumpedEvent& event) { queue.PushBack(event); }
+
+	static uint64_t PopOne(Queue& queue) {
+		const uint64_t x = static_cast<uint64_t>(queue.Front().x);
+		queue.PopFront();
+		return x;
+	}
+
+	// one contiguous copy for the whole frame
+	static uint64_t DrainAll(Queue& queue, std::vector<PumpedEvent>& out) {
+		const size_t count = queue.PopFront(out.size(), out.data());
+		return count > 0 ? static_cast<uint64_t>(out[count - 1].x) : 0;
+	}
+};
+
+struct StdQueueBench {
+	using Queue = std::queue<PumpedEvent>;
+
+	static void Push(Queue& queue, const PumpedEvent& event) { queue.push(event); }
+
+	static uint64_t PopOne(Queue& queue) {
+		const uint64_t x = static_cast<uint64_t>(queue.front().x);
+		queue.pop();
+		return x;
+	}
+
+	static uint64_t DrainAll(Queue& queue, std::vector<PumpedEvent>& out) {
+		size_t count = 0;
+		for (; !queue.empty() && count < out.size(); ++count) {
+			out[count] = queue.front();
+			queue.pop();
+		}
+		return count > 0 ? static_cast<uint64_t>(out[count - 1].x) : 0;
+	}
+};
+
+// size is events per frame, frames are pumped until about elementsPerSize events went through
+template<class Bench>
+void RunEventPumpBenchmarks(BenchmarkReport& report, const BenchmarkOptions& options, const std::string& name) {
+	if (!options.IsSelected(name))
+		return;
+
+	using Queue = typename Bench::Queue;
+	for (size_t size : options.Sizes()) {
+		const size_t frames = options.RepetitionsFor(size);
+		std::vector<PumpedEvent> out(size);
+		Queue queue;
+
+		// one warm up frame so the steady state figures exclude first growth
+		for (size_t i = 0; i < size; ++i)
+			Bench::Push(queue, { 0, static_cast<int>(i), 0 });
+		Bench::DrainAll(queue, out);
+
+		Measure(report, name, "pump_pop_each", size, frames * size, [&]() {
+			uint64_t sum = 0;
+			for (size_t frame = 0; frame < frames; ++frame) {
+				for (size_t i = 0; i < size; ++i)
+					Bench::Push(queue, { 0, static_cast<int>(i), 0 });
+				for (size_t i = 0; i < size; ++i)
+					sum += Bench::PopOne(queue);
+			}
+			KeepAlive(sum);
+		});
+
+		Measure(report, name, "pump_drain_frame", size, frames * size, [&]() {
+			uint64_t sum = 0;
+			for (size_t frame = 0; frame < frames; ++frame) {
+				for (size_t i = 0; i < size; ++i)
+					Bench::Push(queue, { 0, static_cast<int>(i), 0 });
+				sum += Bench::DrainAll(queue, out);
+			}
+			KeepAlive(sum);
+		});
+	}
+}
+
+void BenchmarkRingBuffers(BenchmarkReport& report, const BenchmarkOptions& options) {
+	RunEventPumpBenchmarks<RingBufferBench>(report, options, "ads::RingBuffer");
+	RunEventPumpBenchmarks<StdQueueBench>(report, options, "std::queue");
+}
+
+#endif // BENCHMARKS_RING_BUFFER_BENCHMARKS_H
\ No newline at end of file
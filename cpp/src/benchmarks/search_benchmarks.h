@@ -0,0 +1,94 @@
+#ifndef BENCHMARKS_SEARCH_BENCHMARKS_H
+#define BENCHMARKS_SEARCH_BENCHMARKS_H
+
+#include "pch.h"
+#include "algorithms/search/branchless_search.h"
+#include "algorithms/search/eytzinger_array.h"
+#include "algorithms/search/static_btree.h"
+#include "benchmarks/benchmark_harness.h"
+
+/* common surface over the static search layouts, every table is built once from sorted 32 bit keys */
+struct StdLowerBoundSearch {
+	using Table = std::vector<uint32_t>;
+
+	static Table Build(const std::vector<uint32_t>& sorted) { return sorted; }
+
+	static uint32_t LowerBound(const Table& table, uint32_t key) {
+		const auto it = std::lower_bound(table.begin(), table.end(), key);
+		return it != table.end() ? *it : 0;
+	}
+};
+
+struct BranchlessLowerBoundSearch {
+	using Table = std::vector<uint32_t>;
+
+	static Table Build(const std::vector<uint32_t>& sorted) { return sorted; }
+
+	static uint32_t LowerBound(const Table& table, uint32_t key) {
+		const auto it = ads::BranchlessLowerBound(table.begin(), table.end(), key);
+		return it != table.end() ? *it : 0;
+	}
+};
+
+struct EytzingerSearch {
+	using Table = ads::EytzingerArray<uint32_t>;
+
+	static Table Build(const std::vector<uint32_t>& sorted) { return Table(sorted.begin(), sorted.end()); }
+
+	static uint32_t LowerBound(const Table& table, uint32_t key) {
+		const uint32_t* found = table.LowerBound(key);
+		return found != nullptr ? *found : 0;
+	}
+};
+
+struct StaticBTreeSearch {
+	using Table = ads::StaticBTree<uint32_t>;
+
+	static Table Build(const std::vector<uint32_t>& sorted) { return Table(sorted.begin(), sorted.end()); }
+
+	static uint32_t LowerBound(const Table& table, uint32_t key) {
+		const uint32_t* found = table.LowerBound(key);
+		return found != nullptr ? *found : 0;
+	}
+};
+
+// build times the conversion from the sorted vector, lower_bound runs elementsPerSize random lookups against the table;
+// at 4 bytes a key the decade sizes cross L1 (1K, 10K), L2 (100K), L3 (1M) and DRAM (10M, 100M) on most desktop parts
+template<class Search>
+void RunSearchBenchmarks(BenchmarkReport& report, const BenchmarkOptions& options, const std::string& name) {
+	if (!options.IsSelected(name))
+		return;
+
+	for (size_t size : options.Sizes()) {
+		std::mt19937_64 rng(size);
+		std::vector<uint32_t> sorted(size);
+		for (uint32_t& key : sorted)
+			key = static_cast<uint32_t>(rng());
+		std::sort(sorted.begin(), sorted.end());
+
+		const size_t lookups = options.elementsPerSize;
+		std::vector<uint32_t> probes(lookups);
+		for (uint32_t& probe : probes)
+			probe = static_cast<uint32_t>(rng());
+
+		std::optional<typename Search::Table> table;
+		Measure(report, name, "build", size, size, [&]() {
+			table.emplace(Search::Build(sorted));
+		});
+		Measure(report, name, "lower_bound", size, lookups, [&]() {
+			uint64_t sum = 0;
+			for (uint32_t probe : probes)
+				sum += Search::LowerBound(*table, probe);
+			KeepAlive(sum);
+		});
+	}
+}
+
+void BenchmarkSearches(BenchmarkReport& report, const BenchmarkOptions& options) {
+	RunSearchBenchmarks<StdLowerBoundSearch>(report, options, "std::lower_bound");
+	RunSearchBenchmarks<BranchlessLowerBoundSearch>(report, options, "ads::BranchlessLowerBound");
+	RunSearchBenchmarks<EytzingerSearch>(report, options, "ads::EytzingerArray");
+	RunSearchBenchmarks<StaticBTreeSearch>(report, options, "ads::StaticBTree");
+}
+
+#endif // BENCHMARKS_SEARCH_BENCHMARKS_H
\ No newline at end of file
@@ -0,0 +1,152 @@
+#ifndef BENCHMARKS_SHORTEST_PATH_BENCHMARKS_H
+#define BENCHMARKS_SHORTEST_PATH_BENCHMARKS_H
+
+#include "pch.h"
+#include "algorithms/graph/astar.h"
+#include "algorithms/graph/csr_builder.h"
+#include "algorithms/graph/delta_stepping.h"
+#include "algorithms/graph/dijkstra.h"
+#include "algorithms/graph/graph_generators.h"
+#include "algorithms/thread_pool.h"
+#include "benchmarks/benchmark_harness.h"
+
+// the usual point to point Dijkstra, std::priority_queue with lazy deletion and fresh arrays every query
+uint64_t PriorityQueueDijkstra(const ads::CsrGraph<uint32_t>& graph, uint32_t source, uint32_t target) {
+	std::vector<uint64_t> distances(graph.VertexCount(), UINT64_MAX);
+	std::priority_queue<std::pair<uint64_t, uint32_t>, std::vector<std::pair<uint64_t, uint32_t>>, std::greater<>> queue;
+	distances[source] = 0;
+	queue.push({ 0, source });
+	while (!queue.empty()) {
+		const auto [distance, u] = queue.top();
+		queue.pop();
+		if (u == target)
+			return distance;
+		if (distance > distances[u])
+			continue;
+		const std::span<const uint32_t> neighbours = graph.OutNeighbors(u);
+		const std::span<const uint32_t> weights = graph.OutWeights(u);
+		for (size_t i = 0; i < neighbours.size(); ++i) {
+			if (distance + weights[i] < distances[neighbours[i]]) {
+				distances[neighbours[i]] = distance + weights[i];
+				queue.push({ distance + weights[i], neighbours[i] });
+			}
+		}
+	}
+	return UINT64_MAX;
+}
+
+// times every query on its own; ns/op is the mean latency and allocs/op the allocations per query, the _pN rows are latency
+// percentiles in ns, together a coarse histogram of the query times
+template<class Query>
+void MeasureQueryLatencies(BenchmarkReport& report, const std::string& name, const std::string& operation, size_t size,
+	const std::vector<std::pair<uint32_t, uint32_t>>& queries, Query&& query) {
+	std::vector<int64_t> latencies;
+	latencies.reserve(queries.size());
+	const AllocationSnapshot before = AllocationSnapshot::Take();
+	for (const auto& [source, target] : queries) {
+		const auto begin = std::chrono::steady_clock::now();
+		KeepAlive(query(source, target));
+		latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count());
+	}
+	const AllocationSnapshot delta = AllocationSnapshot::Take() - before;
+
+	const double count = static_cast<double>(std::max<size_t>(1, queries.size()));
+	const double total = static_cast<double>(std::accumulate(latencies.begin(), latencies.end(), int64_t(0)));
+	report.Add({ name, operation, size, queries.size(), total / count, delta.allocations / count, delta.frees / count, delta.bytes / count });
+	std::sort(latencies.begin(), latencies.end());
+	for (double percentile : { 50.0, 90.0, 99.0, 99.9 }) {
+		std::ostringstream label;
+		label << operation << "_p" << percentile;
+		report.Add({ name, label.str(), size, queries.size(), LatencyPercentile(latencies, percentile), 0.0, 0.0, 0.0 });
+	}
+}
+
+// random point to point queries on graph, then full single source runs where ns/op is per stored edge; heuristicWidth is the
+// grid width when A* can use the Manhattan bound and 0 otherwise, delta is the delta-stepping bucket width
+void RunShortestPathBenchmarks(BenchmarkReport& report, const BenchmarkOptions& options, const std::string& kind, const ads::CsrGraph<uint32_t>& graph,
+	uint32_t minWeight, uint32_t heuristicWidth, uint64_t delta) {
+	const size_t size = graph.VertexCount();
+	const size_t queryCount = std::clamp<size_t>(options.elementsPerSize / size, 16, 1000);
+	std::mt19937 rng(static_cast<uint32_t>(size));
+	std::vector<std::pair<uint32_t, uint32_t>> queries(queryCount);
+	for (auto& [source, target] : queries) {
+		source = static_cast<uint32_t>(rng() % size);
+		target = static_cast<uint32_t>(rng() % size);
+	}
+	const std::string queryOperation = kind + "_query";
+
+	if (options.IsSelected("std::priority_queue")) {
+		MeasureQueryLatencies(report, "std::priority_queue", queryOperation, size, queries, [&](uint32_t source, uint32_t target) {
+			return PriorityQueueDijkstra(graph, source, target);
+		});
+	}
+	// warmed up by one query so the rows show the steady state of a context kept across queries
+	ads::ShortestPathContext<uint32_t> context(size);
+	if (options.IsSelected("ads::Dijkstra<RadixHeap>")) {
+		ads::ShortestPaths<ads::DijkstraQueue::RadixHeap>(graph, queries.front().first, context);
+		MeasureQueryLatencies(report, "ads::Dijkstra<RadixHeap>", queryOperation, size, queries, [&](uint32_t source, uint32_t target) {
+			ads::ShortestPaths<ads::DijkstraQueue::RadixHeap>(graph, source, context, target);
+			return context.DistanceTo(target);
+		});
+	}
+	if (options.IsSelected("ads::Dijkstra<DaryHeap>")) {
+		ads::ShortestPaths<ads::DijkstraQueue::DaryHeap>(graph, queries.front().first, context);
+		MeasureQueryLatencies(report, "ads::Dijkstra<DaryHeap>", queryOperation, size, queries, [&](uint32_t source, uint32_t target) {
+			ads::ShortestPaths<ads::DijkstraQueue::DaryHeap>(graph, source, context, target);
+			return context.DistanceTo(target);
+		});
+	}
+	if (heuristicWidth != 0 && options.IsSelected("ads::AStar")) {
+		MeasureQueryLatencies(report, "ads::AStar", queryOperation, size, queries, [&](uint32_t source, uint32_t target) {
+			ads::FindPath(graph, source, target, ads::GridManhattanHeuristic<uint64_t>(heuristicWidth, target, minWeight), context);
+			return context.DistanceTo(target);
+		});
+	}
+
+	const size_t repetitions = options.RepetitionsFor(graph.EdgeCount());
+	const uint32_t source = queries.front().first;
+	const uint64_t ops = repetitions * graph.EdgeCount();
+	if (options.IsSelected("ads::Dijkstra<RadixHeap>")) {
+		Measure(report, "ads::Dijkstra<RadixHeap>", kind + "_sssp", size, ops, [&]() {
+			for (size_t rep = 0; rep < repetitions; ++rep) {
+				ads::ShortestPaths<ads::DijkstraQueue::RadixHeap>(graph, source, context);
+				KeepAlive(context.SettledCount());
+			}
+		});
+	}
+	if (options.IsSelected("ads::DeltaStepping")) {
+		std::vector<uint64_t> distances;
+		for (unsigned threadCount = 1; threadCount <= options.maxThreads; threadCount *= 2) {
+			ads::ThreadPool pool(threadCount);
+			Measure(report, "ads::DeltaStepping", kind + "_sssp_t" + std::to_string(threadCount), size, ops, [&]() {
+				for (size_t rep = 0; rep < repetitions; ++rep) {
+					ads::DeltaStepping<uint32_t>::Run(graph, source, pool, delta, distances);
+					KeepAlive(distances[size - 1]);
+				}
+			});
+		}
+	}
+}
+
+// sizes are vertex counts; grid is a square road-network-like lattice with weights 10 to 20, random is a uniform graph with
+// 8 undirected edges per vertex and weights 1 to 100
+void BenchmarkShortestPaths(BenchmarkReport& report, const BenchmarkOptions& options) {
+	// the same names the rows use, so a filter naming any one row still builds the graphs
+	const std::initializer_list<const char*> names = { "std::priority_queue", "ads::Dijkstra<RadixHeap>", "ads::Dijkstra<DaryHeap>", "ads::AStar", "ads::DeltaStepping" };
+	if (std::none_of(names.begin(), names.end(), [&options](const char* name) { return options.IsSelected(name); }))
+		return;
+
+	ads::ThreadPool pool(options.maxThreads);
+	for (size_t size : options.Sizes()) {
+		const uint32_t side = std::max<uint32_t>(2, static_cast<uint32_t>(std::sqrt(static_cast<double>(size))));
+		const std::vector<ads::CsrEdge<uint32_t>> gridEdges = ads::GraphGenerator::Weighted<uint32_t>(ads::GraphGenerator::Grid(side, side, pool), 10, 20, size, pool);
+		RunShortestPathBenchmarks(report, options, "grid", ads::BuildCsrGraph(side * side, gridEdges, pool, { .symmetrize = true }), 10, side, 64);
+
+		const uint32_t vertexCount = static_cast<uint32_t>(std::max<size_t>(size, 16));
+		const std::vector<ads::CsrEdge<uint32_t>> randomEdges = ads::GraphGenerator::Weighted<uint32_t>(
+			ads::GraphGenerator::Uniform(vertexCount, size_t(vertexCount) * 8, size, pool), 1, 100, size + 1, pool);
+		RunShortestPathBenchmarks(report, options, "random", ads::BuildCsrGraph(vertexCount, randomEdges, pool, { .symmetrize = true }), 1, 0, 32);
+	}
+}
+
+#endif // BENCHMARKS_SHORTEST_PATH_BENCHMARKS_H
\ No newline at end of file
@@ -0,0 +1,112 @@
+#ifndef BENCHMARKS_SKIP_LIST_BENCHMARKS_H
+#define BENCHMARKS_SKIP_LIST_BENCHMARKS_H
+
+#include "pch.h"
+#include "benchmarks/benchmark_harness.h"
+#include "data_structures/skip_list.h"
+
+/* mutex guarded std::map, the baseline the concurrent skip list replaces */
+template<class K, class V>
+class MutexMap {
+public:
+	bool Insert(const K& key, const V& val) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_map.emplace(key, val).second;
+	}
+
+	bool Contains(const K& key) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_map.find(key) != m_map.end();
+	}
+
+private:
+	std::mutex m_mutex;
+	std::map<K, V> m_map;
+};
+
+// starts threadCount threads together on fn(thread index) and returns the wall time until the last one finished
+template<class Fn>
+double RunOnThreads(unsigned threadCount, Fn fn) {
+	std::atomic<bool> start = false;
+	std::vector<std::thread> threads;
+	for (unsigned t = 0; t < threadCount; ++t) {
+		threads.emplace_back([&, t]() {
+			while (!start.load(std::memory_order_acquire)) {}
+			fn(t);
+		});
+	}
+	const auto begin = std::chrono::steady_clock::now();
+	start.store(true, std::memory_order_release);
+	for (std::thread& thread : threads)
+		thread.join();
+	return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+}
+
+// insert splits size shuffled keys between the threads, mixed then has every thread run 90% lookups and 10% inserts
+// of new keys against the filled map
+template<class Map>
+void RunOrderedMapScaling(BenchmarkReport& report, const BenchmarkOptions& options, const std::string& name, size_t size) {
+	if (!options.IsSelected(name))
+		return;
+
+	std::vector<uint64_t> keys(2 * size);
+	std::iota(keys.begin(), keys.end(), 0);
+	std::shuffle(keys.begin(), keys.end(), std::mt19937_64(size));
+
+	for (unsigned threadCount = 1; threadCount <= options.maxThreads; threadCount *= 2) {
+		const std::string suffix = "_t" + std::to_string(threadCount);
+		Map map;
+		const size_t perThread = size / threadCount;
+
+		AllocationSnapshot before = AllocationSnapshot::Take();
+		double ns = RunOnThreads(threadCount, [&](unsigned t) {
+			for (size_t i = t * perThread; i < (t + 1) * perThread; ++i)
+				map.Insert(keys[i], i);
+		});
+		AllocationSnapshot delta = AllocationSnapshot::Take() - before;
+		double ops = static_cast<double>(perThread * threadCount);
+		report.Add({ name, "insert" + suffix, size, perThread * threadCount, ns / ops, delta.allocations / ops, delta.frees / ops, delta.bytes / ops });
+
+		std::atomic<size_t> hits = 0;
+		before = AllocationSnapshot::Take();
+		ns = RunOnThreads(threadCount, [&](unsigned t) {
+			size_t found = 0;
+			size_t fresh = size + t * (perThread / 10);
+			for (size_t i = 0; i < perThread; ++i) {
+				if (i % 10 == 0)
+					map.Insert(keys[fresh++], i);
+				else
+					found += map.Contains(keys[(i * 7919 + t) % size]);
+			}
+			hits.fetch_add(found, std::memory_order_relaxed);
+		});
+		delta = AllocationSnapshot::Take() - before;
+		KeepAlive(hits.load());
+		report.Add({ name, "mixed_90_10" + suffix, size, perThread * threadCount, ns / ops, delta.allocations / ops, delta.frees / ops, delta.bytes / ops });
+	}
+}
+
+// the single threaded skip list has no thread safety to pay for, so it only runs as a one thread reference point
+void BenchmarkSkipLists(BenchmarkReport& report, const BenchmarkOptions& options, size_t size = 1000000) {
+	RunOrderedMapScaling<MutexMap<uint64_t, uint64_t>>(report, options, "mutex_std_map", size);
+	RunOrderedMapScaling<ads::ConcurrentSkipList<uint64_t, uint64_t>>(report, options, "ads::ConcurrentSkipList", size);
+
+	if (options.IsSelected("ads::SkipList")) {
+		std::vector<uint64_t> keys(size);
+		std::iota(keys.begin(), keys.end(), 0);
+		std::shuffle(keys.begin(), keys.end(), std::mt19937_64(size));
+		ads::SkipList<uint64_t, uint64_t> list;
+		Measure(report, "ads::SkipList", "insert_t1", size, size, [&]() {
+			for (size_t i = 0; i < size; ++i)
+				list.Insert(keys[i], i);
+		});
+		Measure(report, "ads::SkipList", "find_t1", size, size, [&]() {
+			size_t found = 0;
+			for (size_t i = 0; i < size; ++i)
+				found += list.Contains(keys[(i * 7919) % size]);
+			KeepAlive(found);
+		});
+	}
+}
+
+#endif // BENCHMARKS_SKIP_LIST_BENCHMARKS_H
\ No newline at end of file
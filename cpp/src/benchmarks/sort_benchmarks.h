@@ -0,0 +1,81 @@
+#ifndef BENCHMARKS_SORT_BENCHMARKS_H
+#define BENCHMARKS_SORT_BENCHMARKS_H
+
+#include "pch.h"
+#include "algorithms/sort/parallel_merge_sort.h"
+#include "algorithms/sort/pdq_sort.h"
+#include "algorithms/sort/radix_sort.h"
+#include "algorithms/thread_pool.h"
+#include "benchmarks/benchmark_harness.h"
+
+/* 16 byte element sorted on its key alone, stands in for sorting structs by one field */
+struct SortRecord {
+	uint64_t key;
+	uint64_t payload;
+};
+
+// times sort on a fresh copy of source for every repetition, the copies aren't counted; ns/op is per element
+template<class T, class Key, class SortFn>
+void MeasureSort(BenchmarkReport& report, const std::string& name, const std::string& operation, const std::vector<T>& source, Key key, size_t repetitions, SortFn&& sort) {
+	std::vector<T> values(source.size());
+	double ns = 0.0;
+	AllocationSnapshot allocations{};
+	for (size_t rep = 0; rep < repetitions; ++rep) {
+		std::copy(source.begin(), source.end(), values.begin());
+		const AllocationSnapshot before = AllocationSnapshot::Take();
+		const auto begin = std::chrono::steady_clock::now();
+		sort(values.begin(), values.end());
+		ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+		const AllocationSnapshot delta = AllocationSnapshot::Take() - before;
+		allocations.allocations += delta.allocations;
+		allocations.frees += delta.frees;
+		allocations.bytes += delta.bytes;
+	}
+	KeepAlive(values.empty() ? 0 : ads::RadixKeyBits(key(values[values.size() / 2])));
+
+	const double ops = static_cast<double>(std::max<size_t>(1, repetitions * source.size()));
+	report.Add({ name, operation, source.size(), repetitions * source.size(), ns / ops, allocations.allocations / ops, allocations.frees / ops, allocations.bytes / ops });
+}
+
+// runs every sort on the same random input, less orders the elements and key is what the radix sort reads
+template<class T, class Generate, class Less, class Key>
+void RunSortBenchmarks(BenchmarkReport& report, const BenchmarkOptions& options, const std::string& operation, Generate&& generate, Less less, Key key) {
+	for (size_t size : options.Sizes()) {
+		const size_t repetitions = options.RepetitionsFor(size);
+		std::mt19937_64 rng(size);
+		std::vector<T> source(size);
+		for (T& val : source)
+			val = generate(rng);
+
+		if (options.IsSelected("std::sort"))
+			MeasureSort(report, "std::sort", operation, source, key, repetitions, [&](auto first, auto last) { std::sort(first, last, less); });
+		if (options.IsSelected("std::stable_sort"))
+			MeasureSort(report, "std::stable_sort", operation, source, key, repetitions, [&](auto first, auto last) { std::stable_sort(first, last, less); });
+		if (options.IsSelected("ads::PdqSort"))
+			MeasureSort(report, "ads::PdqSort", operation, source, key, repetitions, [&](auto first, auto last) { ads::PdqSort(first, last, less); });
+		if (options.IsSelected("ads::RadixSort"))
+			MeasureSort(report, "ads::RadixSort", operation, source, key, repetitions, [&](auto first, auto last) { ads::RadixSort(first, last, key); });
+
+		// per core scaling, t1 is the plain sequential merge sort
+		if (options.IsSelected("ads::ParallelMergeSort")) {
+			for (unsigned threadCount = 1; threadCount <= options.maxThreads; threadCount *= 2) {
+				ads::ThreadPool pool(threadCount);
+				MeasureSort(report, "ads::ParallelMergeSort", operation + "_t" + std::to_string(threadCount), source, key, repetitions,
+					[&](auto first, auto last) { ads::ParallelMergeSort(first, last, pool, less); });
+			}
+		}
+	}
+}
+
+// random 32 bit integers, doubles spread over a wide range of exponents and 16 byte records keyed on 64 bits
+void BenchmarkSorts(BenchmarkReport& report, const BenchmarkOptions& options) {
+	RunSortBenchmarks<uint32_t>(report, options, "sort_u32", [](std::mt19937_64& rng) { return static_cast<uint32_t>(rng()); },
+		std::less<>(), std::identity());
+	RunSortBenchmarks<double>(report, options, "sort_f64", [](std::mt19937_64& rng) {
+			return std::ldexp(static_cast<double>(rng() >> 11) / 9007199254740992.0 - 0.5, static_cast<int>(rng() % 64) - 32);
+		}, std::less<>(), std::identity());
+	RunSortBenchmarks<SortRecord>(report, options, "sort_record", [](std::mt19937_64& rng) { return SortRecord{ rng(), 0 }; },
+		[](const SortRecord& a, const SortRecord& b) { return a.key < b.key; }, [](const SortRecord& r) { return r.key; });
+}
+
+#endif // BENCHMARKS_SORT_BENCHMARKS_H
\ No newline at end of file
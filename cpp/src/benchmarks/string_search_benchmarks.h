@@ -0,0 +1,108 @@
+#ifndef BENCHMARKS_STRING_SEARCH_BENCHMARKS_H
+#define BENCHMARKS_STRING_SEARCH_BENCHMARKS_H
+
+#include "pch.h"
+#include "algorithms/string/aho_corasick.h"
+#include "algorithms/string/substring_search.h"
+#include "algorithms/string/two_way_search.h"
+#include "benchmarks/benchmark_harness.h"
+
+// log lines made of random words from a small vocabulary, with needle planted about every 64KB so finds have something to report
+std::string MakeSearchBenchmarkText(size_t size, std::string_view needle, std::mt19937_64& rng) {
+	static const char* const words[] = { "INFO", "WARN", "DEBUG", "request", "user", "session", "took", "ms", "service", "auth",
+		"cache", "miss", "hit", "upstream", "connection", "opened", "closed", "retry", "timeout", "GET", "POST", "/api/v1/items", "200", "404" };
+	std::string text;
+	text.reserve(size + 64);
+	while (text.size() < size) {
+		if (rng() % 8192 == 0)
+			text += needle;
+		else
+			text += words[rng() % std::size(words)];
+		text += rng() % 12 == 0 ? '\n' : ' ';
+	}
+	text.resize(size);
+	return text;
+}
+
+// every benchmark counts all matches in the text, ops is bytes scanned so ns/op is ns per byte and GB/s is 1 / ns_per_op
+template<class Fn>
+void MeasureTextScan(BenchmarkReport& report, const BenchmarkOptions& options, const std::string& name, const std::string& operation, const std::string& text, Fn&& countMatches) {
+	if (!options.IsSelected(name))
+		return;
+	const size_t repetitions = options.RepetitionsFor(text.size());
+	Measure(report, name, operation, text.size(), repetitions * text.size(), [&]() {
+		size_t matches = 0;
+		for (size_t rep = 0; rep < repetitions; ++rep)
+			matches += countMatches(std::string_view(text));
+		KeepAlive(matches);
+	});
+}
+
+template<class Searcher>
+size_t CountWithSearcher(const Searcher& searcher, std::string_view text) {
+	size_t matches = 0;
+	for (size_t pos = searcher.Find(text); pos != std::string_view::npos; pos = searcher.Find(text, pos + 1))
+		++matches;
+	return matches;
+}
+
+void BenchmarkStringSearches(BenchmarkReport& report, const BenchmarkOptions& options) {
+	const std::string needle = "connection refused by upstream";
+	const size_t chunkSize = 64 * 1024;
+
+	for (size_t size : options.Sizes()) {
+		std::mt19937_64 rng(size);
+		const std::string text = MakeSearchBenchmarkText(size, needle, rng);
+
+		MeasureTextScan(report, options, "std::string_view::find", "find_all", text, [&](std::string_view t) {
+			size_t matches = 0;
+			for (size_t pos = t.find(needle); pos != std::string_view::npos; pos = t.find(needle, pos + 1))
+				++matches;
+			return matches;
+		});
+
+		const std::boyer_moore_horspool_searcher horspool(needle.begin(), needle.end());
+		MeasureTextScan(report, options, "std::boyer_moore_horspool", "find_all", text, [&](std::string_view t) {
+			size_t matches = 0;
+			for (auto it = std::search(t.begin(), t.end(), horspool); it != t.end(); it = std::search(it + 1, t.end(), horspool))
+				++matches;
+			return matches;
+		});
+
+		const ads::SubstringSearcher simd(needle);
+		MeasureTextScan(report, options, "ads::SubstringSearcher", "find_all", text, [&](std::string_view t) { return CountWithSearcher(simd, t); });
+
+		const ads::TwoWaySearcher twoWay(needle);
+		MeasureTextScan(report, options, "ads::TwoWaySearcher", "find_all", text, [&](std::string_view t) { return CountWithSearcher(twoWay, t); });
+
+		// same search fed in 64KB chunks, what a log reader would do
+		MeasureTextScan(report, options, "ads::StreamingSearch", "find_all_64k", text, [&](std::string_view t) {
+			ads::StreamingSearch<ads::SubstringSearcher> stream(simd);
+			size_t matches = 0;
+			for (size_t begin = 0; begin < t.size(); begin += chunkSize)
+				stream.Feed(t.substr(begin, chunkSize), [&matches](uint64_t) { ++matches; });
+			return matches;
+		});
+
+		// the needle plus keywords of 6 to 20 random lowercase letters, which like real filter terms almost never occur, so this
+		// measures the automaton walk rather than match reporting
+		for (size_t patternCount : { size_t(10), size_t(1000), size_t(10000) }) {
+			std::vector<std::string> patterns = { needle };
+			std::mt19937_64 patternRng(patternCount);
+			while (patterns.size() < patternCount) {
+				std::string pattern(6 + patternRng() % 15, 'a');
+				for (char& c : pattern)
+					c = static_cast<char>('a' + patternRng() % 26);
+				patterns.push_back(std::move(pattern));
+			}
+			const ads::AhoCorasick automaton(patterns);
+			MeasureTextScan(report, options, "ads::AhoCorasick", "scan_p" + std::to_string(patternCount), text, [&](std::string_view t) {
+				size_t matches = 0;
+				automaton.FindAll(t, [&matches](size_t, uint64_t) { ++matches; });
+				return matches;
+			});
+		}
+	}
+}
+
+#endif // BENCHMARKS_STRING_SEARCH_BENCHMARKS_H
\ No newline at end of file
@@ -0,0 +1,406 @@
+#ifndef DATA_STRUCTURES_ARRAY_LINKED_LIST_H
+#define DATA_STRUCTURES_ARRAY_LINKED_LIST_H
+
+#include "pch.h"
+#include "data_structures/container_stats.h"
+
+namespace ads {
+
+/* doubly linked list whose nodes live in one growable array and link to each other by 32 bit index, freed slots are reused through an internal free list */
+template<class T, class Alloc = std::allocator<T>, class StatsPolicy = NoStats>
+class ArrayLinkedList {
+public:
+	static constexpr uint32_t nullIndex = UINT32_MAX;
+
+	// trivial, so a freshly allocated array of nodes needs no per-node construction
+	struct Node {
+		T& Value()				{ return *std::launder(reinterpret_cast<T*>(storage)); }
+		const T& Value() const	{ return *std::launder(reinterpret_cast<const T*>(storage)); }
+
+		uint32_t next;		// next free slot while the node is on the free list
+		uint32_t prev;
+		alignas(T) std::byte storage[sizeof(T)];	// only live while the node is linked into the list
+	};
+
+	using NodeAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+	using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+	/* bidirectional iterator holding the list and an index, so it stays valid when the array grows */
+	template<bool IsConst>
+	class IndexIterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = std::conditional_t<IsConst, const T*, T*>;
+		using reference = std::conditional_t<IsConst, const T&, T&>;
+		using ListPointer = std::conditional_t<IsConst, const ArrayLinkedList*, ArrayLinkedList*>;
+
+		IndexIterator() : m_pList(nullptr), m_index(nullIndex) {}
+
+		IndexIterator(ListPointer pList, uint32_t index) : m_pList(pList), m_index(index) {}
+
+		// iterator -> const_iterator
+		template<bool OtherConst> requires (IsConst && !OtherConst)
+		IndexIterator(const IndexIterator<OtherConst>& other) : m_pList(other.GetList()), m_index(other.GetIndex()) {}
+
+		ListPointer GetList() const	{ return m_pList; }
+		uint32_t GetIndex() const	{ return m_index; }
+
+		reference operator*() const	{ return m_pList->m_nodes[m_index].Value(); }
+		pointer operator->() const	{ return &m_pList->m_nodes[m_index].Value(); }
+
+		IndexIterator& operator++() {
+			m_index = m_pList->m_nodes[m_index].next;
+			return *this;
+		}
+
+		IndexIterator operator++(int) {
+			IndexIterator temp = *this;
+			++*this;
+			return temp;
+		}
+
+		IndexIterator& operator--() {
+			m_index = m_index == nullIndex ? m_pList->m_tail : m_pList->m_nodes[m_index].prev;
+			return *this;
+		}
+
+		IndexIterator operator--(int) {
+			IndexIterator temp = *this;
+			--*this;
+			return temp;
+		}
+
+		template<bool OtherConst>
+		bool operator==(const IndexIterator<OtherConst>& other) const { return m_index == other.GetIndex(); }
+
+	private:
+		ListPointer m_pList;
+		uint32_t m_index;
+	};
+
+	using value_type = T;
+	using iterator = IndexIterator<false>;
+	using const_iterator = IndexIterator<true>;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+
+	ArrayLinkedList() : m_nodes(nullptr), m_capacity(0), m_used(0), m_size(0), m_head(nullIndex), m_tail(nullIndex), m_free(nullIndex) {}
+
+	explicit ArrayLinkedList(const Alloc& alloc)
+		: m_nodes(nullptr), m_capacity(0), m_used(0), m_size(0), m_head(nullIndex), m_tail(nullIndex), m_free(nullIndex), m_alloc(alloc) {}
+
+	// the copy is compacted, its nodes sit in list order
+	ArrayLinkedList(const ArrayLinkedList& other)
+		: m_nodes(nullptr), m_capacity(0), m_used(0), m_size(0), m_head(nullIndex), m_tail(nullIndex), m_free(nullIndex),
+		m_alloc(NodeTraits::select_on_container_copy_construction(other.m_alloc)) {
+		Reserve(other.m_size);
+		for (const T& val : other)
+			Append(val);
+	}
+
+	// steals other's array, other is left empty
+	ArrayLinkedList(ArrayLinkedList&& other) noexcept
+		: m_nodes(other.m_nodes), m_capacity(other.m_capacity), m_used(other.m_used), m_size(other.m_size),
+		m_head(other.m_head), m_tail(other.m_tail), m_free(other.m_free), m_alloc(std::move(other.m_alloc)) {
+		m_stats.SwapLive(other.m_stats);
+		other.ResetEmpty();
+	}
+
+	~ArrayLinkedList() {
+		Clear();
+		FreeArray();
+	}
+
+	ArrayLinkedList& operator=(const ArrayLinkedList& other) {
+		if (this != &other) {
+			Clear();
+			Reserve(other.m_size);
+			for (const T& val : other)
+				Append(val);
+		}
+		return *this;
+	}
+
+	ArrayLinkedList& operator=(ArrayLinkedList&& other) noexcept(NodeTraits::propagate_on_container_move_assignment::value || NodeTraits::is_always_equal::value) {
+		if (this == &other)
+			return *this;
+
+		Clear();
+		if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+			FreeArray();
+			m_alloc = std::move(other.m_alloc);
+		} else if (!(m_alloc == other.m_alloc)) {
+			// other's array can't be freed through m_alloc, so move the values instead
+			Reserve(other.m_size);
+			for (T& val : other)
+				Append(std::move(val));
+			other.Clear();
+			return *this;
+		} else {
+			FreeArray();
+		}
+		m_nodes = other.m_nodes;
+		m_capacity = other.m_capacity;
+		m_used = other.m_used;
+		m_size = other.m_size;
+		m_head = other.m_head;
+		m_tail = other.m_tail;
+		m_free = other.m_free;
+		m_stats.SwapLive(other.m_stats);
+		other.ResetEmpty();
+		return *this;
+	}
+
+	// indices of the first and last node, nullIndex when empty
+	uint32_t Head() const	{ return m_head; }
+	uint32_t Tail() const	{ return m_tail; }
+
+	// index stays valid until the node is removed, even when the array grows
+	Node& GetNode(uint32_t index)				{ return m_nodes[index]; }
+	const Node& GetNode(uint32_t index) const	{ return m_nodes[index]; }
+
+	size_t Size() const		{ return m_size; }
+	bool IsEmpty() const	{ return m_size == 0; }
+	size_t Capacity() const	{ return m_capacity; }
+
+	NodeAllocator GetAllocator() const { return m_alloc; }
+
+	// always zero unless StatsPolicy counts, one allocation per array growth
+	ContainerStats Stats() const	{ return m_stats.Get(); }
+	void ResetStats()				{ m_stats.Reset(); }
+
+	iterator begin()						{ return iterator(this, m_head); }
+	iterator end()							{ return iterator(this, nullIndex); }
+	const_iterator begin() const			{ return const_iterator(this, m_head); }
+	const_iterator end() const				{ return const_iterator(this, nullIndex); }
+	const_iterator cbegin() const			{ return const_iterator(this, m_head); }
+	const_iterator cend() const				{ return const_iterator(this, nullIndex); }
+	reverse_iterator rbegin()				{ return reverse_iterator(end()); }
+	reverse_iterator rend()					{ return reverse_iterator(begin()); }
+	const_reverse_iterator rbegin() const	{ return const_reverse_iterator(end()); }
+	const_reverse_iterator rend() const		{ return const_reverse_iterator(begin()); }
+
+	// grows the array so count nodes fit without another reallocation
+	void Reserve(size_t count) {
+		if (count > m_capacity)
+			Reallocate(count, false);
+	}
+
+	// destroys every value, the array is kept for reuse
+	void Clear() {
+		for (uint32_t iter = m_head; iter != nullIndex; iter = m_nodes[iter].next)
+			std::destroy_at(&m_nodes[iter].Value());
+		m_used = 0;
+		m_size = 0;
+		m_head = nullIndex;
+		m_tail = nullIndex;
+		m_free = nullIndex;
+	}
+
+	// moves the nodes into list order at the front of a right sized array, so traversal is a sequential sweep again
+	void Compact() {
+		Reallocate(m_size, true);
+	}
+
+	// adds a new node to the end of the list
+	void Append(const T& val)	{ EmplaceBack(val); }
+	void Append(T&& val)		{ EmplaceBack(std::move(val)); }
+
+	// adds a new node to the head of the list
+	void Prepend(const T& val)	{ EmplaceFront(val); }
+	void Prepend(T&& val)		{ EmplaceFront(std::move(val)); }
+
+	// constructs a new value in place at the end of the list
+	template<class... Args>
+	T& EmplaceBack(Args&&... args) {
+		const uint32_t index = CreateNode(std::forward<Args>(args)...);
+		Node& node = m_nodes[index];
+		node.prev = m_tail;
+		node.next = nullIndex;
+		if (m_tail != nullIndex)
+			m_nodes[m_tail].next = index;
+		else
+			m_head = index;
+		m_tail = index;
+		return node.Value();
+	}
+
+	// constructs a new value in place at the head of the list
+	template<class... Args>
+	T& EmplaceFront(Args&&... args) {
+		const uint32_t index = CreateNode(std::forward<Args>(args)...);
+		Node& node = m_nodes[index];
+		node.prev = nullIndex;
+		node.next = m_head;
+		if (m_head != nullIndex)
+			m_nodes[m_head].prev = index;
+		else
+			m_tail = index;
+		m_head = index;
+		return node.Value();
+	}
+
+	// unlinks and destroys the node at pos, returns the node after it
+	iterator Erase(const_iterator pos) {
+		const uint32_t index = pos.GetIndex();
+		const uint32_t next = m_nodes[index].next;
+		Unlink(index);
+		DestroyNode(index);
+		return iterator(this, next);
+	}
+
+	// remove all nodes with value
+	void Remove(const T& val) {
+		RemoveAll(val);
+	}
+
+	// removes every node equal to val, returns how many were removed
+	size_t RemoveAll(const T& val) {
+		return RemoveIf([&val](const T& other) { return other == val; });
+	}
+
+	// removes every node pred returns true for in one pass, returns how many were removed
+	template<class Pred>
+	size_t RemoveIf(Pred pred) {
+		size_t removed = 0;
+		uint32_t iter = m_head;
+		while (iter != nullIndex) {
+			const uint32_t next = m_nodes[iter].next;
+			m_stats.OnVisit();
+			if (pred(m_nodes[iter].Value())) {
+				Unlink(iter);
+				DestroyNode(iter);
+				++removed;
+			}
+			iter = next;
+		}
+		return removed;
+	}
+
+private:
+	// takes a slot from the free list, then from the unused end of the array, growing it when both are exhausted
+	template<class... Args>
+	uint32_t CreateNode(Args&&... args) {
+		uint32_t index;
+		if (m_free != nullIndex) {
+			index = m_free;
+			::new (static_cast<void*>(m_nodes[index].storage)) T(std::forward<Args>(args)...);
+			m_free = m_nodes[index].next;
+		} else if (m_used == m_capacity) {
+			// args may refer to a value in the array that growing frees, so build the value before moving it into the new one
+			T value(std::forward<Args>(args)...);
+			Reallocate(std::clamp<size_t>(m_capacity * 2, 16, m_capacity < nullIndex ? nullIndex : m_capacity + 1), false);
+			index = m_used;
+			::new (static_cast<void*>(m_nodes[index].storage)) T(std::move(value));
+			++m_used;
+		} else {
+			index = m_used;
+			::new (static_cast<void*>(m_nodes[index].storage)) T(std::forward<Args>(args)...);
+			++m_used;
+		}
+		++m_size;
+		return index;
+	}
+
+	// the node must already be unlinked
+	void DestroyNode(uint32_t index) {
+		std::destroy_at(&m_nodes[index].Value());
+		m_nodes[index].next = m_free;
+		m_nodes[index].prev = nullIndex;
+		m_free = index;
+		--m_size;
+	}
+
+	void Unlink(uint32_t index) {
+		const Node& node = m_nodes[index];
+		if (node.prev != nullIndex)
+			m_nodes[node.prev].next = node.next;
+		else
+			m_head = node.next;
+		if (node.next != nullIndex)
+			m_nodes[node.next].prev = node.prev;
+		else
+			m_tail = node.prev;
+	}
+
+	// moves every live value into a new array of capacity nodes, either keeping each node's index or laying the nodes out in list order
+	void Reallocate(size_t capacity, bool compact) {
+		if (capacity > nullIndex)
+			throw std::length_error("ArrayLinkedList can't index more than 2^32 - 1 nodes");
+
+		Node* nodes = capacity > 0 ? NodeTraits::allocate(m_alloc, capacity) : nullptr;
+		if (nodes != nullptr)
+			m_stats.OnAllocate(capacity * sizeof(Node));
+
+		if (compact) {
+			uint32_t index = 0;
+			for (uint32_t iter = m_head; iter != nullIndex; iter = m_nodes[iter].next, ++index) {
+				::new (static_cast<void*>(nodes[index].storage)) T(std::move_if_noexcept(m_nodes[iter].Value()));
+				std::destroy_at(&m_nodes[iter].Value());
+				nodes[index].prev = index - 1;
+				nodes[index].next = index + 1;
+			}
+			m_used = index;
+			m_head = index > 0 ? 0 : nullIndex;
+			m_tail = index > 0 ? index - 1 : nullIndex;
+			m_free = nullIndex;
+			if (index > 0) {
+				nodes[0].prev = nullIndex;
+				nodes[index - 1].next = nullIndex;
+			}
+		} else if constexpr (std::is_trivially_copyable_v<T>) {
+			if (m_used > 0)
+				std::memcpy(static_cast<void*>(nodes), m_nodes, m_used * sizeof(Node));
+		} else {
+			// free slots carry no value but their links still thread the free list
+			for (uint32_t i = 0; i < m_used; ++i) {
+				nodes[i].next = m_nodes[i].next;
+				nodes[i].prev = m_nodes[i].prev;
+			}
+			for (uint32_t iter = m_head; iter != nullIndex; iter = m_nodes[iter].next) {
+				::new (static_cast<void*>(nodes[iter].storage)) T(std::move_if_noexcept(m_nodes[iter].Value()));
+				std::destroy_at(&m_nodes[iter].Value());
+			}
+		}
+
+		FreeArray();
+		m_nodes = nodes;
+		m_capacity = capacity;
+	}
+
+	void FreeArray() {
+		if (m_nodes != nullptr) {
+			NodeTraits::deallocate(m_alloc, m_nodes, m_capacity);
+			m_stats.OnFree(m_capacity * sizeof(Node));
+		}
+		m_nodes = nullptr;
+		m_capacity = 0;
+	}
+
+	void ResetEmpty() {
+		m_nodes = nullptr;
+		m_capacity = 0;
+		m_used = 0;
+		m_size = 0;
+		m_head = nullIndex;
+		m_tail = nullIndex;
+		m_free = nullIndex;
+	}
+
+	Node* m_nodes;
+	size_t m_capacity;
+	uint32_t m_used;	// slots below this have been handed out at least once
+	size_t m_size;
+	uint32_t m_head;
+	uint32_t m_tail;
+	uint32_t m_free;	// head of the free list, threaded through Node::next
+	NodeAllocator m_alloc;
+	ADS_NO_UNIQUE_ADDRESS StatsPolicy m_stats;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_ARRAY_LINKED_LIST_H
\ No newline at end of file
@@ -0,0 +1,110 @@
+#ifndef DATA_STRUCTURES_BOUNDED_MPMC_QUEUE_H
+#define DATA_STRUCTURES_BOUNDED_MPMC_QUEUE_H
+
+#include "pch.h"
+#include "data_structures/cache_line.h"
+
+namespace ads {
+
+/* lock-free bounded multi producer multi consumer ring (Vyukov), every cell carries a sequence number so producers and consumers only contend on their own counter */
+template<class T>
+class BoundedMpmcQueue {
+public:
+	struct Cell {
+		T* Value() { return std::launder(reinterpret_cast<T*>(storage)); }
+
+		std::atomic<size_t> sequence;
+		alignas(T) std::byte storage[sizeof(T)];
+	};
+
+
+	// capacity is rounded up to a power of two
+	explicit BoundedMpmcQueue(size_t capacity) : m_mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1), m_cells(new Cell[m_mask + 1]) {
+		for (size_t i = 0; i <= m_mask; ++i)
+			m_cells[i].sequence.store(i, std::memory_order_relaxed);
+		m_enqueuePos.store(0, std::memory_order_relaxed);
+		m_dequeuePos.store(0, std::memory_order_relaxed);
+	}
+
+	BoundedMpmcQueue(const BoundedMpmcQueue&) = delete;
+	BoundedMpmcQueue& operator=(const BoundedMpmcQueue&) = delete;
+
+	// must not race any other operation
+	~BoundedMpmcQueue() {
+		const size_t end = m_enqueuePos.load(std::memory_order_relaxed);
+		for (size_t pos = m_dequeuePos.load(std::memory_order_relaxed); pos != end; ++pos)
+			std::destroy_at(m_cells[pos & m_mask].Value());
+	}
+
+	size_t Capacity() const { return m_mask + 1; }
+
+	// only a snapshot when other threads are pushing or popping, claimed cells count even before their value is written
+	size_t Size() const {
+		const size_t dequeued = m_dequeuePos.load(std::memory_order_acquire);
+		const size_t enqueued = m_enqueuePos.load(std::memory_order_acquire);
+		return std::min(enqueued - std::min(enqueued, dequeued), Capacity());
+	}
+
+	bool TryPush(const T& val)	{ return TryEmplace(val); }
+	bool TryPush(T&& val)		{ return TryEmplace(std::move(val)); }
+
+	// returns false without constructing anything if the ring is full
+	template<class... Args>
+	bool TryEmplace(Args&&... args) {
+		size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+		Cell* cell;
+		while (true) {
+			cell = &m_cells[pos & m_mask];
+			const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+			if (diff == 0) {
+				// cell is free for this lap, claim it
+				if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			} else if (diff < 0) {
+				// consumer hasn't freed the cell from the previous lap
+				return false;
+			} else {
+				pos = m_enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+		::new (static_cast<void*>(cell->storage)) T(std::forward<Args>(args)...);
+		cell->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	// moves the oldest value into out, returns false if the ring was empty
+	bool TryPop(T& out) {
+		size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+		Cell* cell;
+		while (true) {
+			cell = &m_cells[pos & m_mask];
+			const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+			if (diff == 0) {
+				if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			} else if (diff < 0) {
+				// producer hasn't filled the cell yet
+				return false;
+			} else {
+				pos = m_dequeuePos.load(std::memory_order_relaxed);
+			}
+		}
+		out = std::move(*cell->Value());
+		std::destroy_at(cell->Value());
+		// free the cell for the producer one lap ahead
+		cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+		return true;
+	}
+
+private:
+	const size_t m_mask;
+	std::unique_ptr<Cell[]> m_cells;
+	alignas(cacheLineSize) std::atomic<size_t> m_enqueuePos;
+	alignas(cacheLineSize) std::atomic<size_t> m_dequeuePos;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_BOUNDED_MPMC_QUEUE_H
\ No newline at end of file
@@ -0,0 +1,105 @@
+#ifndef DATA_STRUCTURES_BOUNDED_SPSC_QUEUE_H
+#define DATA_STRUCTURES_BOUNDED_SPSC_QUEUE_H
+
+#include "pch.h"
+#include "data_structures/cache_line.h"
+
+namespace ads {
+
+/* wait-free bounded single producer single consumer ring, each side owns one index and keeps a cached copy of the other's,
+   so the shared line is only read when the cached copy says the ring looks full or empty */
+template<class T>
+class BoundedSpscQueue {
+public:
+	struct Cell {
+		T* Value() { return std::launder(reinterpret_cast<T*>(storage)); }
+
+		alignas(T) std::byte storage[sizeof(T)];
+	};
+
+
+	// capacity is rounded up to a power of two
+	explicit BoundedSpscQueue(size_t capacity) : m_mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1), m_cells(new Cell[m_mask + 1]) {
+		m_tail.store(0, std::memory_order_relaxed);
+		m_cachedHead = 0;
+		m_head.store(0, std::memory_order_relaxed);
+		m_cachedTail = 0;
+	}
+
+	BoundedSpscQueue(const BoundedSpscQueue&) = delete;
+	BoundedSpscQueue& operator=(const BoundedSpscQueue&) = delete;
+
+	// must not race any other operation
+	~BoundedSpscQueue() {
+		const size_t end = m_tail.load(std::memory_order_relaxed);
+		for (size_t pos = m_head.load(std::memory_order_relaxed); pos != end; ++pos)
+			std::destroy_at(m_cells[pos & m_mask].Value());
+	}
+
+	size_t Capacity() const { return m_mask + 1; }
+
+	// only a snapshot when the other side is active
+	size_t Size() const {
+		return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+	}
+
+	bool TryPush(const T& val)	{ return TryEmplace(val); }
+	bool TryPush(T&& val)		{ return TryEmplace(std::move(val)); }
+
+	// producer thread only, returns false without constructing anything if the ring is full
+	template<class... Args>
+	bool TryEmplace(Args&&... args) {
+		const size_t tail = m_tail.load(std::memory_order_relaxed);
+		if (tail - m_cachedHead > m_mask) {
+			m_cachedHead = m_head.load(std::memory_order_acquire);
+			if (tail - m_cachedHead > m_mask)
+				return false;
+		}
+		::new (static_cast<void*>(m_cells[tail & m_mask].storage)) T(std::forward<Args>(args)...);
+		m_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	// consumer thread only, moves the oldest value into out, returns false if the ring was empty
+	bool TryPop(T& out) {
+		const size_t head = m_head.load(std::memory_order_relaxed);
+		if (head == m_cachedTail) {
+			m_cachedTail = m_tail.load(std::memory_order_acquire);
+			if (head == m_cachedTail)
+				return false;
+		}
+		T* value = m_cells[head & m_mask].Value();
+		out = std::move(*value);
+		std::destroy_at(value);
+		m_head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	// consumer thread only, moves up to maxCount values into out and publishes the freed cells once, returns how many were moved
+	size_t TryPop(T* out, size_t maxCount) {
+		const size_t head = m_head.load(std::memory_order_relaxed);
+		if (m_cachedTail - head < maxCount)
+			m_cachedTail = m_tail.load(std::memory_order_acquire);
+		const size_t count = std::min(maxCount, m_cachedTail - head);
+		for (size_t i = 0; i < count; ++i) {
+			T* value = m_cells[(head + i) & m_mask].Value();
+			out[i] = std::move(*value);
+			std::destroy_at(value);
+		}
+		if (count > 0)
+			m_head.store(head + count, std::memory_order_release);
+		return count;
+	}
+
+private:
+	const size_t m_mask;
+	std::unique_ptr<Cell[]> m_cells;
+	alignas(cacheLineSize) std::atomic<size_t> m_tail;	// written by the producer
+	size_t m_cachedHead;								// producer's last view of m_head
+	alignas(cacheLineSize) std::atomic<size_t> m_head;	// written by the consumer
+	size_t m_cachedTail;								// consumer's last view of m_tail
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_BOUNDED_SPSC_QUEUE_H
\ No newline at end of file
@@ -0,0 +1,715 @@
+#ifndef DATA_STRUCTURES_BTREE_MAP_H
+#define DATA_STRUCTURES_BTREE_MAP_H
+
+#include "pch.h"
+#include "data_structures/cache_line.h"
+#include "data_structures/container_stats.h"
+#include "data_structures/simd.h"
+
+namespace ads {
+
+// index of the first of count sorted keys that is not less than key, 32 and 64 bit integers are compared a vector at a time
+template<class K>
+uint32_t NodeLowerBound(const K* keys, uint32_t count, const K& key) {
+	uint32_t i = 0;
+	[[maybe_unused]] bool vectorised = false;
+	if constexpr (std::is_integral_v<K> && sizeof(K) == 4) {
+		// unsigned keys are flipped into signed order, the lane compares are signed
+		[[maybe_unused]] const int32_t flip = std::is_signed_v<K> ? 0 : INT32_MIN;
+#if defined(ADS_AVX2)
+		const __m256i bias = _mm256_set1_epi32(flip);
+		const __m256i needle = _mm256_set1_epi32(static_cast<int32_t>(key) ^ flip);
+		for (; i + 8 <= count; i += 8) {
+			const __m256i block = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), bias);
+			const uint32_t less = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(needle, block))));
+			// sorted keys make the mask a run of low bits, anything short of all set ends the search
+			if (less != 0xFF)
+				return i + std::popcount(less);
+		}
+		vectorised = true;
+#elif defined(ADS_SSE2)
+		const __m128i bias = _mm_set1_epi32(flip);
+		const __m128i needle = _mm_set1_epi32(static_cast<int32_t>(key) ^ flip);
+		for (; i + 4 <= count; i += 4) {
+			const __m128i block = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)), bias);
+			const uint32_t less = static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(needle, block))));
+			if (less != 0xF)
+				return i + std::popcount(less);
+		}
+		vectorised = true;
+#endif
+	} else if constexpr (std::is_integral_v<K> && sizeof(K) == 8) {
+		[[maybe_unused]] const int64_t flip = std::is_signed_v<K> ? 0 : INT64_MIN;
+#if defined(ADS_AVX2)
+		const __m256i bias = _mm256_set1_epi64x(flip);
+		const __m256i needle = _mm256_set1_epi64x(static_cast<int64_t>(key) ^ flip);
+		for (; i + 4 <= count; i += 4) {
+			const __m256i block = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), bias);
+			const uint32_t less = static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(needle, block))));
+			if (less != 0xF)
+				return i + std::popcount(less);
+		}
+		vectorised = true;
+#elif defined(ADS_SSE42)
+		const __m128i bias = _mm_set1_epi64x(flip);
+		const __m128i needle = _mm_set1_epi64x(static_cast<int64_t>(key) ^ flip);
+		for (; i + 2 <= count; i += 2) {
+			const __m128i block = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)), bias);
+			const uint32_t less = static_cast<uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(needle, block))));
+			if (less != 0x3)
+				return i + std::popcount(less);
+		}
+		vectorised = true;
+#endif
+	}
+
+	if (vectorised) {
+		// fewer keys left than one vector holds
+		while (i < count && keys[i] < key)
+			++i;
+		return i;
+	}
+
+	// branchless binary search, the loop only depends on count so it compiles to conditional moves
+	const K* base = keys;
+	for (uint32_t length = count; length > 1;) {
+		const uint32_t half = length / 2;
+		base = base[half - 1] < key ? base + half : base;
+		length -= half;
+	}
+	return static_cast<uint32_t>(base - keys) + (count > 0 && *base < key);
+}
+
+
+/* in-memory B+ tree, inner nodes hold only separators and every value lives in a leaf, leaves are chained so range scans
+   walk them sequentially, NodeBytes sizes both node kinds so they can be tuned to a few cache lines or a page */
+template<class K, class V, size_t NodeBytes = 512, class StatsPolicy = NoStats>
+class BTreeMap {
+	static_assert(std::is_default_constructible_v<K> && std::is_default_constructible_v<V>, "node arrays default construct their unused slots");
+
+	static constexpr size_t nodeHeaderBytes = 16;
+
+public:
+	static constexpr uint32_t leafSlots = static_cast<uint32_t>(std::max<size_t>(4, (NodeBytes - nodeHeaderBytes) / (sizeof(K) + sizeof(V))));
+	static constexpr uint32_t innerSlots = static_cast<uint32_t>(std::max<size_t>(4, (NodeBytes - nodeHeaderBytes) / (sizeof(K) + sizeof(void*))));
+	static constexpr uint32_t minLeafCount = leafSlots / 2;
+	static constexpr uint32_t minInnerCount = innerSlots / 2;
+	static constexpr size_t maxHeight = 48;	// even at the minimum fanout of 3 this outgrows any address space
+
+	struct Node {
+		uint32_t count = 0;		// values in a leaf, separator keys in an inner node
+	};
+
+	struct alignas(cacheLineSize) Leaf : Node {
+		Leaf* next = nullptr;
+		K keys[leafSlots];
+		V values[leafSlots];
+	};
+
+	/* children[i] holds the keys below keys[i], children[i + 1] those from keys[i] up */
+	struct alignas(cacheLineSize) Inner : Node {
+		K keys[innerSlots];
+		Node* children[innerSlots + 1];
+	};
+
+	/* forward iterator over the leaf chain, dereferences to a pair of references into the leaf's key and value arrays */
+	template<bool IsConst>
+	class LeafIterator {
+	public:
+		using LeafPointer = std::conditional_t<IsConst, const Leaf*, Leaf*>;
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = std::pair<K, V>;
+		using difference_type = std::ptrdiff_t;
+		using reference = std::pair<const K&, std::conditional_t<IsConst, const V&, V&>>;
+
+		LeafIterator() : m_leaf(nullptr), m_index(0) {}
+
+		LeafIterator(LeafPointer leaf, uint32_t index) : m_leaf(leaf), m_index(index) {}
+
+		// iterator -> const_iterator
+		template<bool OtherConst> requires (IsConst && !OtherConst)
+		LeafIterator(const LeafIterator<OtherConst>& other) : m_leaf(other.GetLeaf()), m_index(other.GetIndex()) {}
+
+		LeafPointer GetLeaf() const	{ return m_leaf; }
+		uint32_t GetIndex() const	{ return m_index; }
+
+		const K& Key() const	{ return m_leaf->keys[m_index]; }
+		auto& Value() const		{ return m_leaf->values[m_index]; }
+
+		reference operator*() const { return reference(m_leaf->keys[m_index], m_leaf->values[m_index]); }
+
+		LeafIterator& operator++() {
+			if (++m_index == m_leaf->count) {
+				m_leaf = m_leaf->next;
+				m_index = 0;
+			}
+			return *this;
+		}
+
+		LeafIterator operator++(int) {
+			LeafIterator temp = *this;
+			++*this;
+			return temp;
+		}
+
+		template<bool OtherConst>
+		bool operator==(const LeafIterator<OtherConst>& other) const { return m_leaf == other.GetLeaf() && m_index == other.GetIndex(); }
+
+	private:
+		LeafPointer m_leaf;
+		uint32_t m_index;
+	};
+
+	// inserting or erasing invalidates every iterator, values move between leaves on splits and merges
+	using iterator = LeafIterator<false>;
+	using const_iterator = LeafIterator<true>;
+
+
+	BTreeMap() : m_root(nullptr), m_first(nullptr), m_height(0), m_size(0) {}
+
+	BTreeMap(const BTreeMap& other) : BTreeMap() {
+		BulkLoad(other.begin(), other.end());
+	}
+
+	BTreeMap(BTreeMap&& other) noexcept : m_root(other.m_root), m_first(other.m_first), m_height(other.m_height), m_size(other.m_size) {
+		other.m_root = nullptr;
+		other.m_first = nullptr;
+		other.m_height = 0;
+		other.m_size = 0;
+		m_stats.SwapLive(other.m_stats);
+	}
+
+	~BTreeMap() {
+		Clear();
+	}
+
+	BTreeMap& operator=(const BTreeMap& other) {
+		if (this != &other)
+			BulkLoad(other.begin(), other.end());
+		return *this;
+	}
+
+	BTreeMap& operator=(BTreeMap&& other) noexcept {
+		if (this != &other) {
+			Clear();
+			std::swap(m_root, other.m_root);
+			std::swap(m_first, other.m_first);
+			std::swap(m_height, other.m_height);
+			std::swap(m_size, other.m_size);
+			m_stats.SwapLive(other.m_stats);
+		}
+		return *this;
+	}
+
+	size_t Size() const		{ return m_size; }
+	bool IsEmpty() const	{ return m_size == 0; }
+	size_t Height() const	{ return m_height; }
+
+	// always zero unless StatsPolicy counts, a lookup visits one node per level
+	ContainerStats Stats() const	{ return m_stats.Get(); }
+	void ResetStats()				{ m_stats.Reset(); }
+
+	iterator begin()				{ return iterator(m_first, 0); }
+	iterator end()					{ return iterator(); }
+	const_iterator begin() const	{ return const_iterator(m_first, 0); }
+	const_iterator end() const		{ return const_iterator(); }
+	const_iterator cbegin() const	{ return begin(); }
+	const_iterator cend() const		{ return end(); }
+
+	void Clear() {
+		if (m_root != nullptr)
+			DestroySubtree(m_root, m_height);
+		m_root = nullptr;
+		m_first = nullptr;
+		m_height = 0;
+		m_size = 0;
+	}
+
+	iterator Find(const K& key) {
+		auto [leaf, i] = LowerBoundPosition(key);
+		return leaf != nullptr && !(key < leaf->keys[i]) ? iterator(leaf, i) : end();
+	}
+
+	const_iterator Find(const K& key) const {
+		auto [leaf, i] = LowerBoundPosition(key);
+		return leaf != nullptr && !(key < leaf->keys[i]) ? const_iterator(leaf, i) : end();
+	}
+
+	bool Contains(const K& key) const { return Find(key) != end(); }
+
+	// the mapped value for key, or nullptr
+	V* Get(const K& key) {
+		auto [leaf, i] = LowerBoundPosition(key);
+		return leaf != nullptr && !(key < leaf->keys[i]) ? &leaf->values[i] : nullptr;
+	}
+
+	const V* Get(const K& key) const {
+		auto [leaf, i] = LowerBoundPosition(key);
+		return leaf != nullptr && !(key < leaf->keys[i]) ? &leaf->values[i] : nullptr;
+	}
+
+	// first entry whose key is not less than key
+	iterator LowerBound(const K& key) {
+		auto [leaf, i] = LowerBoundPosition(key);
+		return iterator(leaf, i);
+	}
+
+	const_iterator LowerBound(const K& key) const {
+		auto [leaf, i] = LowerBoundPosition(key);
+		return const_iterator(leaf, i);
+	}
+
+	// first entry whose key is greater than key
+	iterator UpperBound(const K& key) {
+		iterator it = LowerBound(key);
+		return it != end() && !(key < it.Key()) ? ++it : it;
+	}
+
+	const_iterator UpperBound(const K& key) const {
+		const_iterator it = LowerBound(key);
+		return it != end() && !(key < it.Key()) ? ++it : it;
+	}
+
+	// calls fn(key, value) for every key in [first, last) in order, returns how many were visited; keys are passed const
+	// since changing one would break the order, values may be changed through the non const overload
+	template<class Fn>
+	size_t ForEachInRange(const K& first, const K& last, Fn&& fn) {
+		auto [leaf, i] = LowerBoundPosition(first);
+		return VisitRange(leaf, i, last, fn);
+	}
+
+	template<class Fn>
+	size_t ForEachInRange(const K& first, const K& last, Fn&& fn) const {
+		auto [leaf, i] = LowerBoundPosition(first);
+		return VisitRange(static_cast<const Leaf*>(leaf), i, last, fn);
+	}
+
+	// constructs the value from args only if key isn't present, the bool is true when it was inserted
+	template<class... Args>
+	std::pair<iterator, bool> TryEmplace(const K& key, Args&&... args)	{ return EmplaceKey(key, std::forward<Args>(args)...); }
+
+	template<class... Args>
+	std::pair<iterator, bool> TryEmplace(K&& key, Args&&... args)		{ return EmplaceKey(std::move(key), std::forward<Args>(args)...); }
+
+	std::pair<iterator, bool> Insert(const K& key, const V& val)	{ return EmplaceKey(key, val); }
+	std::pair<iterator, bool> Insert(const K& key, V&& val)			{ return EmplaceKey(key, std::move(val)); }
+
+	template<class Val>
+	std::pair<iterator, bool> InsertOrAssign(const K& key, Val&& val) {
+		auto result = EmplaceKey(key, std::forward<Val>(val));
+		if (!result.second)
+			result.first.Value() = std::forward<Val>(val);
+		return result;
+	}
+
+	V& operator[](const K& key) { return EmplaceKey(key).first.Value(); }
+
+	// removes key, returns how many values were removed
+	size_t Erase(const K& key) {
+		if (m_root == nullptr)
+			return 0;
+
+		PathEntry path[maxHeight];
+		Leaf* leaf = Descend(key, path);
+		const uint32_t pos = NodeLowerBound(leaf->keys, leaf->count, key);
+		if (pos == leaf->count || key < leaf->keys[pos])
+			return 0;
+
+		std::move(leaf->keys + pos + 1, leaf->keys + leaf->count, leaf->keys + pos);
+		std::move(leaf->values + pos + 1, leaf->values + leaf->count, leaf->values + pos);
+		--leaf->count;
+		--m_size;
+		Rebalance(path, leaf);
+		return 1;
+	}
+
+	// replaces the contents with first..last, which must be sorted by key, a key not greater than the one before it is skipped
+	// leaves are packed full and inner levels built bottom up, far cheaper than inserting one at a time
+	template<class It>
+	void BulkLoad(It first, It last) {
+		Clear();
+
+		std::vector<Node*> level;
+		Leaf* leaf = nullptr;
+		for (; first != last; ++first) {
+			auto&& entry = *first;
+			if (m_size > 0 && !(leaf->keys[leaf->count - 1] < entry.first))
+				continue;
+			if (leaf == nullptr || leaf->count == leafSlots) {
+				Leaf* next = NewNode<Leaf>();
+				if (leaf != nullptr)
+					leaf->next = next;
+				else
+					m_first = next;
+				level.push_back(next);
+				leaf = next;
+			}
+			leaf->keys[leaf->count] = entry.first;
+			leaf->values[leaf->count] = entry.second;
+			++leaf->count;
+			++m_size;
+		}
+		if (level.empty())
+			return;
+
+		// the last leaf takes half of its neighbour if it came up short
+		if (level.size() > 1 && leaf->count < minLeafCount) {
+			Leaf* previous = static_cast<Leaf*>(level[level.size() - 2]);
+			const uint32_t moved = (previous->count + leaf->count) / 2 - leaf->count;
+			std::move_backward(leaf->keys, leaf->keys + leaf->count, leaf->keys + leaf->count + moved);
+			std::move_backward(leaf->values, leaf->values + leaf->count, leaf->values + leaf->count + moved);
+			std::move(previous->keys + previous->count - moved, previous->keys + previous->count, leaf->keys);
+			std::move(previous->values + previous->count - moved, previous->values + previous->count, leaf->values);
+			previous->count -= moved;
+			leaf->count += moved;
+		}
+
+		std::vector<K> lows;	// smallest key under each node of the level
+		lows.reserve(level.size());
+		for (Node* node : level)
+			lows.push_back(static_cast<Leaf*>(node)->keys[0]);
+		m_height = 1;
+
+		constexpr size_t fanout = innerSlots + 1;
+		while (level.size() > 1) {
+			std::vector<Node*> parents;
+			std::vector<K> parentLows;
+			const size_t groups = (level.size() + fanout - 1) / fanout;
+			parents.reserve(groups);
+			parentLows.reserve(groups);
+			for (size_t begin = 0; begin < level.size();) {
+				const size_t remaining = level.size() - begin;
+				size_t count = std::min(fanout, remaining);
+				// the last two nodes split what is left evenly so neither falls under the minimum
+				if (remaining > fanout && remaining - fanout < minInnerCount + 1)
+					count = remaining - remaining / 2;
+
+				Inner* inner = NewNode<Inner>();
+				inner->count = static_cast<uint32_t>(count - 1);
+				for (size_t j = 0; j < count; ++j) {
+					inner->children[j] = level[begin + j];
+					if (j > 0)
+						inner->keys[j - 1] = lows[begin + j];
+				}
+				parents.push_back(inner);
+				parentLows.push_back(lows[begin]);
+				begin += count;
+			}
+			level.swap(parents);
+			lows.swap(parentLows);
+			++m_height;
+		}
+		m_root = level[0];
+	}
+
+private:
+	struct PathEntry {
+		Inner* node;
+		uint32_t child;
+	};
+
+	// child of inner whose subtree may hold key
+	static uint32_t ChildIndex(const Inner* inner, const K& key) {
+		const uint32_t i = NodeLowerBound(inner->keys, inner->count, key);
+		return i + (i < inner->count && !(key < inner->keys[i]));
+	}
+
+	// leaf that holds key or would hold it, recording the inner nodes passed on the way
+	Leaf* Descend(const K& key, PathEntry* path) const {
+		m_stats.OnVisit(m_height);
+		Node* node = m_root;
+		for (size_t level = 0; level + 1 < m_height; ++level) {
+			Inner* inner = static_cast<Inner*>(node);
+			const uint32_t child = ChildIndex(inner, key);
+			path[level] = { inner, child };
+			node = inner->children[child];
+		}
+		return static_cast<Leaf*>(node);
+	}
+
+	std::pair<Leaf*, uint32_t> LowerBoundPosition(const K& key) const {
+		if (m_root == nullptr)
+			return { nullptr, 0 };
+		m_stats.OnVisit(m_height);
+		Node* node = m_root;
+		for (size_t level = 1; level < m_height; ++level) {
+			const Inner* inner = static_cast<const Inner*>(node);
+			node = inner->children[ChildIndex(inner, key)];
+		}
+		Leaf* leaf = static_cast<Leaf*>(node);
+		const uint32_t i = NodeLowerBound(leaf->keys, leaf->count, key);
+		// every key of the next leaf is at least the separator above it, which is greater than key
+		if (i == leaf->count)
+			return { leaf->next, 0 };
+		return { leaf, i };
+	}
+
+	template<class LeafPointer, class Fn>
+	size_t VisitRange(LeafPointer leaf, uint32_t index, const K& last, Fn& fn) const {
+		size_t visited = 0;
+		for (; leaf != nullptr; leaf = leaf->next, index = 0) {
+			m_stats.OnVisit();
+			for (; index < leaf->count; ++index) {
+				if (!(leaf->keys[index] < last))
+					return visited;
+				fn(std::as_const(leaf->keys[index]), leaf->values[index]);
+				++visited;
+			}
+		}
+		return visited;
+	}
+
+	template<class Key, class... Args>
+	std::pair<iterator, bool> EmplaceKey(Key&& key, Args&&... args) {
+		if (m_root == nullptr) {
+			m_first = NewNode<Leaf>();
+			m_root = m_first;
+			m_height = 1;
+		}
+
+		PathEntry path[maxHeight];
+		Leaf* leaf = Descend(key, path);
+		const uint32_t pos = NodeLowerBound(leaf->keys, leaf->count, key);
+		if (pos < leaf->count && !(key < leaf->keys[pos]))
+			return { iterator(leaf, pos), false };
+
+		// the arguments may refer to elements of this map, so they are read before anything is shifted or split
+		K newKey(std::forward<Key>(key));
+		V newValue(std::forward<Args>(args)...);
+		if (leaf->count < leafSlots) {
+			InsertIntoLeaf(leaf, pos, std::move(newKey), std::move(newValue));
+			++m_size;
+			return { iterator(leaf, pos), true };
+		}
+
+		// appending past the last leaf, as time ordered keys do, leaves it full instead of half empty
+		Leaf* right = NewNode<Leaf>();
+		const uint32_t keep = pos == leafSlots && leaf->next == nullptr ? leafSlots : (leafSlots + 1) / 2;
+		std::move(leaf->keys + keep, leaf->keys + leafSlots, right->keys);
+		std::move(leaf->values + keep, leaf->values + leafSlots, right->values);
+		right->count = leafSlots - keep;
+		leaf->count = keep;
+		right->next = leaf->next;
+		leaf->next = right;
+
+		Leaf* target = pos < keep ? leaf : right;
+		const uint32_t targetPos = pos < keep ? pos : pos - keep;
+		InsertIntoLeaf(target, targetPos, std::move(newKey), std::move(newValue));
+		++m_size;
+		InsertSeparator(path, m_height - 1, right->keys[0], right);
+		return { iterator(target, targetPos), true };
+	}
+
+	static void InsertIntoLeaf(Leaf* leaf, uint32_t pos, K&& key, V&& value) {
+		std::move_backward(leaf->keys + pos, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+		std::move_backward(leaf->values + pos, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+		leaf->keys[pos] = std::move(key);
+		leaf->values[pos] = std::move(value);
+		++leaf->count;
+	}
+
+	// key goes in front of child, which becomes the right neighbour of children[pos]
+	static void InsertIntoInner(Inner* inner, uint32_t pos, const K& key, Node* child) {
+		std::move_backward(inner->keys + pos, inner->keys + inner->count, inner->keys + inner->count + 1);
+		std::copy_backward(inner->children + pos + 1, inner->children + inner->count + 1, inner->children + inner->count + 2);
+		inner->keys[pos] = key;
+		inner->children[pos + 1] = child;
+		++inner->count;
+	}
+
+	// hooks a node split off at depth into its parent, splitting full parents up to the root
+	void InsertSeparator(PathEntry* path, size_t depth, K separator, Node* child) {
+		while (depth > 0) {
+			auto [inner, pos] = path[depth - 1];
+			if (inner->count < innerSlots) {
+				InsertIntoInner(inner, pos, separator, child);
+				return;
+			}
+
+			// lay out the keys as if the new one fit, then the middle one moves up and the rest split evenly either side of it
+			K keys[innerSlots + 1];
+			Node* children[innerSlots + 2];
+			std::move(inner->keys, inner->keys + pos, keys);
+			std::move(inner->keys + pos, inner->keys + innerSlots, keys + pos + 1);
+			keys[pos] = std::move(separator);
+			std::copy(inner->children, inner->children + pos + 1, children);
+			std::copy(inner->children + pos + 1, inner->children + innerSlots + 1, children + pos + 2);
+			children[pos + 1] = child;
+
+			constexpr uint32_t mid = (innerSlots + 1) / 2;
+			Inner* right = NewNode<Inner>();
+			std::move(keys, keys + mid, inner->keys);
+			std::copy(children, children + mid + 1, inner->children);
+			inner->count = mid;
+			std::move(keys + mid + 1, keys + innerSlots + 1, right->keys);
+			std::copy(children + mid + 1, children + innerSlots + 2, right->children);
+			right->count = innerSlots - mid;
+
+			separator = std::move(keys[mid]);
+			child = right;
+			--depth;
+		}
+
+		Inner* root = NewNode<Inner>();
+		root->count = 1;
+		root->keys[0] = std::move(separator);
+		root->children[0] = m_root;
+		root->children[1] = child;
+		m_root = root;
+		++m_height;
+	}
+
+	static void RemoveFromInner(Inner* inner, uint32_t pos) {
+		std::move(inner->keys + pos + 1, inner->keys + inner->count, inner->keys + pos);
+		std::copy(inner->children + pos + 2, inner->children + inner->count + 1, inner->children + pos + 1);
+		--inner->count;
+	}
+
+	// refills nodes that fell under the minimum after an erase, borrowing from a sibling or merging with one
+	void Rebalance(PathEntry* path, Leaf* leaf) {
+		Node* node = leaf;
+		for (size_t depth = m_height - 1; depth > 0; --depth) {
+			const bool isLeaf = depth == m_height - 1;
+			if (node->count >= (isLeaf ? minLeafCount : minInnerCount))
+				break;
+			auto [parent, pos] = path[depth - 1];
+			const bool merged = isLeaf ? FixLeaf(parent, pos) : FixInner(parent, pos);
+			if (!merged)
+				break;
+			node = parent;
+		}
+
+		if (m_height > 1 && m_root->count == 0) {
+			// the root lost its last separator, its only child takes over
+			Inner* root = static_cast<Inner*>(m_root);
+			m_root = root->children[0];
+			DeleteNode(root);
+			--m_height;
+		} else if (m_height == 1 && m_root->count == 0) {
+			DeleteNode(static_cast<Leaf*>(m_root));
+			m_root = nullptr;
+			m_first = nullptr;
+			m_height = 0;
+		}
+	}
+
+	// returns true when it had to merge, which takes a separator out of parent
+	bool FixLeaf(Inner* parent, uint32_t pos) {
+		Leaf* leaf = static_cast<Leaf*>(parent->children[pos]);
+		if (pos > 0) {
+			Leaf* left = static_cast<Leaf*>(parent->children[pos - 1]);
+			if (left->count > minLeafCount) {
+				std::move_backward(leaf->keys, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+				std::move_backward(leaf->values, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+				--left->count;
+				leaf->keys[0] = std::move(left->keys[left->count]);
+				leaf->values[0] = std::move(left->values[left->count]);
+				++leaf->count;
+				parent->keys[pos - 1] = leaf->keys[0];
+				return false;
+			}
+		}
+		if (pos < parent->count) {
+			Leaf* right = static_cast<Leaf*>(parent->children[pos + 1]);
+			if (right->count > minLeafCount) {
+				leaf->keys[leaf->count] = std::move(right->keys[0]);
+				leaf->values[leaf->count] = std::move(right->values[0]);
+				++leaf->count;
+				std::move(right->keys + 1, right->keys + right->count, right->keys);
+				std::move(right->values + 1, right->values + right->count, right->values);
+				--right->count;
+				parent->keys[pos] = right->keys[0];
+				return false;
+			}
+		}
+
+		// the right leaf of the pair is folded into the left one
+		const uint32_t merge = pos > 0 ? pos - 1 : pos;
+		Leaf* left = static_cast<Leaf*>(parent->children[merge]);
+		Leaf* right = static_cast<Leaf*>(parent->children[merge + 1]);
+		std::move(right->keys, right->keys + right->count, left->keys + left->count);
+		std::move(right->values, right->values + right->count, left->values + left->count);
+		left->count += right->count;
+		left->next = right->next;
+		DeleteNode(right);
+		RemoveFromInner(parent, merge);
+		return true;
+	}
+
+	bool FixInner(Inner* parent, uint32_t pos) {
+		Inner* inner = static_cast<Inner*>(parent->children[pos]);
+		if (pos > 0) {
+			Inner* left = static_cast<Inner*>(parent->children[pos - 1]);
+			if (left->count > minInnerCount) {
+				// rotate through the parent, the separator comes down and left's last key goes up
+				std::move_backward(inner->keys, inner->keys + inner->count, inner->keys + inner->count + 1);
+				std::copy_backward(inner->children, inner->children + inner->count + 1, inner->children + inner->count + 2);
+				inner->keys[0] = std::move(parent->keys[pos - 1]);
+				inner->children[0] = left->children[left->count];
+				++inner->count;
+				parent->keys[pos - 1] = std::move(left->keys[left->count - 1]);
+				--left->count;
+				return false;
+			}
+		}
+		if (pos < parent->count) {
+			Inner* right = static_cast<Inner*>(parent->children[pos + 1]);
+			if (right->count > minInnerCount) {
+				inner->keys[inner->count] = std::move(parent->keys[pos]);
+				inner->children[inner->count + 1] = right->children[0];
+				++inner->count;
+				parent->keys[pos] = std::move(right->keys[0]);
+				std::move(right->keys + 1, right->keys + right->count, right->keys);
+				std::copy(right->children + 1, right->children + right->count + 1, right->children);
+				--right->count;
+				return false;
+			}
+		}
+
+		// the separator comes down between the two halves
+		const uint32_t merge = pos > 0 ? pos - 1 : pos;
+		Inner* left = static_cast<Inner*>(parent->children[merge]);
+		Inner* right = static_cast<Inner*>(parent->children[merge + 1]);
+		left->keys[left->count] = std::move(parent->keys[merge]);
+		std::move(right->keys, right->keys + right->count, left->keys + left->count + 1);
+		std::copy(right->children, right->children + right->count + 1, left->children + left->count + 1);
+		left->count += right->count + 1;
+		DeleteNode(right);
+		RemoveFromInner(parent, merge);
+		return true;
+	}
+
+	template<class N>
+	N* NewNode() {
+		N* node = new N();
+		m_stats.OnAllocate(sizeof(N));
+		return node;
+	}
+
+	template<class N>
+	void DeleteNode(N* node) {
+		delete node;
+		m_stats.OnFree(sizeof(N));
+	}
+
+	void DestroySubtree(Node* node, size_t height) {
+		if (height == 1) {
+			DeleteNode(static_cast<Leaf*>(node));
+			return;
+		}
+		Inner* inner = static_cast<Inner*>(node);
+		for (uint32_t i = 0; i <= inner->count; ++i)
+			DestroySubtree(inner->children[i], height - 1);
+		DeleteNode(inner);
+	}
+
+	Node* m_root;
+	Leaf* m_first;		// leftmost leaf, where iteration starts
+	size_t m_height;	// levels including the leaves, 0 when empty
+	size_t m_size;
+	ADS_NO_UNIQUE_ADDRESS StatsPolicy m_stats;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_BTREE_MAP_H
\ No newline at end of file
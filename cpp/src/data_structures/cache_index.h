@@ -0,0 +1,133 @@
+#ifndef DATA_STRUCTURES_CACHE_INDEX_H
+#define DATA_STRUCTURES_CACHE_INDEX_H
+
+#include "pch.h"
+
+namespace ads {
+
+/* hit/miss/eviction counters shared by the caches */
+struct CacheStats {
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+	uint64_t evictions = 0;
+};
+
+
+/* open addressing hash index of Entry pointers, linear probing with backward shift deletion so there are no tombstones
+   Entry must expose key and hash, the index never owns the entries */
+template<class Entry, class Hash, class KeyEqual>
+class CacheIndex {
+public:
+	CacheIndex() : m_slots(nullptr), m_mask(0), m_shift(0), m_size(0) {}
+
+	CacheIndex(const CacheIndex&) = delete;
+	CacheIndex& operator=(const CacheIndex&) = delete;
+
+	~CacheIndex() {
+		delete[] m_slots;
+	}
+
+	size_t Size() const { return m_size; }
+
+	template<class Key>
+	size_t HashOf(const Key& key) const {
+		return m_hash(key);
+	}
+
+	// returns the entry for key, or nullptr
+	template<class Key>
+	Entry* Find(const Key& key, size_t hash) const {
+		if (m_size == 0)
+			return nullptr;
+		for (size_t i = Home(hash);; i = (i + 1) & m_mask) {
+			const Slot& slot = m_slots[i];
+			if (slot.entry == nullptr)
+				return nullptr;
+			if (slot.hash == hash && m_equal(slot.entry->key, key))
+				return slot.entry;
+		}
+	}
+
+	// entry->hash must be set and no entry with the same key may be in the index
+	void Insert(Entry* entry) {
+		// keep the load factor under 3/4
+		if ((m_size + 1) * 4 > (m_mask + 1) * 3 || m_slots == nullptr)
+			Rehash(m_slots == nullptr ? 16 : (m_mask + 1) * 2);
+		Place(entry);
+		++m_size;
+	}
+
+	void Erase(const Entry* entry) {
+		size_t i = Home(entry->hash);
+		while (m_slots[i].entry != entry)
+			i = (i + 1) & m_mask;
+
+		// shift later members of the probe run back into the hole so lookups never stop early
+		for (size_t j = (i + 1) & m_mask; m_slots[j].entry != nullptr; j = (j + 1) & m_mask) {
+			const size_t home = Home(m_slots[j].hash);
+			// j's entry can move into the hole only if its home is not inside (i, j]
+			if (((j - home) & m_mask) >= ((j - i) & m_mask)) {
+				m_slots[i] = m_slots[j];
+				i = j;
+			}
+		}
+		m_slots[i] = Slot();
+		--m_size;
+	}
+
+	// sizes the table for count entries, so inserting up to count never rehashes
+	void Reserve(size_t count) {
+		const size_t slots = std::bit_ceil(std::max<size_t>(16, (count * 4 + 2) / 3));
+		if (slots > m_mask + 1 || m_slots == nullptr)
+			Rehash(slots);
+	}
+
+	void Clear() {
+		if (m_slots != nullptr)
+			std::fill(m_slots, m_slots + m_mask + 1, Slot());
+		m_size = 0;
+	}
+
+private:
+	struct Slot {
+		Entry* entry = nullptr;
+		size_t hash = 0;
+	};
+
+	// fibonacci hashing spreads weak hashes such as the identity hash of integers over the whole table
+	size_t Home(size_t hash) const {
+		return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> m_shift) & m_mask;
+	}
+
+	void Place(Entry* entry) {
+		size_t i = Home(entry->hash);
+		while (m_slots[i].entry != nullptr)
+			i = (i + 1) & m_mask;
+		m_slots[i].entry = entry;
+		m_slots[i].hash = entry->hash;
+	}
+
+	void Rehash(size_t slotCount) {
+		Slot* old = m_slots;
+		const size_t oldCount = old != nullptr ? m_mask + 1 : 0;
+		m_slots = new Slot[slotCount];
+		m_mask = slotCount - 1;
+		m_shift = 64 - std::countr_zero(slotCount);
+		for (size_t i = 0; i < oldCount; ++i) {
+			if (old[i].entry != nullptr)
+				Place(old[i].entry);
+		}
+		delete[] old;
+	}
+
+	Slot* m_slots;
+	size_t m_mask;
+	int m_shift;
+	size_t m_size;
+	ADS_NO_UNIQUE_ADDRESS Hash m_hash;
+	ADS_NO_UNIQUE_ADDRESS KeyEqual m_equal;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_CACHE_INDEX_H
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef DATA_STRUCTURES_CACHE_LINE_H
+#define DATA_STRUCTURES_CACHE_LINE_H
+
+#include "pch.h"
+#include "data_structures/simd.h"
+
+namespace ads {
+
+// alignment used to keep hot blocks on their own line and to stop independently written atomics from false sharing
+constexpr size_t cacheLineSize = 64;
+
+// hints that the line holding address is read soon, prefetches never fault so address may lie past the end of an array
+inline void PrefetchRead(const void* address) {
+#if defined(_MSC_VER) && defined(ADS_SSE2)
+	_mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(address, 0, 3);
+#else
+	(void)address;
+#endif
+}
+
+
+/* std allocator whose blocks start on a cache line, for arrays that are searched a line at a time */
+template<class T>
+struct CacheAlignedAllocator {
+	using value_type = T;
+
+	static constexpr size_t alignment = std::max(cacheLineSize, alignof(T));
+
+	CacheAlignedAllocator() = default;
+
+	template<class U>
+	CacheAlignedAllocator(const CacheAlignedAllocator<U>&) {}
+
+	T* allocate(size_t count) {
+		return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(alignment)));
+	}
+
+	void deallocate(T* p, size_t) {
+		::operator delete(p, std::align_val_t(alignment));
+	}
+
+	template<class U>
+	bool operator==(const CacheAlignedAllocator<U>&) const { return true; }
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_CACHE_LINE_H
\ No newline at end of file
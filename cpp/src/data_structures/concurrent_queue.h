@@ -0,0 +1,181 @@
+#ifndef DATA_STRUCTURES_CONCURRENT_QUEUE_H
+#define DATA_STRUCTURES_CONCURRENT_QUEUE_H
+
+#include "pch.h"
+#include "data_structures/cache_line.h"
+#include "data_structures/hazard_pointer.h"
+
+namespace ads {
+
+/* lock-free multi producer multi consumer linked queue (Michael-Scott), popped nodes are reclaimed through hazard pointers */
+template<class T>
+class ConcurrentQueue {
+public:
+	struct Node {
+		Node() : next(nullptr) {}
+
+		~Node() {}
+
+		T* Value() { return std::launder(reinterpret_cast<T*>(storage)); }
+
+		std::atomic<Node*> next;
+		alignas(T) std::byte storage[sizeof(T)];	// live for every node after the dummy head
+	};
+
+
+	ConcurrentQueue() {
+		Node* dummy = new Node();
+		m_head.store(dummy, std::memory_order_relaxed);
+		m_tail.store(dummy, std::memory_order_relaxed);
+	}
+
+	ConcurrentQueue(const ConcurrentQueue&) = delete;
+	ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+	// must not race any other operation
+	~ConcurrentQueue() {
+		Node* node = m_head.load(std::memory_order_relaxed);
+		Node* next = node->next.load(std::memory_order_relaxed);
+		delete node;
+		while (next != nullptr) {
+			node = next;
+			next = node->next.load(std::memory_order_relaxed);
+			std::destroy_at(node->Value());
+			delete node;
+		}
+	}
+
+	// only a snapshot when other threads are pushing or popping
+	bool IsEmpty() const {
+		return m_head.load(std::memory_order_acquire)->next.load(std::memory_order_acquire) == nullptr;
+	}
+
+	void Push(const T& val)	{ Emplace(val); }
+	void Push(T&& val)		{ Emplace(std::move(val)); }
+
+	template<class... Args>
+	void Emplace(Args&&... args) {
+		Node* node = new Node();
+		::new (static_cast<void*>(node->storage)) T(std::forward<Args>(args)...);
+
+		HazardPointer hazard(0);
+		while (true) {
+			Node* tail = hazard.Protect(m_tail);
+			Node* next = tail->next.load(std::memory_order_acquire);
+			if (next != nullptr) {
+				// tail is lagging, help the other producer swing it
+				m_tail.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+				continue;
+			}
+			Node* expected = nullptr;
+			if (tail->next.compare_exchange_weak(expected, node, std::memory_order_release, std::memory_order_relaxed)) {
+				m_tail.compare_exchange_strong(tail, node, std::memory_order_release, std::memory_order_relaxed);
+				return;
+			}
+		}
+	}
+
+	// moves the oldest value into out, returns false if the queue was empty
+	bool TryPop(T& out) {
+		HazardPointer headHazard(0);
+		HazardPointer nextHazard(1);
+		while (true) {
+			Node* head = headHazard.Protect(m_head);
+			Node* next = nextHazard.Protect(head->next);
+			if (head != m_head.load(std::memory_order_acquire))
+				continue;
+			if (next == nullptr)
+				return false;
+
+			Node* tail = m_tail.load(std::memory_order_acquire);
+			if (head == tail) {
+				// tail is lagging behind a finished push
+				m_tail.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+				continue;
+			}
+			if (m_head.compare_exchange_strong(head, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+				// next is the new dummy, nobody else reads its value
+				out = std::move(*next->Value());
+				std::destroy_at(next->Value());
+				headHazard.Clear();
+				HazardPointer::Retire(head);
+				return true;
+			}
+		}
+	}
+
+private:
+	alignas(cacheLineSize) std::atomic<Node*> m_head;
+	alignas(cacheLineSize) std::atomic<Node*> m_tail;
+};
+
+
+/* multi producer single consumer linked queue (Vyukov), Push is wait-free and only the consumer frees nodes so no reclamation is needed */
+template<class T>
+class MpscQueue {
+public:
+	struct Node {
+		Node() : next(nullptr) {}
+
+		~Node() {}
+
+		T* Value() { return std::launder(reinterpret_cast<T*>(storage)); }
+
+		std::atomic<Node*> next;
+		alignas(T) std::byte storage[sizeof(T)];
+	};
+
+
+	MpscQueue() {
+		Node* dummy = new Node();
+		m_head.store(dummy, std::memory_order_relaxed);
+		m_tail = dummy;
+	}
+
+	MpscQueue(const MpscQueue&) = delete;
+	MpscQueue& operator=(const MpscQueue&) = delete;
+
+	// must not race any other operation
+	~MpscQueue() {
+		Node* node = m_tail;
+		Node* next = node->next.load(std::memory_order_relaxed);
+		delete node;
+		while (next != nullptr) {
+			node = next;
+			next = node->next.load(std::memory_order_relaxed);
+			std::destroy_at(node->Value());
+			delete node;
+		}
+	}
+
+	void Push(const T& val)	{ Emplace(val); }
+	void Push(T&& val)		{ Emplace(std::move(val)); }
+
+	template<class... Args>
+	void Emplace(Args&&... args) {
+		Node* node = new Node();
+		::new (static_cast<void*>(node->storage)) T(std::forward<Args>(args)...);
+		Node* prev = m_head.exchange(node, std::memory_order_acq_rel);
+		prev->next.store(node, std::memory_order_release);
+	}
+
+	// consumer thread only, returns false if the queue was empty or a push is halfway through linking
+	bool TryPop(T& out) {
+		Node* next = m_tail->next.load(std::memory_order_acquire);
+		if (next == nullptr)
+			return false;
+		out = std::move(*next->Value());
+		std::destroy_at(next->Value());
+		delete m_tail;
+		m_tail = next;
+		return true;
+	}
+
+private:
+	alignas(cacheLineSize) std::atomic<Node*> m_head;	// producers push here
+	alignas(cacheLineSize) Node* m_tail;				// consumer pops here, always the dummy
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_CONCURRENT_QUEUE_H
\ No newline at end of file
@@ -0,0 +1,81 @@
+#ifndef DATA_STRUCTURES_CONTAINER_STATS_H
+#define DATA_STRUCTURES_CONTAINER_STATS_H
+
+#include "pch.h"
+
+namespace ads {
+
+/* what a container has asked of its allocator and how many nodes its operations touched, bytes are the container's own
+   requests, so a pool allocator's slab refills don't show up but every node it hands out does */
+struct ContainerStats {
+	uint64_t allocations = 0;
+	uint64_t frees = 0;
+	size_t liveBytes = 0;
+	size_t peakBytes = 0;
+	uint64_t nodeVisits = 0;	// nodes, blocks or probe groups examined while searching or walking
+};
+
+
+/* the default stats policy, every hook is an empty inline call and containers hold it ADS_NO_UNIQUE_ADDRESS, so it costs nothing */
+struct NoStats {
+	static constexpr bool enabled = false;
+
+	void OnAllocate(size_t) {}
+	void OnFree(size_t) {}
+	void OnVisit(uint64_t = 1) const {}
+	void SwapLive(NoStats&) {}
+	void TransferLive(NoStats&, size_t) {}
+	void Reset() {}
+	ContainerStats Get() const { return {}; }
+};
+
+
+/* counts into plain integers, not for containers shared between threads */
+class CountingStats {
+public:
+	static constexpr bool enabled = true;
+
+	void OnAllocate(size_t bytes) {
+		++m_stats.allocations;
+		m_stats.liveBytes += bytes;
+		m_stats.peakBytes = std::max(m_stats.peakBytes, m_stats.liveBytes);
+	}
+
+	void OnFree(size_t bytes) {
+		++m_stats.frees;
+		m_stats.liveBytes -= bytes;
+	}
+
+	// const so lookups can count the nodes they walk
+	void OnVisit(uint64_t count = 1) const {
+		m_stats.nodeVisits += count;
+	}
+
+	// for containers that hand their memory to another object, the live bytes follow the memory and the counters stay put
+	void SwapLive(CountingStats& other) {
+		std::swap(m_stats.liveBytes, other.m_stats.liveBytes);
+		m_stats.peakBytes = std::max(m_stats.peakBytes, m_stats.liveBytes);
+		other.m_stats.peakBytes = std::max(other.m_stats.peakBytes, other.m_stats.liveBytes);
+	}
+
+	// for nodes spliced into another container
+	void TransferLive(CountingStats& to, size_t bytes) {
+		m_stats.liveBytes -= bytes;
+		to.m_stats.liveBytes += bytes;
+		to.m_stats.peakBytes = std::max(to.m_stats.peakBytes, to.m_stats.liveBytes);
+	}
+
+	// starts a new measurement window, live bytes are still held so they carry over and become the new peak
+	void Reset() {
+		m_stats = { 0, 0, m_stats.liveBytes, m_stats.liveBytes, 0 };
+	}
+
+	ContainerStats Get() const { return m_stats; }
+
+private:
+	mutable ContainerStats m_stats;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_CONTAINER_STATS_H
\ No newline at end of file
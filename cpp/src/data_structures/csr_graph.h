@@ -0,0 +1,92 @@
+#ifndef DATA_STRUCTURES_CSR_GRAPH_H
+#define DATA_STRUCTURES_CSR_GRAPH_H
+
+#include "pch.h"
+
+namespace ads {
+
+/* weight type of graphs whose edges carry nothing */
+struct Unweighted {
+	bool operator==(const Unweighted&) const = default;
+};
+
+
+/* one directed edge of an edge list, the input CsrGraph builders and generators work with */
+template<class Weight = Unweighted>
+struct CsrEdge {
+	uint32_t source;
+	uint32_t target;
+	ADS_NO_UNIQUE_ADDRESS Weight weight;
+};
+
+
+/* static graph in compressed sparse row form, the out edges of vertex v are targets[offsets[v], offsets[v + 1]) so a scan over
+   a neighbourhood is one contiguous read instead of a walk through list nodes, in edges are stored the same way when the graph
+   is directed and the builder was asked for them, a symmetric graph answers in edge queries from its out edges */
+template<class Weight = Unweighted>
+class CsrGraph {
+public:
+	using Vertex = uint32_t;
+
+	static constexpr bool weighted = !std::is_same_v<Weight, Unweighted>;
+	static constexpr Vertex noVertex = std::numeric_limits<Vertex>::max();
+
+	CsrGraph() : m_offsets(1, 0), m_symmetric(true) {}
+
+	// takes over arrays laid out by a builder, weights are empty for unweighted graphs and the in arrays are empty when absent
+	CsrGraph(std::vector<uint64_t> offsets, std::vector<Vertex> targets, std::vector<Weight> weights, std::vector<uint64_t> inOffsets,
+		std::vector<Vertex> inSources, std::vector<Weight> inWeights, bool symmetric)
+		: m_offsets(std::move(offsets)), m_targets(std::move(targets)), m_weights(std::move(weights)), m_inOffsets(std::move(inOffsets)),
+		m_inSources(std::move(inSources)), m_inWeights(std::move(inWeights)), m_symmetric(symmetric) {}
+
+	size_t VertexCount() const	{ return m_offsets.size() - 1; }
+	// directed edge count, an undirected edge counts once per direction
+	size_t EdgeCount() const	{ return m_targets.size(); }
+
+	bool IsSymmetric() const	{ return m_symmetric; }
+	bool HasInEdges() const		{ return m_symmetric || !m_inOffsets.empty(); }
+
+	size_t OutDegree(Vertex v) const { return static_cast<size_t>(m_offsets[v + 1] - m_offsets[v]); }
+
+	std::span<const Vertex> OutNeighbors(Vertex v) const {
+		return { m_targets.data() + m_offsets[v], OutDegree(v) };
+	}
+
+	std::span<const Weight> OutWeights(Vertex v) const requires weighted {
+		return { m_weights.data() + m_offsets[v], OutDegree(v) };
+	}
+
+	// only valid when HasInEdges
+	size_t InDegree(Vertex v) const {
+		return m_symmetric ? OutDegree(v) : static_cast<size_t>(m_inOffsets[v + 1] - m_inOffsets[v]);
+	}
+
+	std::span<const Vertex> InNeighbors(Vertex v) const {
+		return m_symmetric ? OutNeighbors(v) : std::span<const Vertex>(m_inSources.data() + m_inOffsets[v], InDegree(v));
+	}
+
+	std::span<const Weight> InWeights(Vertex v) const requires weighted {
+		return m_symmetric ? OutWeights(v) : std::span<const Weight>(m_inWeights.data() + m_inOffsets[v], InDegree(v));
+	}
+
+	std::span<const uint64_t> Offsets() const	{ return m_offsets; }
+	std::span<const Vertex> Targets() const		{ return m_targets; }
+
+	size_t MemoryBytes() const {
+		return (m_offsets.size() + m_inOffsets.size()) * sizeof(uint64_t) + (m_targets.size() + m_inSources.size()) * sizeof(Vertex)
+			+ (m_weights.size() + m_inWeights.size()) * sizeof(Weight);
+	}
+
+private:
+	std::vector<uint64_t> m_offsets;	// VertexCount + 1 entries
+	std::vector<Vertex> m_targets;
+	std::vector<Weight> m_weights;
+	std::vector<uint64_t> m_inOffsets;
+	std::vector<Vertex> m_inSources;
+	std::vector<Weight> m_inWeights;
+	bool m_symmetric;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_CSR_GRAPH_H
\ No newline at end of file
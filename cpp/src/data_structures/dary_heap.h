@@ -0,0 +1,265 @@
+#ifndef DATA_STRUCTURES_DARY_HEAP_H
+#define DATA_STRUCTURES_DARY_HEAP_H
+
+#include "pch.h"
+
+namespace ads {
+
+/* implicit D-ary heap in one array, ordered like std::priority_queue so Top is the element nothing compares greater than,
+   a wider node makes the tree shallower and keeps the children a sift down compares next to each other in memory */
+template<class T, size_t D = 4, class Compare = std::less<T>>
+class DaryHeap {
+	static_assert(D >= 2, "a heap node needs at least two children");
+
+public:
+	DaryHeap() = default;
+
+	explicit DaryHeap(const Compare& compare) : m_compare(compare) {}
+
+	// builds the heap bottom up in O(n)
+	template<class It>
+	DaryHeap(It first, It last, const Compare& compare = Compare()) : m_data(first, last), m_compare(compare) {
+		// every node from the last parent back to the root
+		if (m_data.size() > 1) {
+			for (size_t i = (m_data.size() - 2) / D + 1; i-- > 0;)
+				SiftDown(i);
+		}
+	}
+
+	size_t Size() const		{ return m_data.size(); }
+	bool IsEmpty() const	{ return m_data.empty(); }
+
+	const T& Top() const { return m_data.front(); }
+
+	void Push(const T& val)	{ Emplace(val); }
+	void Push(T&& val)		{ Emplace(std::move(val)); }
+
+	template<class... Args>
+	void Emplace(Args&&... args) {
+		m_data.emplace_back(std::forward<Args>(args)...);
+		SiftUp(m_data.size() - 1);
+	}
+
+	void Pop() {
+		if (m_data.size() > 1)
+			m_data.front() = std::move(m_data.back());
+		m_data.pop_back();
+		if (!m_data.empty())
+			SiftDown(0);
+	}
+
+	// removes the top and returns it
+	T PopTop() {
+		T top = std::move(m_data.front());
+		Pop();
+		return top;
+	}
+
+	// replaces the top with val and restores the heap in one sift, cheaper than Pop then Push
+	void ReplaceTop(T val) {
+		m_data.front() = std::move(val);
+		SiftDown(0);
+	}
+
+	void Clear()				{ m_data.clear(); }
+	void Reserve(size_t count)	{ m_data.reserve(count); }
+
+private:
+	// moves the value at i up into a hole instead of swapping at every level
+	void SiftUp(size_t i) {
+		T val = std::move(m_data[i]);
+		while (i > 0) {
+			const size_t parent = (i - 1) / D;
+			if (!m_compare(m_data[parent], val))
+				break;
+			m_data[i] = std::move(m_data[parent]);
+			i = parent;
+		}
+		m_data[i] = std::move(val);
+	}
+
+	void SiftDown(size_t i) {
+		const size_t size = m_data.size();
+		T val = std::move(m_data[i]);
+		while (true) {
+			const size_t first = i * D + 1;
+			if (first >= size)
+				break;
+			// the D children are adjacent, a full node is a straight scan with no bounds checks
+			size_t best = first;
+			const size_t last = std::min(first + D, size);
+			for (size_t child = first + 1; child < last; ++child) {
+				if (m_compare(m_data[best], m_data[child]))
+					best = child;
+			}
+			if (!m_compare(val, m_data[best]))
+				break;
+			m_data[i] = std::move(m_data[best]);
+			i = best;
+		}
+		m_data[i] = std::move(val);
+	}
+
+	std::vector<T> m_data;
+	ADS_NO_UNIQUE_ADDRESS Compare m_compare;
+};
+
+
+/* D-ary heap of integer ids in [0, idCount) keyed by a priority, a position table finds any id's slot so its priority can be
+   changed in place, ordered like DaryHeap so pass std::greater for the min heap Dijkstra and A* want */
+template<class Priority, size_t D = 4, class Compare = std::less<Priority>>
+class IndexedDaryHeap {
+	static_assert(D >= 2, "a heap node needs at least two children");
+
+public:
+	static constexpr uint32_t nullPosition = UINT32_MAX;
+
+	// priority sits next to the id so comparisons never leave the heap array
+	struct Entry {
+		Priority priority;
+		uint32_t id;
+	};
+
+	IndexedDaryHeap() = default;
+
+	explicit IndexedDaryHeap(size_t idCount, const Compare& compare = Compare()) : m_position(idCount, nullPosition), m_compare(compare) {}
+
+	size_t Size() const		{ return m_entries.size(); }
+	bool IsEmpty() const	{ return m_entries.empty(); }
+	size_t IdCount() const	{ return m_position.size(); }
+
+	uint32_t Top() const				{ return m_entries.front().id; }
+	const Priority& TopPriority() const	{ return m_entries.front().priority; }
+
+	bool Contains(uint32_t id) const					{ return m_position[id] != nullPosition; }
+	const Priority& PriorityOf(uint32_t id) const		{ return m_entries[m_position[id]].priority; }
+
+	// id must not be in the heap
+	void Push(uint32_t id, const Priority& priority) {
+		m_position[id] = static_cast<uint32_t>(m_entries.size());
+		m_entries.push_back({ priority, id });
+		SiftUp(m_entries.size() - 1);
+	}
+
+	// sets the priority of an id already in the heap, moving it whichever way it now belongs
+	void Update(uint32_t id, const Priority& priority) {
+		const size_t i = m_position[id];
+		const bool up = m_compare(m_entries[i].priority, priority);
+		m_entries[i].priority = priority;
+		if (up)
+			SiftUp(i);
+		else
+			SiftDown(i);
+	}
+
+	// pushes id, or moves it towards the top if priority beats its current one, returns false when nothing changed
+	// with std::greater this is decrease-key, the relax step of Dijkstra and A*
+	bool DecreaseKey(uint32_t id, const Priority& priority) {
+		const uint32_t i = m_position[id];
+		if (i == nullPosition) {
+			Push(id, priority);
+			return true;
+		}
+		if (!m_compare(m_entries[i].priority, priority))
+			return false;
+		m_entries[i].priority = priority;
+		SiftUp(i);
+		return true;
+	}
+
+	void Pop() {
+		EraseAt(0);
+	}
+
+	// removes the top and returns it
+	Entry PopTop() {
+		const Entry top = m_entries.front();
+		EraseAt(0);
+		return top;
+	}
+
+	// removes id if it is in the heap, returns whether it was
+	bool Erase(uint32_t id) {
+		const uint32_t i = m_position[id];
+		if (i == nullPosition)
+			return false;
+		EraseAt(i);
+		return true;
+	}
+
+	// O(Size), the position table is only reset for ids still in the heap
+	void Clear() {
+		for (const Entry& entry : m_entries)
+			m_position[entry.id] = nullPosition;
+		m_entries.clear();
+	}
+
+	// grows or shrinks the id range, the heap must be empty
+	void ResizeIds(size_t idCount) {
+		m_position.assign(idCount, nullPosition);
+	}
+
+	void Reserve(size_t count) { m_entries.reserve(count); }
+
+private:
+	void Place(size_t i, const Entry& entry) {
+		m_entries[i] = entry;
+		m_position[entry.id] = static_cast<uint32_t>(i);
+	}
+
+	void EraseAt(size_t i) {
+		m_position[m_entries[i].id] = nullPosition;
+		const Entry last = m_entries.back();
+		m_entries.pop_back();
+		if (i == m_entries.size())
+			return;
+		// the last entry fills the hole and may belong above or below it
+		const bool up = m_compare(m_entries[i].priority, last.priority);
+		Place(i, last);
+		if (up)
+			SiftUp(i);
+		else
+			SiftDown(i);
+	}
+
+	void SiftUp(size_t i) {
+		const Entry entry = m_entries[i];
+		while (i > 0) {
+			const size_t parent = (i - 1) / D;
+			if (!m_compare(m_entries[parent].priority, entry.priority))
+				break;
+			Place(i, m_entries[parent]);
+			i = parent;
+		}
+		Place(i, entry);
+	}
+
+	void SiftDown(size_t i) {
+		const size_t size = m_entries.size();
+		const Entry entry = m_entries[i];
+		while (true) {
+			const size_t first = i * D + 1;
+			if (first >= size)
+				break;
+			size_t best = first;
+			const size_t last = std::min(first + D, size);
+			for (size_t child = first + 1; child < last; ++child) {
+				if (m_compare(m_entries[best].priority, m_entries[child].priority))
+					best = child;
+			}
+			if (!m_compare(entry.priority, m_entries[best].priority))
+				break;
+			Place(i, m_entries[best]);
+			i = best;
+		}
+		Place(i, entry);
+	}
+
+	std::vector<Entry> m_entries;
+	std::vector<uint32_t> m_position;	// slot of each id in m_entries, nullPosition when absent
+	ADS_NO_UNIQUE_ADDRESS Compare m_compare;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_DARY_HEAP_H
\ No newline at end of file
@@ -2,16 +2,25 @@
 #define DATA_STRUCTURES_DOUBLY_LINKED_LIST_H
 
 #include "pch.h"
+#include "data_structures/container_stats.h"
+#include "data_structures/list_iterator.h"
+#include "data_structures/pool_allocator.h"
 
 namespace ads {
 
-/* doubly linked list class */
-template<class C>
+/* doubly linked list class, nodes come from Alloc which defaults to a slab pool owned by the list, StatsPolicy can be CountingStats to see what it allocates */
+template<class C, class Alloc = PoolAllocator<C>, class StatsPolicy = NoStats>
 class DoublyLinkedList {
 public:
-	template<class C>
+	template<class T>
 	struct Node {
-		Node(const C& val) : value(val), next(nullptr), prev(nullptr) {}
+		Node(const T& val) : value(val), next(nullptr), prev(nullptr) {}
+
+		Node(T&& val) : value(std::move(val)), next(nullptr), prev(nullptr) {}
+
+		// constructs value in place from args
+		template<class... Args>
+		Node(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...), next(nullptr), prev(nullptr) {}
 
 		Node(const Node& other) : value(other.value), next(other.next), prev(other.prev) {}
 
@@ -22,32 +31,323 @@ public:
 
 		~Node() {}
 
-		C value;
+		T value;
 		Node* next;
 		Node* prev;
 	};
 
+	using NodeAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node<C>>;
+	using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+	using value_type = C;
+	using iterator = BidirectionalNodeIterator<Node<C>, false>;
+	using const_iterator = BidirectionalNodeIterator<Node<C>, true>;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
 
-	DoublyLinkedList() : m_head(nullptr), m_tail(nullptr) {}
+	DoublyLinkedList() : m_head(nullptr), m_tail(nullptr), m_size(0) {}
 
-	DoublyLinkedList(const DoublyLinkedList& other) : m_head(other.m_head), m_tail(other.m_tail) {}
+	explicit DoublyLinkedList(const Alloc& alloc) : m_head(nullptr), m_tail(nullptr), m_size(0), m_alloc(alloc) {}
+
+	DoublyLinkedList(const DoublyLinkedList& other) : m_head(nullptr), m_tail(nullptr), m_size(0), m_alloc(NodeTraits::select_on_container_copy_construction(other.m_alloc)) {
+		for (const C& val : other)
+			Append(val);
+	}
+
+	// steals other's nodes, other is left empty
+	DoublyLinkedList(DoublyLinkedList&& other) noexcept : m_head(other.m_head), m_tail(other.m_tail), m_size(other.m_size), m_alloc(std::move(other.m_alloc)) {
+		m_stats.SwapLive(other.m_stats);
+		other.m_head = nullptr;
+		other.m_tail = nullptr;
+		other.m_size = 0;
+	}
 
 	~DoublyLinkedList() {
+		Clear();
+	}
+
+	DoublyLinkedList& operator=(const DoublyLinkedList& other) {
+		if (this != &other) {
+			Clear();
+			for (const C& val : other)
+				Append(val);
+		}
+		return *this;
+	}
+
+	DoublyLinkedList& operator=(DoublyLinkedList&& other) noexcept(NodeTraits::propagate_on_container_move_assignment::value || NodeTraits::is_always_equal::value) {
+		if (this == &other)
+			return *this;
+
+		Clear();
+		if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+			m_alloc = std::move(other.m_alloc);
+		} else if (!(m_alloc == other.m_alloc)) {
+			// other's nodes can't be freed through m_alloc, so move the values instead
+			for (C& val : other)
+				Append(std::move(val));
+			other.Clear();
+			return *this;
+		}
+		m_head = other.m_head;
+		m_tail = other.m_tail;
+		m_size = other.m_size;
+		m_stats.SwapLive(other.m_stats);
+		other.m_head = nullptr;
+		other.m_tail = nullptr;
+		other.m_size = 0;
+		return *this;
+	}
+
+	Node<C>* Head() const { return m_head; }
+	Node<C>* Tail() const { return m_tail; }
+
+	size_t Size() const		{ return m_size; }
+	bool IsEmpty() const	{ return m_size == 0; }
+
+	// always zero unless StatsPolicy counts
+	ContainerStats Stats() const	{ return m_stats.Get(); }
+	void ResetStats()				{ m_stats.Reset(); }
+
+	NodeAllocator GetAllocator() const { return m_alloc; }
+
+	iterator begin()						{ return iterator(m_head, &m_tail); }
+	iterator end()							{ return iterator(nullptr, &m_tail); }
+	const_iterator begin() const			{ return const_iterator(m_head, &m_tail); }
+	const_iterator end() const				{ return const_iterator(nullptr, &m_tail); }
+	const_iterator cbegin() const			{ return const_iterator(m_head, &m_tail); }
+	const_iterator cend() const				{ return const_iterator(nullptr, &m_tail); }
+	reverse_iterator rbegin()				{ return reverse_iterator(end()); }
+	reverse_iterator rend()					{ return reverse_iterator(begin()); }
+	const_reverse_iterator rbegin() const	{ return const_reverse_iterator(end()); }
+	const_reverse_iterator rend() const		{ return const_reverse_iterator(begin()); }
+
+	// frees every node
+	void Clear() {
 		while (m_head != nullptr) {
 			// use m_tail as a temp variable to free the resources
 			m_tail = m_head;
 			m_head = m_head->next;
-			delete m_tail;
+			DestroyNode(m_tail);
 		}
+		m_tail = nullptr;
 	}
 
-	Node<C>* Head() const { return m_head; }
-	Node<C>* Tail() const { return m_tail; }
-
 	// adds a new node to the end of the list
-	void Append(const C& val) {
-		Node<C>* node = new Node(val);
+	void Append(const C& val)	{ LinkBack(CreateNode(val)); }
+	void Append(C&& val)		{ LinkBack(CreateNode(std::move(val))); }
+
+	// adds a new node to the head of the list
+	void Prepend(const C& val)	{ LinkFront(CreateNode(val)); }
+	void Prepend(C&& val)		{ LinkFront(CreateNode(std::move(val))); }
+
+	// constructs a new value in place at the end of the list
+	template<class... Args>
+	C& EmplaceBack(Args&&... args) {
+		Node<C>* node = CreateNode(std::forward<Args>(args)...);
+		LinkBack(node);
+		return node->value;
+	}
+
+	// constructs a new value in place at the head of the list
+	template<class... Args>
+	C& EmplaceFront(Args&&... args) {
+		Node<C>* node = CreateNode(std::forward<Args>(args)...);
+		LinkFront(node);
+		return node->value;
+	}
+
+	// constructs a new value in place after pos, which must not be end()
+	template<class... Args>
+	iterator EmplaceAfter(const_iterator pos, Args&&... args) {
+		Node<C>* prev = pos.GetNode();
+		Node<C>* node = CreateNode(std::forward<Args>(args)...);
+		node->prev = prev;
+		node->next = prev->next;
+		if (prev->next != nullptr)
+			prev->next->prev = node;
+		else
+			m_tail = node;
+		prev->next = node;
+		return iterator(node, &m_tail);
+	}
+
+	// moves [first, last) out of other and links it in before pos, O(1) within one list, between lists the range is counted to keep both sizes exact
+	void Splice(const_iterator pos, DoublyLinkedList& other, const_iterator first, const_iterator last) {
+		SpliceCounted(pos, other, first, last, this != &other ? static_cast<size_t>(std::distance(first, last)) : 0);
+	}
+
+	void Splice(const_iterator pos, DoublyLinkedList& other, const_iterator it) {
+		SpliceCounted(pos, other, it, std::next(it), this != &other ? 1 : 0);
+	}
+
+	// O(1) when both lists share an allocator
+	void Splice(const_iterator pos, DoublyLinkedList& other) {
+		if (this != &other)
+			SpliceCounted(pos, other, other.cbegin(), other.cend(), other.m_size);
+	}
+
+	// merges sorted other into this sorted list by relinking nodes, equal values from this stay ahead of other's, other is left empty
+	template<class Compare = std::less<>>
+	void Merge(DoublyLinkedList& other, Compare comp = Compare()) {
+		if (this == &other || other.m_head == nullptr)
+			return;
+
+		Node<C>* firstTail = m_tail;
+		Splice(cend(), other);
+		if (firstTail == nullptr)
+			return;
+
+		// split back into the two sorted runs and merge them
+		Node<C>* second = firstTail->next;
+		firstTail->next = nullptr;
+		m_head = MergeChains(m_head, second, comp);
+		RelinkPrev();
+	}
+
+	// stable bottom-up merge sort, O(N log N) and relinks nodes instead of moving values
+	template<class Compare = std::less<>>
+	void Sort(Compare comp = Compare()) {
+		if (m_head == nullptr || m_head->next == nullptr)
+			return;
+
+		// bins[i] holds a sorted run of 2^i nodes, or nullptr; higher bins always hold earlier nodes
+		constexpr size_t binCount = 64;
+		Node<C>* bins[binCount] = {};
+		Node<C>* iter = m_head;
+		while (iter != nullptr) {
+			Node<C>* run = iter;
+			iter = iter->next;
+			run->next = nullptr;
+
+			size_t i = 0;
+			for (; i < binCount - 1 && bins[i] != nullptr; ++i) {
+				run = MergeChains(bins[i], run, comp);
+				bins[i] = nullptr;
+			}
+			if (bins[i] != nullptr)
+				run = MergeChains(bins[i], run, comp);
+			bins[i] = run;
+		}
+
+		Node<C>* result = nullptr;
+		for (size_t i = 0; i < binCount; ++i) {
+			if (bins[i] != nullptr)
+				result = result != nullptr ? MergeChains(bins[i], result, comp) : bins[i];
+		}
+		m_head = result;
+		RelinkPrev();
+	}
+
+	// remove all nodes with value
+	void Remove(const C& val) {
+		RemoveAll(val);
+	}
+
+	// removes every node equal to val, returns how many were removed
+	size_t RemoveAll(const C& val) {
+		return RemoveIf([&val](const C& other) { return other == val; });
+	}
+
+	// removes every node pred returns true for in one pass, returns how many were removed
+	template<class Pred>
+	size_t RemoveIf(Pred pred) {
+		size_t removed = 0;
+		// link is the pointer that should point at the next kept node, kept is the last node that survived
+		Node<C>** link = &m_head;
+		Node<C>* kept = nullptr;
+		Node<C>* iter = m_head;
+		while (iter != nullptr) {
+			Node<C>* next = iter->next;
+			m_stats.OnVisit();
+			if (pred(iter->value)) {
+				DestroyNode(iter);
+				++removed;
+			} else {
+				// only write links that actually change, long runs of kept nodes stay untouched
+				if (*link != iter)
+					*link = iter;
+				if (iter->prev != kept)
+					iter->prev = kept;
+				kept = iter;
+				link = &iter->next;
+			}
+			iter = next;
+		}
+		*link = nullptr;
+		m_tail = kept;
+		return removed;
+	}
+
+	// frees [first, last) with a single unlink, returns last
+	iterator EraseRange(const_iterator first, const_iterator last) {
+		if (first == last)
+			return iterator(last.GetNode(), &m_tail);
+
+		Node<C>* firstNode = first.GetNode();
+		Node<C>* lastNode = last.GetNode() != nullptr ? last.GetNode()->prev : m_tail;
+		UnlinkRange(firstNode, lastNode);
+		while (firstNode != nullptr) {
+			Node<C>* temp = firstNode;
+			firstNode = firstNode->next;
+			DestroyNode(temp);
+		}
+		return iterator(last.GetNode(), &m_tail);
+	}
+
+private:
+	// allocates a node from m_alloc and constructs its value in place from args
+	template<class... Args>
+	Node<C>* CreateNode(Args&&... args) {
+		Node<C>* node = NodeTraits::allocate(m_alloc, 1);
+		try {
+			NodeTraits::construct(m_alloc, node, std::in_place, std::forward<Args>(args)...);
+		} catch (...) {
+			NodeTraits::deallocate(m_alloc, node, 1);
+			throw;
+		}
+		m_stats.OnAllocate(sizeof(Node<C>));
+		++m_size;
+		return node;
+	}
+
+	// a node is counted from its creation to its destruction, splicing moves the count along with the node
+	void DestroyNode(Node<C>* node) {
+		NodeTraits::destroy(m_alloc, node);
+		NodeTraits::deallocate(m_alloc, node, 1);
+		m_stats.OnFree(sizeof(Node<C>));
+		--m_size;
+	}
+
+	// count is how many nodes [first, last) holds when other is a different list
+	void SpliceCounted(const_iterator pos, DoublyLinkedList& other, const_iterator first, const_iterator last, size_t count) {
+		// a range spliced in front of itself stays where it is, and unlinking it first would link it before its own node
+		if (first == last || (this == &other && pos == first))
+			return;
 
+		Node<C>* firstNode = first.GetNode();
+		Node<C>* lastNode = last.GetNode() != nullptr ? last.GetNode()->prev : other.m_tail;
+		other.UnlinkRange(firstNode, lastNode);
+
+		if (this != &other && !(m_alloc == other.m_alloc)) {
+			// other's nodes can't be freed through m_alloc, so move the values into new nodes instead
+			while (firstNode != nullptr) {
+				Node<C>* temp = firstNode;
+				firstNode = firstNode->next;
+				Node<C>* node = CreateNode(std::move(temp->value));
+				LinkRangeBefore(pos.GetNode(), node, node);
+				other.DestroyNode(temp);
+			}
+			return;
+		}
+		LinkRangeBefore(pos.GetNode(), firstNode, lastNode);
+		other.m_size -= count;
+		m_size += count;
+		other.m_stats.TransferLive(m_stats, count * sizeof(Node<C>));
+	}
+
+	void LinkBack(Node<C>* node) {
 		if (m_tail != nullptr) {
 			// already have nodes
 			Node<C>* temp = m_tail;
@@ -61,10 +361,68 @@ public:
 		}
 	}
 
-	// adds a new node to the head of the list
-	void Prepend(const C& val) {
-		Node<C>* node = new Node(val);
+	// detaches the nodes first through last (inclusive) from this list
+	void UnlinkRange(Node<C>* first, Node<C>* last) {
+		Node<C>* before = first->prev;
+		Node<C>* after = last->next;
+		if (before != nullptr)
+			before->next = after;
+		else
+			m_head = after;
+		if (after != nullptr)
+			after->prev = before;
+		else
+			m_tail = before;
+		first->prev = nullptr;
+		last->next = nullptr;
+	}
+
+	// links the detached chain first through last (inclusive) in before pos, or at the end when pos is null
+	void LinkRangeBefore(Node<C>* pos, Node<C>* first, Node<C>* last) {
+		Node<C>* before = pos != nullptr ? pos->prev : m_tail;
+		first->prev = before;
+		last->next = pos;
+		if (before != nullptr)
+			before->next = first;
+		else
+			m_head = first;
+		if (pos != nullptr)
+			pos->prev = last;
+		else
+			m_tail = last;
+	}
+
+	// merges two sorted chains linked through next only, ties are taken from a first
+	template<class Compare>
+	Node<C>* MergeChains(Node<C>* a, Node<C>* b, Compare& comp) const {
+		Node<C>* head = nullptr;
+		Node<C>** link = &head;
+		while (a != nullptr && b != nullptr) {
+			m_stats.OnVisit();
+			if (comp(b->value, a->value)) {
+				*link = b;
+				b = b->next;
+			} else {
+				*link = a;
+				a = a->next;
+			}
+			link = &(*link)->next;
+		}
+		*link = a != nullptr ? a : b;
+		return head;
+	}
 
+	// rebuilds the prev links and m_tail after the list has been relinked through next only
+	void RelinkPrev() {
+		Node<C>* prev = nullptr;
+		for (Node<C>* iter = m_head; iter != nullptr; iter = iter->next) {
+			iter->prev = prev;
+			prev = iter;
+		}
+		m_tail = prev;
+	}
+
+	void LinkFront(Node<C>* node) {
 		if (m_head != nullptr) {
 			// already have nodes
 			Node<C>* temp = m_head;
@@ -78,39 +436,11 @@ public:
 		}
 	}
 
-	// remove all nodes with value
-	void Remove(const C& val) {
-		if (m_head != nullptr) {
-			// check head first
-			if (m_head != nullptr && m_head->value == val) {
-				Node<C>* temp = m_head->next;
-				delete m_head;
-				m_head = temp;
-				m_head->prev = nullptr;
-			}
-			Node<C>* iter = m_head;
-			Node<C>* prev = m_head;
-			while (iter != nullptr) {
-				if (iter->value == val) {
-					iter->prev->next = iter->next;
-					if (iter->next != nullptr)
-						iter->next->prev = iter->prev;
-					delete iter;
-					// only need to move iter
-					iter = prev->next;
-				} else {
-					prev = iter;
-					iter = iter->next;
-				}
-			}
-			// set tail to prev, since it will have iterated through the whole list by now
-			m_tail = prev;
-		}
-	}
-
-private:
 	Node<C>* m_head;
 	Node<C>* m_tail;
+	size_t m_size;
+	NodeAllocator m_alloc;
+	ADS_NO_UNIQUE_ADDRESS StatsPolicy m_stats;
 };
 
 } // namespace ads
@@ -0,0 +1,535 @@
+#ifndef DATA_STRUCTURES_FLAT_HASH_MAP_H
+#define DATA_STRUCTURES_FLAT_HASH_MAP_H
+
+#include "pch.h"
+#include "data_structures/container_stats.h"
+#include "data_structures/simd.h"
+
+namespace ads {
+
+/* control byte values, a full slot's byte holds the low 7 bits of its hash so 16 slots can be screened with one compare */
+struct SwissControl {
+	static constexpr int8_t empty = -128;
+	static constexpr int8_t deleted = -2;
+	static constexpr int8_t sentinel = -1;	// marks the end of the table for iteration
+
+	static bool IsFull(int8_t ctrl)				{ return ctrl >= 0; }
+	static bool IsEmptyOrDeleted(int8_t ctrl)	{ return ctrl < sentinel; }
+};
+
+
+/* 16 control bytes probed together, every query is a bit mask with one bit per matching slot */
+class SwissGroup {
+public:
+	static constexpr size_t width = 16;
+
+#if defined(ADS_SSE2)
+	explicit SwissGroup(const int8_t* ctrl) : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+	uint32_t Match(int8_t h2) const {
+		return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl)));
+	}
+
+	uint32_t MatchEmpty() const {
+		return Match(SwissControl::empty);
+	}
+
+	uint32_t MatchEmptyOrDeleted() const {
+		return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(SwissControl::sentinel), m_ctrl)));
+	}
+
+private:
+	__m128i m_ctrl;
+#else
+	// scalar fallback, same masks one byte at a time
+	explicit SwissGroup(const int8_t* ctrl) {
+		std::memcpy(m_ctrl, ctrl, width);
+	}
+
+	uint32_t Match(int8_t h2) const {
+		uint32_t mask = 0;
+		for (size_t i = 0; i < width; ++i)
+			mask |= static_cast<uint32_t>(m_ctrl[i] == h2) << i;
+		return mask;
+	}
+
+	uint32_t MatchEmpty() const {
+		return Match(SwissControl::empty);
+	}
+
+	uint32_t MatchEmptyOrDeleted() const {
+		uint32_t mask = 0;
+		for (size_t i = 0; i < width; ++i)
+			mask |= static_cast<uint32_t>(m_ctrl[i] < SwissControl::sentinel) << i;
+		return mask;
+	}
+
+private:
+	int8_t m_ctrl[width];
+#endif
+
+public:
+	// how many slots from the start of the group are empty or deleted, iteration skips them in one step
+	uint32_t CountLeadingEmptyOrDeleted() const {
+		return static_cast<uint32_t>(std::countr_one(MatchEmptyOrDeleted()));
+	}
+};
+
+
+/* open addressing hash map storing values inline (swiss table layout), a lookup screens 16 slots per probe on their control bytes
+   and only compares keys whose 7 bit hash fragment matches, lookups are heterogeneous when Hash and KeyEqual are transparent */
+template<class K, class V, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>, class Alloc = std::allocator<std::pair<const K, V>>, class StatsPolicy = NoStats>
+class FlatHashMap {
+public:
+	using key_type = K;
+	using mapped_type = V;
+	using value_type = std::pair<const K, V>;
+	using SlotAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<value_type>;
+	using SlotTraits = std::allocator_traits<SlotAllocator>;
+	using CtrlAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<int8_t>;
+	using CtrlTraits = std::allocator_traits<CtrlAllocator>;
+
+	static constexpr bool isTransparent = requires { typename Hash::is_transparent; typename KeyEqual::is_transparent; };
+
+	/* forward iterator over the full slots, stops at the sentinel control byte */
+	template<bool IsConst>
+	class SlotIterator {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = FlatHashMap::value_type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+		using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+		SlotIterator() : m_ctrl(nullptr), m_slot(nullptr) {}
+
+		SlotIterator(const int8_t* ctrl, value_type* slot) : m_ctrl(ctrl), m_slot(slot) {}
+
+		// iterator -> const_iterator
+		template<bool OtherConst> requires (IsConst && !OtherConst)
+		SlotIterator(const SlotIterator<OtherConst>& other) : m_ctrl(other.GetCtrl()), m_slot(other.GetSlot()) {}
+
+		const int8_t* GetCtrl() const	{ return m_ctrl; }
+		value_type* GetSlot() const		{ return m_slot; }
+
+		reference operator*() const	{ return *m_slot; }
+		pointer operator->() const	{ return m_slot; }
+
+		SlotIterator& operator++() {
+			++m_ctrl;
+			++m_slot;
+			SkipEmptyOrDeleted();
+			return *this;
+		}
+
+		SlotIterator operator++(int) {
+			SlotIterator temp = *this;
+			++*this;
+			return temp;
+		}
+
+		template<bool OtherConst>
+		bool operator==(const SlotIterator<OtherConst>& other) const { return m_ctrl == other.GetCtrl(); }
+
+		void SkipEmptyOrDeleted() {
+			while (SwissControl::IsEmptyOrDeleted(*m_ctrl)) {
+				const uint32_t shift = SwissGroup(m_ctrl).CountLeadingEmptyOrDeleted();
+				m_ctrl += shift;
+				m_slot += shift;
+			}
+		}
+
+	private:
+		const int8_t* m_ctrl;
+		value_type* m_slot;
+	};
+
+	using iterator = SlotIterator<false>;
+	using const_iterator = SlotIterator<true>;
+
+
+	FlatHashMap() : m_ctrl(EmptyGroup()), m_slots(nullptr), m_capacity(0), m_size(0), m_growthLeft(0) {}
+
+	explicit FlatHashMap(const Alloc& alloc) : m_ctrl(EmptyGroup()), m_slots(nullptr), m_capacity(0), m_size(0), m_growthLeft(0), m_alloc(alloc) {}
+
+	FlatHashMap(const FlatHashMap& other)
+		: m_ctrl(EmptyGroup()), m_slots(nullptr), m_capacity(0), m_size(0), m_growthLeft(0),
+		m_hash(other.m_hash), m_equal(other.m_equal), m_alloc(SlotTraits::select_on_container_copy_construction(other.m_alloc)) {
+		Reserve(other.m_size);
+		for (const value_type& val : other)
+			TryEmplace(val.first, val.second);
+	}
+
+	// steals other's table, other is left empty
+	FlatHashMap(FlatHashMap&& other) noexcept
+		: m_ctrl(other.m_ctrl), m_slots(other.m_slots), m_capacity(other.m_capacity), m_size(other.m_size), m_growthLeft(other.m_growthLeft),
+		m_hash(std::move(other.m_hash)), m_equal(std::move(other.m_equal)), m_alloc(std::move(other.m_alloc)) {
+		m_stats.SwapLive(other.m_stats);
+		other.ResetEmpty();
+	}
+
+	~FlatHashMap() {
+		DestroyTable();
+	}
+
+	FlatHashMap& operator=(const FlatHashMap& other) {
+		if (this != &other) {
+			if constexpr (SlotTraits::propagate_on_container_copy_assignment::value) {
+				// the old table goes back to the allocator that made it before other's allocator is taken
+				if (!(m_alloc == other.m_alloc))
+					DestroyTable();
+				m_alloc = other.m_alloc;
+			}
+			Clear();
+			m_hash = other.m_hash;
+			m_equal = other.m_equal;
+			Reserve(other.m_size);
+			for (const value_type& val : other)
+				TryEmplace(val.first, val.second);
+		}
+		return *this;
+	}
+
+	FlatHashMap& operator=(FlatHashMap&& other) noexcept(SlotTraits::propagate_on_container_move_assignment::value || SlotTraits::is_always_equal::value) {
+		if (this == &other)
+			return *this;
+
+		DestroyTable();
+		// other's slots were placed by other's hasher, so it comes along with them
+		m_hash = std::move(other.m_hash);
+		m_equal = std::move(other.m_equal);
+		if constexpr (SlotTraits::propagate_on_container_move_assignment::value) {
+			m_alloc = std::move(other.m_alloc);
+		} else if (!(m_alloc == other.m_alloc)) {
+			// other's table can't be freed through m_alloc, so move the values instead
+			Reserve(other.m_size);
+			for (value_type& val : other)
+				TryEmplace(val.first, std::move(val.second));
+			other.Clear();
+			return *this;
+		}
+		m_ctrl = other.m_ctrl;
+		m_slots = other.m_slots;
+		m_capacity = other.m_capacity;
+		m_size = other.m_size;
+		m_growthLeft = other.m_growthLeft;
+		m_stats.SwapLive(other.m_stats);
+		other.ResetEmpty();
+		return *this;
+	}
+
+	size_t Size() const			{ return m_size; }
+	bool IsEmpty() const		{ return m_size == 0; }
+	size_t Capacity() const		{ return m_capacity; }
+	float LoadFactor() const	{ return m_capacity > 0 ? static_cast<float>(m_size) / m_capacity : 0.0f; }
+
+	// always zero unless StatsPolicy counts, a table is two allocations (control bytes and slots) and visits are probed groups
+	ContainerStats Stats() const	{ return m_stats.Get(); }
+	void ResetStats()				{ m_stats.Reset(); }
+
+	iterator begin()				{ iterator it(m_ctrl, m_slots); it.SkipEmptyOrDeleted(); return it; }
+	iterator end()					{ return iterator(m_ctrl + m_capacity, m_slots + m_capacity); }
+	const_iterator begin() const	{ const_iterator it(m_ctrl, m_slots); it.SkipEmptyOrDeleted(); return it; }
+	const_iterator end() const		{ return const_iterator(m_ctrl + m_capacity, m_slots + m_capacity); }
+	const_iterator cbegin() const	{ return begin(); }
+	const_iterator cend() const		{ return end(); }
+
+	iterator Find(const K& key)				{ return IteratorAt(FindIndex(key)); }
+	const_iterator Find(const K& key) const	{ return IteratorAt(FindIndex(key)); }
+	bool Contains(const K& key) const		{ return FindIndex(key) != m_capacity; }
+
+	// lookups by any type Hash and KeyEqual accept, e.g. std::string_view into a map keyed by std::string
+	template<class Key> requires isTransparent
+	iterator Find(const Key& key)				{ return IteratorAt(FindIndex(key)); }
+
+	template<class Key> requires isTransparent
+	const_iterator Find(const Key& key) const	{ return IteratorAt(FindIndex(key)); }
+
+	template<class Key> requires isTransparent
+	bool Contains(const Key& key) const			{ return FindIndex(key) != m_capacity; }
+
+	// the mapped value for key, or nullptr
+	V* Get(const K& key) {
+		const size_t i = FindIndex(key);
+		return i != m_capacity ? &m_slots[i].second : nullptr;
+	}
+
+	const V* Get(const K& key) const {
+		const size_t i = FindIndex(key);
+		return i != m_capacity ? &m_slots[i].second : nullptr;
+	}
+
+	template<class Key> requires isTransparent
+	V* Get(const Key& key) {
+		const size_t i = FindIndex(key);
+		return i != m_capacity ? &m_slots[i].second : nullptr;
+	}
+
+	// constructs the value from args only if key isn't present, the bool is true when it was inserted
+	template<class... Args>
+	std::pair<iterator, bool> TryEmplace(const K& key, Args&&... args)	{ return EmplaceKey(key, std::forward<Args>(args)...); }
+
+	template<class... Args>
+	std::pair<iterator, bool> TryEmplace(K&& key, Args&&... args)		{ return EmplaceKey(std::move(key), std::forward<Args>(args)...); }
+
+	std::pair<iterator, bool> Insert(const value_type& val)	{ return EmplaceKey(val.first, val.second); }
+	std::pair<iterator, bool> Insert(value_type&& val)		{ return EmplaceKey(val.first, std::move(val.second)); }
+
+	template<class Val>
+	std::pair<iterator, bool> InsertOrAssign(const K& key, Val&& val) {
+		auto result = EmplaceKey(key, std::forward<Val>(val));
+		if (!result.second)
+			result.first->second = std::forward<Val>(val);
+		return result;
+	}
+
+	V& operator[](const K& key)	{ return EmplaceKey(key).first->second; }
+	V& operator[](K&& key)		{ return EmplaceKey(std::move(key)).first->second; }
+
+	// removes key, returns how many values were removed
+	size_t Erase(const K& key) {
+		const size_t i = FindIndex(key);
+		if (i == m_capacity)
+			return 0;
+		EraseAt(i);
+		return 1;
+	}
+
+	template<class Key> requires isTransparent
+	size_t Erase(const Key& key) {
+		const size_t i = FindIndex(key);
+		if (i == m_capacity)
+			return 0;
+		EraseAt(i);
+		return 1;
+	}
+
+	// erasing never moves other values, so iterators to them stay valid
+	void Erase(const_iterator pos) {
+		EraseAt(static_cast<size_t>(pos.GetCtrl() - m_ctrl));
+	}
+
+	// destroys every value, the table is kept for reuse
+	void Clear() {
+		if (m_capacity == 0)
+			return;
+		DestroySlots();
+		ResetCtrl();
+		m_size = 0;
+		m_growthLeft = CapacityToGrowth(m_capacity);
+	}
+
+	// sizes the table so count values fit without rehashing
+	void Reserve(size_t count) {
+		if (count > m_size + m_growthLeft)
+			Resize(NormalizeCapacity(count + (count - 1) / 7));
+	}
+
+private:
+	// table capacities are 2^n - 1 so the mask is the capacity, and at least a group wide
+	static size_t NormalizeCapacity(size_t count) {
+		return std::max<size_t>(SwissGroup::width, std::bit_ceil(count + 1)) - 1;
+	}
+
+	// max load factor 7/8
+	static size_t CapacityToGrowth(size_t capacity) {
+		return capacity - capacity / 8;
+	}
+
+	static int8_t* EmptyGroup() {
+		alignas(16) static const int8_t group[SwissGroup::width] = { SwissControl::sentinel,
+			SwissControl::empty, SwissControl::empty, SwissControl::empty, SwissControl::empty, SwissControl::empty,
+			SwissControl::empty, SwissControl::empty, SwissControl::empty, SwissControl::empty, SwissControl::empty,
+			SwissControl::empty, SwissControl::empty, SwissControl::empty, SwissControl::empty, SwissControl::empty };
+		// never written, every insert into an empty map resizes first
+		return const_cast<int8_t*>(group);
+	}
+
+	// finalises the user hash so weak ones (the identity hash of integers) still spread over H1 and H2
+	template<class Key>
+	size_t HashOf(const Key& key) const {
+		uint64_t h = static_cast<uint64_t>(m_hash(key));
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdull;
+		h ^= h >> 33;
+		return static_cast<size_t>(h);
+	}
+
+	static size_t H1(size_t hash)	{ return hash >> 7; }
+	static int8_t H2(size_t hash)	{ return static_cast<int8_t>(hash & 0x7F); }
+
+	iterator IteratorAt(size_t i)				{ return iterator(m_ctrl + i, m_slots + i); }
+	const_iterator IteratorAt(size_t i) const	{ return const_iterator(m_ctrl + i, m_slots + i); }
+
+	// index of key's slot, or m_capacity when it isn't present
+	template<class Key>
+	size_t FindIndex(const Key& key) const {
+		const size_t hash = HashOf(key);
+		const int8_t h2 = H2(hash);
+		size_t offset = H1(hash) & m_capacity;
+		// triangular probing over groups visits every group once when the group count is a power of two
+		for (size_t step = SwissGroup::width;; step += SwissGroup::width) {
+			m_stats.OnVisit();
+			const SwissGroup group(m_ctrl + offset);
+			for (uint32_t match = group.Match(h2); match != 0; match &= match - 1) {
+				const size_t i = (offset + std::countr_zero(match)) & m_capacity;
+				if (m_equal(m_slots[i].first, key))
+					return i;
+			}
+			if (group.MatchEmpty() != 0)
+				return m_capacity;
+			offset = (offset + step) & m_capacity;
+		}
+	}
+
+	// first empty or deleted slot on hash's probe sequence
+	size_t FindFirstNonFull(size_t hash) const {
+		size_t offset = H1(hash) & m_capacity;
+		for (size_t step = SwissGroup::width;; step += SwissGroup::width) {
+			m_stats.OnVisit();
+			const uint32_t mask = SwissGroup(m_ctrl + offset).MatchEmptyOrDeleted();
+			if (mask != 0)
+				return (offset + std::countr_zero(mask)) & m_capacity;
+			offset = (offset + step) & m_capacity;
+		}
+	}
+
+	template<class Key, class... Args>
+	std::pair<iterator, bool> EmplaceKey(Key&& key, Args&&... args) {
+		const size_t hash = HashOf(key);
+		size_t i = FindIndex(key);
+		if (i != m_capacity)
+			return { IteratorAt(i), false };
+
+		i = FindFirstNonFull(hash);
+		if (m_growthLeft == 0 && m_ctrl[i] != SwissControl::deleted) {
+			// args may refer to values in the table that growing moves and frees, so the entry is built first and moved in after
+			value_type entry(std::piecewise_construct, std::forward_as_tuple(std::forward<Key>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+			RehashAndGrow();
+			i = FindFirstNonFull(hash);
+			// entry is a local about to go away, so its const key can be moved from
+			SlotTraits::construct(m_alloc, m_slots + i, std::move(const_cast<K&>(entry.first)), std::move(entry.second));
+		} else {
+			SlotTraits::construct(m_alloc, m_slots + i, std::piecewise_construct,
+				std::forward_as_tuple(std::forward<Key>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+		}
+		if (m_ctrl[i] == SwissControl::empty)
+			--m_growthLeft;
+		SetCtrl(i, H2(hash));
+		++m_size;
+		return { IteratorAt(i), true };
+	}
+
+	void EraseAt(size_t i) {
+		SlotTraits::destroy(m_alloc, m_slots + i);
+		--m_size;
+
+		// if no probe run can have passed over this slot it can go straight back to empty, otherwise it has to stay a tombstone
+		const uint32_t emptyAfter = SwissGroup(m_ctrl + i).MatchEmpty();
+		const uint32_t emptyBefore = SwissGroup(m_ctrl + ((i - SwissGroup::width) & m_capacity)).MatchEmpty();
+		const bool wasNeverFull = emptyBefore != 0 && emptyAfter != 0 &&
+			static_cast<size_t>(std::countr_zero(emptyAfter) + std::countl_zero(static_cast<uint16_t>(emptyBefore))) < SwissGroup::width;
+		if (wasNeverFull) {
+			SetCtrl(i, SwissControl::empty);
+			++m_growthLeft;
+		} else {
+			SetCtrl(i, SwissControl::deleted);
+		}
+	}
+
+	// writes the control byte and its clone past the end, so a group load that wraps around still sees the first bytes
+	void SetCtrl(size_t i, int8_t ctrl) {
+		constexpr size_t cloned = SwissGroup::width - 1;
+		m_ctrl[i] = ctrl;
+		m_ctrl[((i - cloned) & m_capacity) + cloned] = ctrl;
+	}
+
+	// grows the table, or just rehashes in place at the same capacity when tombstones rather than values filled it
+	void RehashAndGrow() {
+		if (m_capacity > 0 && m_size * 32 <= m_capacity * 25)
+			Resize(m_capacity);
+		else
+			Resize(m_capacity == 0 ? SwissGroup::width - 1 : m_capacity * 2 + 1);
+	}
+
+	void Resize(size_t capacity) {
+		int8_t* oldCtrl = m_ctrl;
+		value_type* oldSlots = m_slots;
+		const size_t oldCapacity = m_capacity;
+
+		CtrlAllocator ctrlAlloc(m_alloc);
+		m_ctrl = CtrlTraits::allocate(ctrlAlloc, capacity + SwissGroup::width);
+		m_stats.OnAllocate(capacity + SwissGroup::width);
+		m_slots = SlotTraits::allocate(m_alloc, capacity);
+		m_stats.OnAllocate(capacity * sizeof(value_type));
+		m_capacity = capacity;
+		ResetCtrl();
+
+		for (size_t i = 0; i < oldCapacity; ++i) {
+			if (!SwissControl::IsFull(oldCtrl[i]))
+				continue;
+			const size_t hash = HashOf(oldSlots[i].first);
+			const size_t target = FindFirstNonFull(hash);
+			// the old slot is destroyed right away, so its const key can be moved from
+			SlotTraits::construct(m_alloc, m_slots + target, std::move(const_cast<K&>(oldSlots[i].first)), std::move(oldSlots[i].second));
+			SlotTraits::destroy(m_alloc, oldSlots + i);
+			SetCtrl(target, H2(hash));
+		}
+		m_growthLeft = CapacityToGrowth(m_capacity) - m_size;
+
+		if (oldCapacity > 0)
+			FreeTable(oldCtrl, oldSlots, oldCapacity);
+	}
+
+	void ResetCtrl() {
+		std::memset(m_ctrl, static_cast<unsigned char>(SwissControl::empty), m_capacity + SwissGroup::width);
+		m_ctrl[m_capacity] = SwissControl::sentinel;
+	}
+
+	void DestroySlots() {
+		if constexpr (!std::is_trivially_destructible_v<value_type>) {
+			for (size_t i = 0; i < m_capacity; ++i) {
+				if (SwissControl::IsFull(m_ctrl[i]))
+					SlotTraits::destroy(m_alloc, m_slots + i);
+			}
+		}
+	}
+
+	void DestroyTable() {
+		if (m_capacity == 0)
+			return;
+		DestroySlots();
+		FreeTable(m_ctrl, m_slots, m_capacity);
+		ResetEmpty();
+	}
+
+	void FreeTable(int8_t* ctrl, value_type* slots, size_t capacity) {
+		CtrlAllocator ctrlAlloc(m_alloc);
+		CtrlTraits::deallocate(ctrlAlloc, ctrl, capacity + SwissGroup::width);
+		m_stats.OnFree(capacity + SwissGroup::width);
+		SlotTraits::deallocate(m_alloc, slots, capacity);
+		m_stats.OnFree(capacity * sizeof(value_type));
+	}
+
+	void ResetEmpty() {
+		m_ctrl = EmptyGroup();
+		m_slots = nullptr;
+		m_capacity = 0;
+		m_size = 0;
+		m_growthLeft = 0;
+	}
+
+	int8_t* m_ctrl;			// m_capacity + 1 bytes, then a clone of the first width - 1 so group loads never wrap
+	value_type* m_slots;
+	size_t m_capacity;
+	size_t m_size;
+	size_t m_growthLeft;	// inserts into empty slots left before the table has to grow
+	ADS_NO_UNIQUE_ADDRESS Hash m_hash;
+	ADS_NO_UNIQUE_ADDRESS KeyEqual m_equal;
+	ADS_NO_UNIQUE_ADDRESS SlotAllocator m_alloc;
+	ADS_NO_UNIQUE_ADDRESS StatsPolicy m_stats;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_FLAT_HASH_MAP_H
\ No newline at end of file
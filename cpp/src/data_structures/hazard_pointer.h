@@ -0,0 +1,179 @@
+#ifndef DATA_STRUCTURES_HAZARD_POINTER_H
+#define DATA_STRUCTURES_HAZARD_POINTER_H
+
+#include "pch.h"
+#include "data_structures/cache_line.h"
+
+namespace ads {
+
+/* process wide hazard pointer registry, every thread that touches it owns one record of hazard slots plus its own retired list */
+class HazardPointerDomain {
+public:
+	static constexpr size_t slotsPerThread = 2;
+	static constexpr size_t minScanThreshold = 64;
+
+	struct Retired {
+		void* pointer;
+		void (*deleter)(void*);
+	};
+
+	struct alignas(cacheLineSize) Record {
+		Record() : active(true), next(nullptr) {
+			for (std::atomic<const void*>& hazard : hazards)
+				hazard.store(nullptr, std::memory_order_relaxed);
+		}
+
+		std::atomic<const void*> hazards[slotsPerThread];
+		std::atomic<bool> active;
+		Record* next;
+		std::vector<Retired> retired;	// only touched by the owning thread
+	};
+
+	// never destroyed, threads may still retire nodes while static objects are being torn down
+	static HazardPointerDomain& Instance() {
+		static HazardPointerDomain* domain = new HazardPointerDomain();
+		return *domain;
+	}
+
+	HazardPointerDomain(const HazardPointerDomain&) = delete;
+	HazardPointerDomain& operator=(const HazardPointerDomain&) = delete;
+
+	// the calling thread's record, acquired on first use and handed back when the thread exits
+	Record* ThreadRecord() {
+		struct RecordHolder {
+			~RecordHolder() {
+				if (record != nullptr)
+					HazardPointerDomain::Instance().ReleaseRecord(record);
+			}
+			Record* record = nullptr;
+		};
+		thread_local RecordHolder holder;
+		if (holder.record == nullptr)
+			holder.record = AcquireRecord();
+		return holder.record;
+	}
+
+	// queues p to be passed to deleter once no hazard slot points at it
+	void Retire(void* p, void (*deleter)(void*)) {
+		Record* record = ThreadRecord();
+		record->retired.push_back({ p, deleter });
+		if (record->retired.size() >= std::max(minScanThreshold, 2 * slotsPerThread * m_recordCount.load(std::memory_order_relaxed)))
+			Scan(record);
+	}
+
+	// frees every retired pointer of the calling thread that is no longer protected
+	void Scan() {
+		Scan(ThreadRecord());
+	}
+
+private:
+	HazardPointerDomain() : m_records(nullptr), m_recordCount(0) {}
+
+	Record* AcquireRecord() {
+		// reuse a record left behind by an exited thread first
+		for (Record* record = m_records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+			bool expected = false;
+			if (!record->active.load(std::memory_order_relaxed) && record->active.compare_exchange_strong(expected, true, std::memory_order_acquire))
+				return record;
+		}
+
+		// records are never freed, so pushing onto the list only has to race other pushes
+		Record* record = new Record();
+		Record* head = m_records.load(std::memory_order_relaxed);
+		do {
+			record->next = head;
+		} while (!m_records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+		m_recordCount.fetch_add(1, std::memory_order_relaxed);
+		return record;
+	}
+
+	void ReleaseRecord(Record* record) {
+		for (std::atomic<const void*>& hazard : record->hazards)
+			hazard.store(nullptr, std::memory_order_release);
+		Scan(record);
+		if (!record->retired.empty()) {
+			// still protected by someone else, let a later scan on another thread pick them up
+			std::lock_guard<std::mutex> lock(m_orphanMutex);
+			m_orphans.insert(m_orphans.end(), record->retired.begin(), record->retired.end());
+			record->retired.clear();
+		}
+		record->active.store(false, std::memory_order_release);
+	}
+
+	void Scan(Record* record) {
+		// adopt whatever exited threads could not free
+		if (m_orphanMutex.try_lock()) {
+			record->retired.insert(record->retired.end(), m_orphans.begin(), m_orphans.end());
+			m_orphans.clear();
+			m_orphanMutex.unlock();
+		}
+
+		std::vector<const void*> hazards;
+		for (Record* iter = m_records.load(std::memory_order_acquire); iter != nullptr; iter = iter->next) {
+			for (const std::atomic<const void*>& hazard : iter->hazards) {
+				const void* p = hazard.load(std::memory_order_seq_cst);
+				if (p != nullptr)
+					hazards.push_back(p);
+			}
+		}
+		std::sort(hazards.begin(), hazards.end());
+
+		size_t kept = 0;
+		for (const Retired& retired : record->retired) {
+			if (std::binary_search(hazards.begin(), hazards.end(), static_cast<const void*>(retired.pointer)))
+				record->retired[kept++] = retired;
+			else
+				retired.deleter(retired.pointer);
+		}
+		record->retired.resize(kept);
+	}
+
+	std::atomic<Record*> m_records;
+	std::atomic<size_t> m_recordCount;
+	std::mutex m_orphanMutex;
+	std::vector<Retired> m_orphans;
+};
+
+
+/* owns one of the calling thread's hazard slots, anything Protect returns is safe to dereference until the slot is cleared */
+class HazardPointer {
+public:
+	explicit HazardPointer(size_t slot) : m_slot(&HazardPointerDomain::Instance().ThreadRecord()->hazards[slot]) {}
+
+	HazardPointer(const HazardPointer&) = delete;
+	HazardPointer& operator=(const HazardPointer&) = delete;
+
+	~HazardPointer() {
+		Clear();
+	}
+
+	// publishes src's current value and re-reads src until the published value is still current
+	template<class P>
+	P* Protect(const std::atomic<P*>& src) {
+		P* p = src.load(std::memory_order_relaxed);
+		while (true) {
+			m_slot->store(p, std::memory_order_seq_cst);
+			P* again = src.load(std::memory_order_acquire);
+			if (again == p)
+				return p;
+			p = again;
+		}
+	}
+
+	void Clear() {
+		m_slot->store(nullptr, std::memory_order_release);
+	}
+
+	// hands p to the domain, it is deleted once no hazard slot points at it
+	template<class P>
+	static void Retire(P* p) {
+		HazardPointerDomain::Instance().Retire(p, [](void* q) { delete static_cast<P*>(q); });
+	}
+
+private:
+	std::atomic<const void*>* m_slot;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_HAZARD_POINTER_H
\ No newline at end of file
@@ -0,0 +1,233 @@
+#ifndef DATA_STRUCTURES_INTRUSIVE_LIST_H
+#define DATA_STRUCTURES_INTRUSIVE_LIST_H
+
+#include "pch.h"
+
+namespace ads {
+
+/* prev/next links an object embeds once for every intrusive list it can be in, unlinks itself when destroyed */
+class IntrusiveListHook {
+public:
+	IntrusiveListHook() : next(nullptr), prev(nullptr) {}
+
+	// copying an object does not copy its list membership
+	IntrusiveListHook(const IntrusiveListHook&) : next(nullptr), prev(nullptr) {}
+
+	IntrusiveListHook& operator=(const IntrusiveListHook&) { return *this; }
+
+	~IntrusiveListHook() {
+		Unlink();
+	}
+
+	bool IsLinked() const { return next != nullptr; }
+
+	// removes the owner from whatever list it is in, O(1) and safe to call when not linked
+	void Unlink() {
+		if (next != nullptr) {
+			prev->next = next;
+			next->prev = prev;
+			next = nullptr;
+			prev = nullptr;
+		}
+	}
+
+	IntrusiveListHook* next;
+	IntrusiveListHook* prev;
+};
+
+
+/* doubly linked list of objects that embed their own IntrusiveListHook, the list never allocates or owns its elements;
+   HookOffset is offsetof(T, hook) for the hook this list links through, which is what maps a hook back to its object */
+template<class T, size_t HookOffset>
+class IntrusiveList {
+public:
+	template<bool IsConst>
+	class HookIterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = std::conditional_t<IsConst, const T*, T*>;
+		using reference = std::conditional_t<IsConst, const T&, T&>;
+
+		HookIterator() : m_hook(nullptr) {}
+
+		explicit HookIterator(IntrusiveListHook* hook) : m_hook(hook) {}
+
+		// iterator -> const_iterator
+		template<bool OtherConst> requires (IsConst && !OtherConst)
+		HookIterator(const HookIterator<OtherConst>& other) : m_hook(other.GetHook()) {}
+
+		IntrusiveListHook* GetHook() const { return m_hook; }
+
+		reference operator*() const	{ return *FromHook(m_hook); }
+		pointer operator->() const	{ return FromHook(m_hook); }
+
+		HookIterator& operator++() {
+			m_hook = m_hook->next;
+			return *this;
+		}
+
+		HookIterator operator++(int) {
+			HookIterator temp = *this;
+			m_hook = m_hook->next;
+			return temp;
+		}
+
+		HookIterator& operator--() {
+			m_hook = m_hook->prev;
+			return *this;
+		}
+
+		HookIterator operator--(int) {
+			HookIterator temp = *this;
+			m_hook = m_hook->prev;
+			return temp;
+		}
+
+		template<bool OtherConst>
+		bool operator==(const HookIterator<OtherConst>& other) const { return m_hook == other.GetHook(); }
+
+	private:
+		IntrusiveListHook* m_hook;
+	};
+
+	using value_type = T;
+	using iterator = HookIterator<false>;
+	using const_iterator = HookIterator<true>;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+
+	IntrusiveList() {
+		m_root.next = &m_root;
+		m_root.prev = &m_root;
+	}
+
+	IntrusiveList(const IntrusiveList&) = delete;
+	IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+	// takes over other's elements, other is left empty
+	IntrusiveList(IntrusiveList&& other) noexcept : IntrusiveList() {
+		TakeLinks(other);
+	}
+
+	IntrusiveList& operator=(IntrusiveList&& other) noexcept {
+		if (this != &other) {
+			Clear();
+			TakeLinks(other);
+		}
+		return *this;
+	}
+
+	// unlinks every element, the elements themselves are untouched
+	~IntrusiveList() {
+		Clear();
+	}
+
+	bool IsEmpty() const	{ return m_root.next == &m_root; }
+
+	T& Front()				{ return *FromHook(m_root.next); }
+	T& Back()				{ return *FromHook(m_root.prev); }
+	const T& Front() const	{ return *FromHook(m_root.next); }
+	const T& Back() const	{ return *FromHook(m_root.prev); }
+
+	iterator begin()						{ return iterator(m_root.next); }
+	iterator end()							{ return iterator(&m_root); }
+	const_iterator begin() const			{ return const_iterator(m_root.next); }
+	const_iterator end() const				{ return const_iterator(Root()); }
+	const_iterator cbegin() const			{ return const_iterator(m_root.next); }
+	const_iterator cend() const				{ return const_iterator(Root()); }
+	reverse_iterator rbegin()				{ return reverse_iterator(end()); }
+	reverse_iterator rend()					{ return reverse_iterator(begin()); }
+	const_reverse_iterator rbegin() const	{ return const_reverse_iterator(end()); }
+	const_reverse_iterator rend() const		{ return const_reverse_iterator(begin()); }
+
+	// returns an iterator to val, which must be linked into this list
+	static iterator IteratorTo(T& val) { return iterator(&HookOf(val)); }
+
+	// links val at the end of the list, val must not already be linked through its hook
+	void Append(T& val)		{ LinkBefore(&m_root, &HookOf(val)); }
+
+	// links val at the head of the list, val must not already be linked through its hook
+	void Prepend(T& val)	{ LinkBefore(m_root.next, &HookOf(val)); }
+
+	// links val before pos
+	iterator Insert(const_iterator pos, T& val) {
+		LinkBefore(pos.GetHook(), &HookOf(val));
+		return iterator(&HookOf(val));
+	}
+
+	// unlinks val from the list it is in, O(1)
+	static void Remove(T& val) { HookOf(val).Unlink(); }
+
+	// unlinks the element at pos and returns the element after it
+	iterator Erase(const_iterator pos) {
+		IntrusiveListHook* hook = pos.GetHook();
+		IntrusiveListHook* next = hook->next;
+		hook->Unlink();
+		return iterator(next);
+	}
+
+	T& PopFront() {
+		T& val = Front();
+		m_root.next->Unlink();
+		return val;
+	}
+
+	T& PopBack() {
+		T& val = Back();
+		m_root.prev->Unlink();
+		return val;
+	}
+
+	// unlinks every element
+	void Clear() {
+		IntrusiveListHook* iter = m_root.next;
+		while (iter != &m_root) {
+			IntrusiveListHook* temp = iter;
+			iter = iter->next;
+			temp->next = nullptr;
+			temp->prev = nullptr;
+		}
+		m_root.next = &m_root;
+		m_root.prev = &m_root;
+	}
+
+private:
+	static IntrusiveListHook& HookOf(T& val) {
+		return *reinterpret_cast<IntrusiveListHook*>(reinterpret_cast<std::byte*>(std::addressof(val)) + HookOffset);
+	}
+
+	// maps a hook back to the object embedding it
+	static T* FromHook(IntrusiveListHook* hook) {
+		return reinterpret_cast<T*>(reinterpret_cast<std::byte*>(hook) - HookOffset);
+	}
+
+	IntrusiveListHook* Root() const { return const_cast<IntrusiveListHook*>(&m_root); }
+
+	void LinkBefore(IntrusiveListHook* pos, IntrusiveListHook* hook) {
+		hook->next = pos;
+		hook->prev = pos->prev;
+		pos->prev->next = hook;
+		pos->prev = hook;
+	}
+
+	void TakeLinks(IntrusiveList& other) {
+		if (other.IsEmpty())
+			return;
+		m_root.next = other.m_root.next;
+		m_root.prev = other.m_root.prev;
+		m_root.next->prev = &m_root;
+		m_root.prev->next = &m_root;
+		other.m_root.next = &other.m_root;
+		other.m_root.prev = &other.m_root;
+	}
+
+	// sentinel, the list is circular through it so unlinking never needs the list itself
+	IntrusiveListHook m_root;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_INTRUSIVE_LIST_H
\ No newline at end of file
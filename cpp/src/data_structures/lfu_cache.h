@@ -0,0 +1,203 @@
+#ifndef DATA_STRUCTURES_LFU_CACHE_H
+#define DATA_STRUCTURES_LFU_CACHE_H
+
+#include "pch.h"
+#include "data_structures/cache_index.h"
+#include "data_structures/intrusive_list.h"
+#include "data_structures/pool_allocator.h"
+
+namespace ads {
+
+/* least frequently used cache with O(1) hits and evictions, entries hang off a list of frequency buckets kept in ascending order
+   ties within a frequency are broken by recency, capacity is bounded by an entry count, a byte budget or both */
+template<class K, class V, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>>
+class LfuCache {
+public:
+	struct Bucket;
+
+	struct Entry {
+		template<class Key, class Val>
+		Entry(Key&& k, Val&& v, size_t h, size_t b) : key(std::forward<Key>(k)), value(std::forward<Val>(v)), hash(h), bytes(b), bucket(nullptr) {}
+
+		K key;
+		V value;
+		size_t hash;
+		size_t bytes;
+		Bucket* bucket;
+		IntrusiveListHook hook;		// in bucket->entries, most recently used at the front
+	};
+
+	typedef IntrusiveList<Entry, offsetof(Entry, hook)> EntryList;
+
+	struct Bucket {
+		explicit Bucket(uint64_t f) : frequency(f) {}
+
+		uint64_t frequency;
+		EntryList entries;
+		IntrusiveListHook hook;		// in m_buckets
+	};
+
+	static constexpr size_t defaultEntryBytes = sizeof(K) + sizeof(V);
+
+
+	explicit LfuCache(size_t maxEntries, size_t maxBytes = SIZE_MAX)
+		: m_maxEntries(std::max<size_t>(maxEntries, 1)), m_maxBytes(maxBytes), m_bytes(0),
+		m_entryPool(sizeof(Entry), alignof(Entry)), m_bucketPool(sizeof(Bucket), alignof(Bucket)) {
+		if (maxEntries != SIZE_MAX) {
+			m_index.Reserve(m_maxEntries);
+			m_entryPool.Reserve(m_maxEntries);
+			m_bucketPool.Reserve(m_maxEntries);
+		}
+	}
+
+	LfuCache(const LfuCache&) = delete;
+	LfuCache& operator=(const LfuCache&) = delete;
+
+	~LfuCache() {
+		Clear();
+	}
+
+	size_t Size() const				{ return m_index.Size(); }
+	size_t Bytes() const			{ return m_bytes; }
+	size_t MaxEntries() const		{ return m_maxEntries; }
+	size_t MaxBytes() const			{ return m_maxBytes; }
+	const CacheStats& Stats() const	{ return m_stats; }
+	void ResetStats()				{ m_stats = CacheStats(); }
+
+	// returns the cached value and bumps its use count, or nullptr on a miss
+	// never calls operator new, Put keeps enough bucket blocks reserved for every entry to sit in its own bucket
+	V* Get(const K& key) {
+		Entry* entry = m_index.Find(key, m_index.HashOf(key));
+		if (entry == nullptr) {
+			++m_stats.misses;
+			return nullptr;
+		}
+		++m_stats.hits;
+		Touch(entry);
+		return &entry->value;
+	}
+
+	// returns the cached value without touching its use count or the counters
+	const V* Peek(const K& key) const {
+		const Entry* entry = m_index.Find(key, m_index.HashOf(key));
+		return entry != nullptr ? &entry->value : nullptr;
+	}
+
+	bool Contains(const K& key) const {
+		return Peek(key) != nullptr;
+	}
+
+	// how often key has been put or hit, 0 when it isn't cached
+	uint64_t Frequency(const K& key) const {
+		const Entry* entry = m_index.Find(key, m_index.HashOf(key));
+		return entry != nullptr ? entry->bucket->frequency : 0;
+	}
+
+	// inserts a new value with a use count of 1, or replaces an existing one and bumps its count, then evicts until the limits hold again
+	template<class Val>
+	V& Put(const K& key, Val&& value, size_t bytes = defaultEntryBytes) {
+		const size_t hash = m_index.HashOf(key);
+		Entry* entry = m_index.Find(key, hash);
+		if (entry != nullptr) {
+			entry->value = std::forward<Val>(value);
+			m_bytes = m_bytes - entry->bytes + bytes;
+			entry->bytes = bytes;
+			Touch(entry);
+		} else {
+			entry = ::new (m_entryPool.Allocate()) Entry(key, std::forward<Val>(value), hash, bytes);
+			m_index.Insert(entry);
+			m_bytes += bytes;
+			if (m_buckets.IsEmpty() || m_buckets.Front().frequency != 1)
+				m_buckets.Prepend(*CreateBucket(1));
+			entry->bucket = &m_buckets.Front();
+			entry->bucket->entries.Prepend(*entry);
+			m_bucketPool.Reserve(Size());
+		}
+		EvictOverLimit(entry);
+		return entry->value;
+	}
+
+	// removes key, returns false if it wasn't cached
+	bool Erase(const K& key) {
+		Entry* entry = m_index.Find(key, m_index.HashOf(key));
+		if (entry == nullptr)
+			return false;
+		DestroyEntry(entry);
+		return true;
+	}
+
+	// drops every entry, the counters are kept
+	void Clear() {
+		while (!m_buckets.IsEmpty())
+			DestroyEntry(&m_buckets.Front().entries.Back());
+	}
+
+private:
+	typedef IntrusiveList<Bucket, offsetof(Bucket, hook)> BucketList;
+
+	// moves entry into the bucket one frequency up, creating it if needed and freeing the old bucket if it empties
+	void Touch(Entry* entry) {
+		Bucket* bucket = entry->bucket;
+		auto next = std::next(BucketList::IteratorTo(*bucket));
+		const bool nextFits = next != m_buckets.end() && next->frequency == bucket->frequency + 1;
+
+		if (!nextFits && &bucket->entries.Front() == &bucket->entries.Back()) {
+			// only entry in its bucket, bump the bucket itself
+			++bucket->frequency;
+			return;
+		}
+
+		Bucket* target = nextFits ? &*next : &*m_buckets.Insert(next, *CreateBucket(bucket->frequency + 1));
+		EntryList::Remove(*entry);
+		target->entries.Prepend(*entry);
+		entry->bucket = target;
+		if (bucket->entries.IsEmpty())
+			DestroyBucket(bucket);
+	}
+
+	// evicts the least frequently used entry, least recently used among equals, until the limits hold, keep always stays
+	void EvictOverLimit(const Entry* keep) {
+		while ((Size() > m_maxEntries || m_bytes > m_maxBytes) && Size() > 1) {
+			Bucket& lowest = m_buckets.Front();
+			Entry* victim = &lowest.entries.Back();
+			if (victim == keep) {
+				// keep was just touched so it is at the front of its bucket, it can only be the back when it is alone
+				victim = &std::next(BucketList::IteratorTo(lowest))->entries.Back();
+			}
+			DestroyEntry(victim);
+			++m_stats.evictions;
+		}
+	}
+
+	Bucket* CreateBucket(uint64_t frequency) {
+		return ::new (m_bucketPool.Allocate()) Bucket(frequency);
+	}
+
+	void DestroyBucket(Bucket* bucket) {
+		std::destroy_at(bucket);
+		m_bucketPool.Deallocate(bucket);
+	}
+
+	void DestroyEntry(Entry* entry) {
+		Bucket* bucket = entry->bucket;
+		m_index.Erase(entry);
+		m_bytes -= entry->bytes;
+		std::destroy_at(entry);
+		m_entryPool.Deallocate(entry);
+		if (bucket->entries.IsEmpty())
+			DestroyBucket(bucket);
+	}
+
+	size_t m_maxEntries;
+	size_t m_maxBytes;
+	size_t m_bytes;
+	CacheStats m_stats;
+	SlabPool m_entryPool;
+	SlabPool m_bucketPool;
+	CacheIndex<Entry, Hash, KeyEqual> m_index;
+	BucketList m_buckets;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_LFU_CACHE_H
\ No newline at end of file
@@ -2,16 +2,25 @@
 #define DATA_STRUCTURES_LINKED_LIST_H
 
 #include "pch.h"
+#include "data_structures/container_stats.h"
+#include "data_structures/list_iterator.h"
+#include "data_structures/pool_allocator.h"
 
 namespace ads {
 
-/* simple linked list class */
-template<class C>
+/* simple linked list class, nodes come from Alloc which defaults to a slab pool owned by the list, StatsPolicy can be CountingStats to see what it allocates */
+template<class C, class Alloc = PoolAllocator<C>, class StatsPolicy = NoStats>
 class LinkedList {
 public:
-	template<class C>
+	template<class T>
 	struct Node {
-		Node(const C& val) : value(val), next(nullptr) {}
+		Node(const T& val) : value(val), next(nullptr) {}
+
+		Node(T&& val) : value(std::move(val)), next(nullptr) {}
+
+		// constructs value in place from args
+		template<class... Args>
+		Node(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...), next(nullptr) {}
 
 		Node(const Node& other) : value(other.value), next(other.next) {}
 
@@ -21,82 +30,290 @@ public:
 
 		~Node() {}
 
-		C value;
+		T value;
 		Node* next;
 	};
 
+	using NodeAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node<C>>;
+	using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+	using value_type = C;
+	using iterator = ForwardNodeIterator<Node<C>, false>;
+	using const_iterator = ForwardNodeIterator<Node<C>, true>;
 
-	LinkedList() : m_head(nullptr) {}
 
-	LinkedList(const LinkedList& other) : m_head(other.m_head) {}
+	LinkedList() : m_head(nullptr), m_tail(nullptr), m_size(0) {}
+
+	explicit LinkedList(const Alloc& alloc) : m_head(nullptr), m_tail(nullptr), m_size(0), m_alloc(alloc) {}
+
+	LinkedList(const LinkedList& other) : m_head(nullptr), m_tail(nullptr), m_size(0), m_alloc(NodeTraits::select_on_container_copy_construction(other.m_alloc)) {
+		Append(other.begin(), other.end());
+	}
+
+	// steals other's nodes, other is left empty
+	LinkedList(LinkedList&& other) noexcept : m_head(other.m_head), m_tail(other.m_tail), m_size(other.m_size), m_alloc(std::move(other.m_alloc)) {
+		m_stats.SwapLive(other.m_stats);
+		other.m_head = nullptr;
+		other.m_tail = nullptr;
+		other.m_size = 0;
+	}
 
 	~LinkedList() {
-		Node<C>* temp;
-		while (m_head != nullptr) {
-			temp = m_head;
-			m_head = m_head->next;
-			delete temp;
+		Clear();
+	}
+
+	LinkedList& operator=(const LinkedList& other) {
+		if (this != &other) {
+			Clear();
+			Append(other.begin(), other.end());
+		}
+		return *this;
+	}
+
+	LinkedList& operator=(LinkedList&& other) noexcept(NodeTraits::propagate_on_container_move_assignment::value || NodeTraits::is_always_equal::value) {
+		if (this == &other)
+			return *this;
+
+		Clear();
+		if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+			m_alloc = std::move(other.m_alloc);
+		} else if (!(m_alloc == other.m_alloc)) {
+			// other's nodes can't be freed through m_alloc, so move the values instead
+			Append(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+			other.Clear();
+			return *this;
 		}
+		m_head = other.m_head;
+		m_tail = other.m_tail;
+		m_size = other.m_size;
+		m_stats.SwapLive(other.m_stats);
+		other.m_head = nullptr;
+		other.m_tail = nullptr;
+		other.m_size = 0;
+		return *this;
 	}
 
 	Node<C>* Head() const { return m_head; }
+	Node<C>* Tail() const { return m_tail; }
+
+	size_t Size() const		{ return m_size; }
+	bool IsEmpty() const	{ return m_size == 0; }
+
+	// always zero unless StatsPolicy counts
+	ContainerStats Stats() const	{ return m_stats.Get(); }
+	void ResetStats()				{ m_stats.Reset(); }
+
+	NodeAllocator GetAllocator() const { return m_alloc; }
+
+	iterator begin()				{ return iterator(m_head); }
+	iterator end()					{ return iterator(nullptr); }
+	const_iterator begin() const	{ return const_iterator(m_head); }
+	const_iterator end() const		{ return const_iterator(nullptr); }
+	const_iterator cbegin() const	{ return const_iterator(m_head); }
+	const_iterator cend() const		{ return const_iterator(nullptr); }
 
 	bool HasNext() const {
 		return m_head != nullptr && m_head->next != nullptr;
 	}
 
+	// frees every node
+	void Clear() {
+		Node<C>* temp;
+		while (m_head != nullptr) {
+			temp = m_head;
+			m_head = m_head->next;
+			DestroyNode(temp);
+		}
+		m_tail = nullptr;
+	}
+
 	// appends a new node to the end of the list
-	void Append(const C& val) {
-		if (m_head != nullptr) {
-			// already have nodes
-			Node<C>* temp = m_head;
-			while (temp->next != nullptr) {
-				temp = temp->next;
+	void Append(const C& val)	{ LinkBack(CreateNode(val)); }
+	void Append(C&& val)		{ LinkBack(CreateNode(std::move(val))); }
+
+	// appends every value in [first, last), the batch is linked up on the side and spliced onto the tail once
+	template<std::input_iterator InputIt>
+	void Append(InputIt first, InputIt last) {
+		if (first == last)
+			return;
+		if constexpr (std::forward_iterator<InputIt>)
+			ReserveNodes(m_alloc, static_cast<size_t>(std::distance(first, last)));
+
+		Node<C>* batchHead = CreateNode(*first);
+		Node<C>* batchTail = batchHead;
+		try {
+			for (++first; first != last; ++first) {
+				batchTail->next = CreateNode(*first);
+				batchTail = batchTail->next;
 			}
-			temp->next = new Node(val);
-		} else {
-			// first node
-			m_head = new Node(val);
+		} catch (...) {
+			// leave the list untouched if any node fails to construct
+			while (batchHead != nullptr) {
+				Node<C>* temp = batchHead;
+				batchHead = batchHead->next;
+				DestroyNode(temp);
+			}
+			throw;
 		}
+
+		if (m_tail != nullptr)
+			m_tail->next = batchHead;
+		else
+			m_head = batchHead;
+		m_tail = batchTail;
+	}
+
+	template<class Range>
+	void AppendRange(const Range& range) {
+		Append(std::begin(range), std::end(range));
+	}
+
+	// adds a new node to the head of the list
+	void Prepend(const C& val)	{ LinkFront(CreateNode(val)); }
+	void Prepend(C&& val)		{ LinkFront(CreateNode(std::move(val))); }
+
+	// constructs a new value in place at the end of the list
+	template<class... Args>
+	C& EmplaceBack(Args&&... args) {
+		Node<C>* node = CreateNode(std::forward<Args>(args)...);
+		LinkBack(node);
+		return node->value;
+	}
+
+	// constructs a new value in place at the head of the list
+	template<class... Args>
+	C& EmplaceFront(Args&&... args) {
+		Node<C>* node = CreateNode(std::forward<Args>(args)...);
+		LinkFront(node);
+		return node->value;
+	}
+
+	// constructs a new value in place after pos, which must not be end()
+	template<class... Args>
+	iterator EmplaceAfter(const_iterator pos, Args&&... args) {
+		Node<C>* prev = pos.GetNode();
+		Node<C>* node = CreateNode(std::forward<Args>(args)...);
+		node->next = prev->next;
+		prev->next = node;
+		if (prev == m_tail)
+			m_tail = node;
+		return iterator(node);
 	}
 
 	// remove all nodes with value
 	void Remove(const C& val) {
-		if (m_head != nullptr) {
-			// check head first
-			if (m_head != nullptr && m_head->value == val) {
-				Node<C>* temp = m_head->next;
-				delete m_head;
-				m_head = temp;
-			}
-			Node<C>* iter = m_head;
-			Node<C>* prev = m_head;
-			while (iter != nullptr) {
-				if (iter->value == val) {
-					prev->next = iter->next;
-					delete iter;
-					// only need to move iter
-					iter = prev->next;
-				} else {
-					prev = iter;
-					iter = iter->next;
-				}
+		RemoveAll(val);
+	}
+
+	// removes every node equal to val, returns how many were removed
+	size_t RemoveAll(const C& val) {
+		return RemoveIf([&val](const C& other) { return other == val; });
+	}
+
+	// removes every node pred returns true for in one pass, returns how many were removed
+	template<class Pred>
+	size_t RemoveIf(Pred pred) {
+		size_t removed = 0;
+		// link is the pointer that points at iter, either m_head or the last kept node's next
+		Node<C>** link = &m_head;
+		Node<C>* prev = nullptr;
+		while (*link != nullptr) {
+			Node<C>* iter = *link;
+			m_stats.OnVisit();
+			if (pred(iter->value)) {
+				*link = iter->next;
+				DestroyNode(iter);
+				++removed;
+			} else {
+				prev = iter;
+				link = &iter->next;
 			}
 		}
+		// the last kept node is the new tail
+		m_tail = prev;
+		return removed;
+	}
+
+	// frees the nodes after pos up to last with a single relink, pos must not be end(), returns last
+	iterator EraseRangeAfter(const_iterator pos, const_iterator last) {
+		Node<C>* prev = pos.GetNode();
+		Node<C>* stop = last.GetNode();
+		Node<C>* iter = prev->next;
+		prev->next = stop;
+		if (stop == nullptr)
+			m_tail = prev;
+		while (iter != stop) {
+			Node<C>* temp = iter;
+			iter = iter->next;
+			DestroyNode(temp);
+		}
+		return iterator(stop);
 	}
 
 private:
+	// allocates a node from m_alloc and constructs its value in place from args
+	template<class... Args>
+	Node<C>* CreateNode(Args&&... args) {
+		Node<C>* node = NodeTraits::allocate(m_alloc, 1);
+		try {
+			NodeTraits::construct(m_alloc, node, std::in_place, std::forward<Args>(args)...);
+		} catch (...) {
+			NodeTraits::deallocate(m_alloc, node, 1);
+			throw;
+		}
+		m_stats.OnAllocate(sizeof(Node<C>));
+		++m_size;
+		return node;
+	}
+
+	// every node a list creates is linked into it or destroyed, so counting here keeps m_size exact
+	void DestroyNode(Node<C>* node) {
+		NodeTraits::destroy(m_alloc, node);
+		NodeTraits::deallocate(m_alloc, node, 1);
+		m_stats.OnFree(sizeof(Node<C>));
+		--m_size;
+	}
+
+	void LinkBack(Node<C>* node) {
+		if (m_tail != nullptr) {
+			// already have nodes
+			m_tail->next = node;
+			m_tail = node;
+		} else {
+			// first node
+			m_head = node;
+			m_tail = node;
+		}
+	}
+
+	void LinkFront(Node<C>* node) {
+		node->next = m_head;
+		m_head = node;
+		if (m_tail == nullptr)
+			m_tail = node;
+	}
+
 	Node<C>* m_head;
+	Node<C>* m_tail;
+	size_t m_size;
+	NodeAllocator m_alloc;
+	ADS_NO_UNIQUE_ADDRESS StatsPolicy m_stats;
 };
 
 
-/* linked list class that also tracks the current node and the end of the list */
-template<class C>
+/* linked list class with an editing cursor, tracks the current node, the node before it and the end of the list */
+template<class C, class Alloc = PoolAllocator<C>, class StatsPolicy = NoStats>
 class TrackedLinkedList {
 public:
-	template<class C>
+	template<class T>
 	struct Node {
-		Node(const C& val) : value(val), next(nullptr) {}
+		Node(const T& val) : value(val), next(nullptr) {}
+
+		Node(T&& val) : value(std::move(val)), next(nullptr) {}
+
+		// constructs value in place from args
+		template<class... Args>
+		Node(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...), next(nullptr) {}
 
 		Node(const Node& other) : value(other.value), next(other.next) {}
 
@@ -106,28 +323,113 @@ public:
 
 		~Node() {}
 
-		C value;
+		T value;
 		Node* next;
 	};
 
+	using NodeAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node<C>>;
+	using NodeTraits = std::allocator_traits<NodeAllocator>;
 
-	TrackedLinkedList() : m_head(nullptr), m_end(nullptr), m_current(nullptr) {}
+	using value_type = C;
+	using iterator = ForwardNodeIterator<Node<C>, false>;
+	using const_iterator = ForwardNodeIterator<Node<C>, true>;
 
-	TrackedLinkedList(const TrackedLinkedList& other) : m_head(other.m_head), m_end(other.m_end), m_current(other.m_current) {}
+
+	// a remembered cursor position, see Tell and Seek
+	struct Position {
+		Node<C>* current;
+		Node<C>* previous;
+	};
+
+
+	TrackedLinkedList() : m_head(nullptr), m_end(nullptr), m_current(nullptr), m_previous(nullptr), m_size(0) {}
+
+	explicit TrackedLinkedList(const Alloc& alloc) : m_head(nullptr), m_end(nullptr), m_current(nullptr), m_previous(nullptr), m_size(0), m_alloc(alloc) {}
+
+	// copies the values, current is reset to the head of the copy
+	TrackedLinkedList(const TrackedLinkedList& other)
+		: m_head(nullptr), m_end(nullptr), m_current(nullptr), m_previous(nullptr), m_size(0), m_alloc(NodeTraits::select_on_container_copy_construction(other.m_alloc)) {
+		for (const C& val : other)
+			Append(val);
+	}
+
+	// steals other's nodes and cursor, other is left empty
+	TrackedLinkedList(TrackedLinkedList&& other) noexcept
+		: m_head(other.m_head), m_end(other.m_end), m_current(other.m_current), m_previous(other.m_previous), m_size(other.m_size), m_alloc(std::move(other.m_alloc)) {
+		m_stats.SwapLive(other.m_stats);
+		other.m_head = nullptr;
+		other.m_end = nullptr;
+		other.m_current = nullptr;
+		other.m_previous = nullptr;
+		other.m_size = 0;
+	}
 
 	~TrackedLinkedList() {
-		while (m_head != nullptr) {
-			m_current = m_head;
-			m_head = m_head->next;
-			delete m_current;
+		Clear();
+	}
+
+	TrackedLinkedList& operator=(const TrackedLinkedList& other) {
+		if (this != &other) {
+			Clear();
+			for (const C& val : other)
+				Append(val);
+		}
+		return *this;
+	}
+
+	TrackedLinkedList& operator=(TrackedLinkedList&& other) noexcept(NodeTraits::propagate_on_container_move_assignment::value || NodeTraits::is_always_equal::value) {
+		if (this == &other)
+			return *this;
+
+		Clear();
+		if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+			m_alloc = std::move(other.m_alloc);
+		} else if (!(m_alloc == other.m_alloc)) {
+			// other's nodes can't be freed through m_alloc, so move the values instead
+			for (C& val : other)
+				Append(std::move(val));
+			other.Clear();
+			return *this;
 		}
+		m_head = other.m_head;
+		m_end = other.m_end;
+		m_current = other.m_current;
+		m_previous = other.m_previous;
+		m_size = other.m_size;
+		m_stats.SwapLive(other.m_stats);
+		other.m_head = nullptr;
+		other.m_end = nullptr;
+		other.m_current = nullptr;
+		other.m_previous = nullptr;
+		other.m_size = 0;
+		return *this;
 	}
 
 	Node<C>* Head() const		{ return m_head; }
 	Node<C>* End() const		{ return m_end; }
 	Node<C>* Current() const	{ return m_current; }
 
-	void Reset()				{ m_current = m_head; }
+	size_t Size() const		{ return m_size; }
+	bool IsEmpty() const	{ return m_size == 0; }
+
+	// always zero unless StatsPolicy counts
+	ContainerStats Stats() const	{ return m_stats.Get(); }
+	void ResetStats()				{ m_stats.Reset(); }
+
+	NodeAllocator GetAllocator() const { return m_alloc; }
+
+	iterator begin()				{ return iterator(m_head); }
+	iterator end()					{ return iterator(nullptr); }
+	const_iterator begin() const	{ return const_iterator(m_head); }
+	const_iterator end() const		{ return const_iterator(nullptr); }
+	const_iterator cbegin() const	{ return const_iterator(m_head); }
+	const_iterator cend() const		{ return const_iterator(nullptr); }
+
+	// moves the cursor back to the head
+	void Reset() {
+		m_current = m_head;
+		m_previous = nullptr;
+	}
 
 	bool HasNext() const {
 		return m_current != nullptr && m_current->next != nullptr;
@@ -141,50 +443,217 @@ public:
 	Node<C>* Next() {
 		if (m_current == nullptr)
 			return nullptr;
+		m_previous = m_current;
 		m_current = m_current->next;
 		return m_current;
 	}
 
-	C CurrentValue() {
-		if (m_current != nullptr)
-			return m_current->value;
+	// moves the cursor up to n nodes forward, stopping past the end, returns how many nodes it moved
+	size_t Advance(size_t n) {
+		size_t moved = 0;
+		while (moved < n && m_current != nullptr) {
+			m_stats.OnVisit();
+			m_previous = m_current;
+			m_current = m_current->next;
+			++moved;
+		}
+		return moved;
+	}
+
+	// the cursor position, to come back to with Seek
+	Position Tell() const {
+		return { m_current, m_previous };
+	}
+
+	// returns the cursor to a position from Tell, the position is stale once its node or the node before it is erased or something is inserted between them
+	void Seek(const Position& position) {
+		m_current = position.current;
+		m_previous = position.previous;
+	}
+
+	// current must be valid
+	C& CurrentValue()				{ return m_current->value; }
+	const C& CurrentValue() const	{ return m_current->value; }
+
+	// frees every node
+	void Clear() {
+		while (m_head != nullptr) {
+			m_current = m_head;
+			m_head = m_head->next;
+			DestroyNode(m_current);
+		}
+		m_end = nullptr;
+		m_current = nullptr;
+		m_previous = nullptr;
 	}
 
 	// appends a new node to the end of the list
-	void Append(const C& val) {
-		Node<C>* node = new Node(val);
+	void Append(const C& val)	{ LinkEnd(CreateNode(val)); }
+	void Append(C&& val)		{ LinkEnd(CreateNode(std::move(val))); }
+
+	// inserts a new node after the current node, at the end when the cursor is past the end, the cursor doesn't move
+	void Insert(const C& val)	{ LinkAfterCurrent(CreateNode(val)); }
+	void Insert(C&& val)		{ LinkAfterCurrent(CreateNode(std::move(val))); }
+
+	// inserts every value in [first, last) after the current node in order, the nodes come from one pool reservation and are spliced in with a single relink, returns how many were inserted
+	template<std::input_iterator InputIt>
+	size_t InsertRange(InputIt first, InputIt last) {
+		if (first == last)
+			return 0;
+		if constexpr (std::forward_iterator<InputIt>)
+			ReserveNodes(m_alloc, static_cast<size_t>(std::distance(first, last)));
+
+		Node<C>* batchHead = CreateNode(*first);
+		Node<C>* batchTail = batchHead;
+		size_t count = 1;
+		try {
+			for (++first; first != last; ++first, ++count) {
+				batchTail->next = CreateNode(*first);
+				batchTail = batchTail->next;
+			}
+		} catch (...) {
+			// leave the list untouched if any node fails to construct
+			while (batchHead != nullptr) {
+				Node<C>* temp = batchHead;
+				batchHead = batchHead->next;
+				DestroyNode(temp);
+			}
+			throw;
+		}
+		LinkAfterCurrent(batchHead, batchTail);
+		return count;
+	}
 
+	template<class Range>
+	size_t InsertRange(const Range& range) {
+		return InsertRange(std::begin(range), std::end(range));
+	}
+
+	// frees the current node and moves the cursor to the node after it, returns the new current node
+	Node<C>* EraseCurrent() {
+		if (m_current == nullptr)
+			return nullptr;
+
+		Node<C>* next = m_current->next;
+		if (m_previous != nullptr)
+			m_previous->next = next;
+		else
+			m_head = next;
+		if (m_current == m_end)
+			m_end = m_previous;
+		DestroyNode(m_current);
+		m_current = next;
+		return m_current;
+	}
+
+	// constructs a new value in place at the end of the list
+	template<class... Args>
+	C& EmplaceBack(Args&&... args) {
+		Node<C>* node = CreateNode(std::forward<Args>(args)...);
+		LinkEnd(node);
+		return node->value;
+	}
+
+	// constructs a new value in place at the head of the list, current is left where it was
+	template<class... Args>
+	C& EmplaceFront(Args&&... args) {
+		Node<C>* node = CreateNode(std::forward<Args>(args)...);
+		node->next = m_head;
+		m_head = node;
+		if (m_end == nullptr) {
+			// first node
+			m_end = node;
+			m_current = node;
+		} else if (m_previous == nullptr) {
+			// current was the head, the new node now sits before it
+			m_previous = node;
+		}
+		return node->value;
+	}
+
+	// constructs a new value in place after the current node
+	template<class... Args>
+	C& EmplaceAfterCurrent(Args&&... args) {
+		Node<C>* node = CreateNode(std::forward<Args>(args)...);
+		LinkAfterCurrent(node);
+		return node->value;
+	}
+
+private:
+	// allocates a node from m_alloc and constructs its value in place from args
+	template<class... Args>
+	Node<C>* CreateNode(Args&&... args) {
+		Node<C>* node = NodeTraits::allocate(m_alloc, 1);
+		try {
+			NodeTraits::construct(m_alloc, node, std::in_place, std::forward<Args>(args)...);
+		} catch (...) {
+			NodeTraits::deallocate(m_alloc, node, 1);
+			throw;
+		}
+		m_stats.OnAllocate(sizeof(Node<C>));
+		++m_size;
+		return node;
+	}
+
+	// every node a list creates is linked into it or destroyed, so counting here keeps m_size exact
+	void DestroyNode(Node<C>* node) {
+		NodeTraits::destroy(m_alloc, node);
+		NodeTraits::deallocate(m_alloc, node, 1);
+		m_stats.OnFree(sizeof(Node<C>));
+		--m_size;
+	}
+
+	void LinkEnd(Node<C>* node) {
 		if (m_end != nullptr) {
-			// already have nodes
+			// already have nodes, a cursor past the end now sits on the new node
 			m_end->next = node;
+			if (m_current == nullptr)
+				m_current = node;
 			m_end = node;
 		} else {
 			// first node
 			m_head = node;
 			m_current = m_head;
+			m_previous = nullptr;
 			m_end = m_head;
 		}
 	}
 
-	// inserts a new node after the current node
-	void Insert(const C& val) {
-		Node<C>* node = new Node(val);
+	void LinkAfterCurrent(Node<C>* node) {
+		LinkAfterCurrent(node, node);
+	}
 
+	// links the detached chain first through last (inclusive) after the current node, or at the end when the cursor is past the end
+	void LinkAfterCurrent(Node<C>* first, Node<C>* last) {
 		if (m_current != nullptr) {
 			// already have nodes
-			node->next = m_current->next;
-			m_current->next = node;
+			last->next = m_current->next;
+			m_current->next = first;
+			if (m_current == m_end)
+				m_end = last;
+		} else if (m_end != nullptr) {
+			// cursor is past the end, so m_previous is the end
+			last->next = nullptr;
+			m_end->next = first;
+			m_end = last;
+			m_previous = last;
 		} else {
-			// first node
-			m_head = node;
+			// first nodes
+			last->next = nullptr;
+			m_head = first;
+			m_end = last;
 			m_current = m_head;
+			m_previous = nullptr;
 		}
 	}
 
-private:
 	Node<C>* m_head;
 	Node<C>* m_end;
 	Node<C>* m_current;
+	Node<C>* m_previous;	// node before m_current, null when m_current is the head
+	size_t m_size;
+	NodeAllocator m_alloc;
+	ADS_NO_UNIQUE_ADDRESS StatsPolicy m_stats;
 };
 
 } // namespace ads
@@ -0,0 +1,107 @@
+#ifndef DATA_STRUCTURES_LIST_ITERATOR_H
+#define DATA_STRUCTURES_LIST_ITERATOR_H
+
+#include "pch.h"
+
+namespace ads {
+
+/* forward iterator over any node type with value and next members, end is a null node */
+template<class NodeT, bool IsConst>
+class ForwardNodeIterator {
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = std::remove_cv_t<decltype(NodeT::value)>;
+	using difference_type = std::ptrdiff_t;
+	using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+	using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+	ForwardNodeIterator() : m_node(nullptr) {}
+
+	explicit ForwardNodeIterator(NodeT* node) : m_node(node) {}
+
+	// iterator -> const_iterator
+	template<bool OtherConst> requires (IsConst && !OtherConst)
+	ForwardNodeIterator(const ForwardNodeIterator<NodeT, OtherConst>& other) : m_node(other.GetNode()) {}
+
+	NodeT* GetNode() const		{ return m_node; }
+
+	reference operator*() const	{ return m_node->value; }
+	pointer operator->() const	{ return &m_node->value; }
+
+	ForwardNodeIterator& operator++() {
+		m_node = m_node->next;
+		return *this;
+	}
+
+	ForwardNodeIterator operator++(int) {
+		ForwardNodeIterator temp = *this;
+		m_node = m_node->next;
+		return temp;
+	}
+
+	template<bool OtherConst>
+	bool operator==(const ForwardNodeIterator<NodeT, OtherConst>& other) const { return m_node == other.GetNode(); }
+
+private:
+	NodeT* m_node;
+};
+
+
+/* bidirectional iterator over any node type with value, next and prev members, decrementing end goes to the list's tail */
+template<class NodeT, bool IsConst>
+class BidirectionalNodeIterator {
+public:
+	using iterator_category = std::bidirectional_iterator_tag;
+	using value_type = std::remove_cv_t<decltype(NodeT::value)>;
+	using difference_type = std::ptrdiff_t;
+	using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+	using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+	BidirectionalNodeIterator() : m_node(nullptr), m_pTail(nullptr) {}
+
+	// pTail points at the owning list's tail member so end stays valid while the list changes
+	BidirectionalNodeIterator(NodeT* node, NodeT* const* pTail) : m_node(node), m_pTail(pTail) {}
+
+	// iterator -> const_iterator
+	template<bool OtherConst> requires (IsConst && !OtherConst)
+	BidirectionalNodeIterator(const BidirectionalNodeIterator<NodeT, OtherConst>& other) : m_node(other.GetNode()), m_pTail(other.GetTailRef()) {}
+
+	NodeT* GetNode() const				{ return m_node; }
+	NodeT* const* GetTailRef() const	{ return m_pTail; }
+
+	reference operator*() const	{ return m_node->value; }
+	pointer operator->() const	{ return &m_node->value; }
+
+	BidirectionalNodeIterator& operator++() {
+		m_node = m_node->next;
+		return *this;
+	}
+
+	BidirectionalNodeIterator operator++(int) {
+		BidirectionalNodeIterator temp = *this;
+		m_node = m_node->next;
+		return temp;
+	}
+
+	BidirectionalNodeIterator& operator--() {
+		m_node = m_node != nullptr ? m_node->prev : *m_pTail;
+		return *this;
+	}
+
+	BidirectionalNodeIterator operator--(int) {
+		BidirectionalNodeIterator temp = *this;
+		--*this;
+		return temp;
+	}
+
+	template<bool OtherConst>
+	bool operator==(const BidirectionalNodeIterator<NodeT, OtherConst>& other) const { return m_node == other.GetNode(); }
+
+private:
+	NodeT* m_node;
+	NodeT* const* m_pTail;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_LIST_ITERATOR_H
\ No newline at end of file
@@ -0,0 +1,154 @@
+#ifndef DATA_STRUCTURES_LRU_CACHE_H
+#define DATA_STRUCTURES_LRU_CACHE_H
+
+#include "pch.h"
+#include "data_structures/cache_index.h"
+#include "data_structures/intrusive_list.h"
+#include "data_structures/pool_allocator.h"
+
+namespace ads {
+
+/* least recently used cache, entries sit in an intrusive recency list and an open addressing index
+   a hit only relinks the entry, capacity is bounded by an entry count, a byte budget or both */
+template<class K, class V, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>>
+class LruCache {
+public:
+	struct Entry {
+		template<class Key, class Val>
+		Entry(Key&& k, Val&& v, size_t h, size_t b) : key(std::forward<Key>(k)), value(std::forward<Val>(v)), hash(h), bytes(b) {}
+
+		K key;
+		V value;
+		size_t hash;
+		size_t bytes;
+		IntrusiveListHook hook;		// most recently used at the front
+	};
+
+	// what an entry costs against the byte budget when Put isn't given a size
+	static constexpr size_t defaultEntryBytes = sizeof(K) + sizeof(V);
+
+
+	explicit LruCache(size_t maxEntries, size_t maxBytes = SIZE_MAX)
+		: m_maxEntries(std::max<size_t>(maxEntries, 1)), m_maxBytes(maxBytes), m_bytes(0), m_entryPool(sizeof(Entry), alignof(Entry)) {
+		if (maxEntries != SIZE_MAX) {
+			m_index.Reserve(m_maxEntries);
+			m_entryPool.Reserve(m_maxEntries);
+		}
+	}
+
+	LruCache(const LruCache&) = delete;
+	LruCache& operator=(const LruCache&) = delete;
+
+	~LruCache() {
+		Clear();
+	}
+
+	size_t Size() const				{ return m_index.Size(); }
+	size_t Bytes() const			{ return m_bytes; }
+	size_t MaxEntries() const		{ return m_maxEntries; }
+	size_t MaxBytes() const			{ return m_maxBytes; }
+	const CacheStats& Stats() const	{ return m_stats; }
+	void ResetStats()				{ m_stats = CacheStats(); }
+
+	// returns the cached value and marks it most recently used, or nullptr on a miss, never allocates
+	V* Get(const K& key) {
+		Entry* entry = m_index.Find(key, m_index.HashOf(key));
+		if (entry == nullptr) {
+			++m_stats.misses;
+			return nullptr;
+		}
+		++m_stats.hits;
+		if (&m_recency.Front() != entry) {
+			RecencyList::Remove(*entry);
+			m_recency.Prepend(*entry);
+		}
+		return &entry->value;
+	}
+
+	// returns the cached value without touching recency or the counters
+	const V* Peek(const K& key) const {
+		const Entry* entry = m_index.Find(key, m_index.HashOf(key));
+		return entry != nullptr ? &entry->value : nullptr;
+	}
+
+	bool Contains(const K& key) const {
+		return Peek(key) != nullptr;
+	}
+
+	// inserts or replaces the value for key as the most recently used entry, then evicts from the least recently used end until the limits hold again
+	template<class Val>
+	V& Put(const K& key, Val&& value, size_t bytes = defaultEntryBytes) {
+		const size_t hash = m_index.HashOf(key);
+		Entry* entry = m_index.Find(key, hash);
+		if (entry != nullptr) {
+			entry->value = std::forward<Val>(value);
+			m_bytes = m_bytes - entry->bytes + bytes;
+			entry->bytes = bytes;
+			RecencyList::Remove(*entry);
+		} else {
+			entry = ::new (m_entryPool.Allocate()) Entry(key, std::forward<Val>(value), hash, bytes);
+			m_index.Insert(entry);
+			m_bytes += bytes;
+		}
+		m_recency.Prepend(*entry);
+		EvictOverLimit();
+		return entry->value;
+	}
+
+	// removes key, returns false if it wasn't cached
+	bool Erase(const K& key) {
+		Entry* entry = m_index.Find(key, m_index.HashOf(key));
+		if (entry == nullptr)
+			return false;
+		DestroyEntry(entry);
+		return true;
+	}
+
+	// the least recently used entry, the next to be evicted, or nullptr when empty
+	const Entry* Oldest() const {
+		return m_recency.IsEmpty() ? nullptr : &m_recency.Back();
+	}
+
+	// drops every entry, the counters are kept
+	void Clear() {
+		while (!m_recency.IsEmpty())
+			DestroyEntry(&m_recency.Back());
+	}
+
+	// calls fn(key, value) from most to least recently used
+	template<class Fn>
+	void ForEach(Fn&& fn) const {
+		for (const Entry& entry : m_recency)
+			fn(entry.key, entry.value);
+	}
+
+private:
+	typedef IntrusiveList<Entry, offsetof(Entry, hook)> RecencyList;
+
+	// the newest entry always stays, even when it alone is over the byte budget
+	void EvictOverLimit() {
+		while ((Size() > m_maxEntries || m_bytes > m_maxBytes) && &m_recency.Back() != &m_recency.Front()) {
+			DestroyEntry(&m_recency.Back());
+			++m_stats.evictions;
+		}
+	}
+
+	void DestroyEntry(Entry* entry) {
+		m_index.Erase(entry);
+		m_bytes -= entry->bytes;
+		std::destroy_at(entry);		// the hook unlinks itself
+		m_entryPool.Deallocate(entry);
+	}
+
+	size_t m_maxEntries;
+	size_t m_maxBytes;
+	size_t m_bytes;
+	CacheStats m_stats;
+	SlabPool m_entryPool;
+	CacheIndex<Entry, Hash, KeyEqual> m_index;
+	RecencyList m_recency;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_LRU_CACHE_H
\ No newline at end of file
@@ -0,0 +1,208 @@
+#ifndef DATA_STRUCTURES_POOL_ALLOCATOR_H
+#define DATA_STRUCTURES_POOL_ALLOCATOR_H
+
+#include "pch.h"
+
+namespace ads {
+
+/* fixed size block pool, carves blocks out of contiguous slabs and recycles freed blocks through a free list */
+class SlabPool {
+public:
+	SlabPool(size_t blockSize, size_t blockAlign, size_t firstSlabBlocks = 16, size_t maxSlabBlocks = 4096)
+		: m_blockAlign(std::max(blockAlign, alignof(FreeBlock))), m_nextSlabBlocks(firstSlabBlocks), m_maxSlabBlocks(maxSlabBlocks),
+		m_bytesReserved(0), m_freeList(nullptr), m_freeCount(0), m_cursor(nullptr), m_slabEnd(nullptr) {
+		// every block has to be able to hold a free list link and keep the next block aligned
+		m_blockSize = std::max(blockSize, sizeof(FreeBlock));
+		m_blockSize = (m_blockSize + m_blockAlign - 1) / m_blockAlign * m_blockAlign;
+	}
+
+	SlabPool(const SlabPool&) = delete;
+	SlabPool& operator=(const SlabPool&) = delete;
+
+	~SlabPool() {
+		Release();
+	}
+
+	size_t BlockSize() const		{ return m_blockSize; }
+	size_t SlabCount() const		{ return m_slabs.size(); }
+	size_t BytesReserved() const	{ return m_bytesReserved; }
+
+	// returns a recycled block if there is one, otherwise the next block of the current slab
+	void* Allocate() {
+		if (m_freeList != nullptr) {
+			FreeBlock* block = m_freeList;
+			m_freeList = block->next;
+			--m_freeCount;
+			return block;
+		}
+		if (m_cursor == m_slabEnd)
+			AddSlab(m_nextSlabBlocks);
+		void* block = m_cursor;
+		m_cursor += m_blockSize;
+		return block;
+	}
+
+	// pushes the block onto the free list, the slab itself is only freed by Release
+	void Deallocate(void* p) {
+		FreeBlock* block = static_cast<FreeBlock*>(p);
+		block->next = m_freeList;
+		m_freeList = block;
+		++m_freeCount;
+	}
+
+	// makes sure the next count allocations need at most the one slab allocated here, so a batch of nodes costs a single trip to operator new
+	void Reserve(size_t count) {
+		const size_t available = m_freeCount + static_cast<size_t>(m_slabEnd - m_cursor) / m_blockSize;
+		if (available >= count)
+			return;
+		// hand the rest of the current slab to the free list so switching slabs wastes nothing
+		while (m_cursor != m_slabEnd) {
+			Deallocate(m_cursor);
+			m_cursor += m_blockSize;
+		}
+		AddSlab(std::max(count - available, m_nextSlabBlocks));
+	}
+
+	// frees every slab in one go, any block still handed out becomes invalid
+	void Release() {
+		for (std::byte* slab : m_slabs)
+			::operator delete(slab, std::align_val_t(m_blockAlign));
+		m_slabs.clear();
+		m_bytesReserved = 0;
+		m_freeList = nullptr;
+		m_freeCount = 0;
+		m_cursor = nullptr;
+		m_slabEnd = nullptr;
+	}
+
+private:
+	struct FreeBlock {
+		FreeBlock* next;
+	};
+
+	void AddSlab(size_t blocks) {
+		const size_t bytes = blocks * m_blockSize;
+		std::byte* slab = static_cast<std::byte*>(::operator new(bytes, std::align_val_t(m_blockAlign)));
+		m_slabs.push_back(slab);
+		m_bytesReserved += bytes;
+		m_cursor = slab;
+		m_slabEnd = slab + bytes;
+		// grow geometrically so long lists end up in a handful of large slabs
+		m_nextSlabBlocks = std::min(m_nextSlabBlocks * 2, m_maxSlabBlocks);
+	}
+
+	size_t m_blockSize;
+	size_t m_blockAlign;
+	size_t m_nextSlabBlocks;
+	size_t m_maxSlabBlocks;
+	size_t m_bytesReserved;
+	FreeBlock* m_freeList;
+	size_t m_freeCount;
+	std::byte* m_cursor;
+	std::byte* m_slabEnd;
+	std::vector<std::byte*> m_slabs;
+};
+
+
+/* the SlabPools behind a PoolAllocator and every copy and rebind of it, one pool per block size and alignment so lists
+   that rebind to their node type still share pools with the allocator they were built from */
+class SlabPoolGroup {
+public:
+	SlabPoolGroup() {}
+
+	SlabPoolGroup(const SlabPoolGroup&) = delete;
+	SlabPoolGroup& operator=(const SlabPoolGroup&) = delete;
+
+	// the pool for blocks of blockSize bytes, created on first use; a group only holds a few block sizes, so a scan is enough
+	SlabPool* PoolFor(size_t blockSize, size_t blockAlign) {
+		for (const Entry& entry : m_pools) {
+			if (entry.blockSize == blockSize && entry.blockAlign == blockAlign)
+				return entry.pool.get();
+		}
+		m_pools.push_back({ blockSize, blockAlign, std::make_unique<SlabPool>(blockSize, blockAlign) });
+		return m_pools.back().pool.get();
+	}
+
+private:
+	struct Entry {
+		size_t blockSize;
+		size_t blockAlign;
+		std::unique_ptr<SlabPool> pool;
+	};
+
+	std::vector<Entry> m_pools;
+};
+
+
+/* std compatible allocator that serves single objects from a SlabPool, copies and rebinds share a SlabPoolGroup and compare
+   equal, so containers built from one allocator can hand nodes to each other; the pools aren't thread safe, which is why
+   copying a container gives the copy a group of its own */
+template<class T>
+class PoolAllocator {
+public:
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::false_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+
+	template<class U>
+	struct rebind {
+		using other = PoolAllocator<U>;
+	};
+
+	PoolAllocator() : PoolAllocator(std::make_shared<SlabPoolGroup>()) {}
+
+	PoolAllocator(const PoolAllocator& other) noexcept = default;
+
+	template<class U>
+	PoolAllocator(const PoolAllocator<U>& other) : PoolAllocator(other.Group()) {}
+
+	~PoolAllocator() {}
+
+	PoolAllocator& operator=(const PoolAllocator& other) noexcept = default;
+
+	// a copied container may end up on another thread, so it must not share pools with the original
+	PoolAllocator select_on_container_copy_construction() const {
+		return PoolAllocator();
+	}
+
+	const std::shared_ptr<SlabPoolGroup>& Group() const { return m_group; }
+	SlabPool* Pool() const { return m_pool; }
+
+	T* allocate(size_t n) {
+		if (n == 1)
+			return static_cast<T*>(m_pool->Allocate());
+		// arrays are not pooled
+		return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+	}
+
+	void deallocate(T* p, size_t n) noexcept {
+		if (n == 1)
+			m_pool->Deallocate(p);
+		else
+			::operator delete(p, std::align_val_t(alignof(T)));
+	}
+
+	template<class U>
+	bool operator==(const PoolAllocator<U>& other) const noexcept {
+		return m_group == other.Group();
+	}
+
+private:
+	explicit PoolAllocator(std::shared_ptr<SlabPoolGroup> group) : m_group(std::move(group)), m_pool(m_group->PoolFor(sizeof(T), alignof(T))) {}
+
+	std::shared_ptr<SlabPoolGroup> m_group;
+	SlabPool* m_pool;
+};
+
+
+// readies alloc for count single object allocations in one go, a no-op for allocators that aren't backed by a SlabPool
+template<class Alloc>
+void ReserveNodes(Alloc& alloc, size_t count) {
+	if constexpr (requires { alloc.Pool()->Reserve(count); })
+		alloc.Pool()->Reserve(count);
+}
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_POOL_ALLOCATOR_H
\ No newline at end of file
@@ -0,0 +1,152 @@
+#ifndef DATA_STRUCTURES_RADIX_HEAP_H
+#define DATA_STRUCTURES_RADIX_HEAP_H
+
+#include "pch.h"
+
+namespace ads {
+
+/* monotone min priority queue for unsigned integer keys, a key may never be smaller than the last one popped, which holds
+   for Dijkstra with non negative weights, entries sit in buckets by the highest bit they differ from that last key in,
+   so each entry is moved between buckets at most once per bit and no comparisons form a heap; buckets are chains of fixed
+   size chunks from one shared arena, and chunks a bucket drains go back to it for any bucket to reuse, so the heap only
+   allocates when it holds more entries at once than it ever has, not whenever one bucket outgrows what it held before */
+template<class Key, class Value>
+class RadixHeap {
+	static_assert(std::is_unsigned_v<Key>, "radix heap keys are unsigned integers");
+
+public:
+	static constexpr size_t bucketCount = sizeof(Key) * 8 + 1;
+	static constexpr uint32_t chunkEntries = 64;
+
+	RadixHeap() : m_free(noChunk), m_last(0), m_size(0) {
+		std::fill(std::begin(m_buckets), std::end(m_buckets), noChunk);
+	}
+
+	size_t Size() const		{ return m_size; }
+	bool IsEmpty() const	{ return m_size == 0; }
+
+	// the key of the last popped entry, nothing smaller can be pushed
+	Key LastKey() const { return m_last; }
+
+	// sizes the arena so count entries fit however they spread over the buckets
+	void Reserve(size_t count) {
+		m_chunks.reserve(count / chunkEntries + bucketCount);
+	}
+
+	// key must not be less than LastKey
+	void Push(Key key, const Value& val) {
+		Append(BucketOf(key), { key, val });
+		++m_size;
+	}
+
+	// the smallest key, refilling bucket 0 first if it ran dry
+	Key MinKey() {
+		Refill();
+		const Chunk& chunk = m_chunks[m_buckets[0]];
+		return chunk.entries[chunk.count - 1].first;
+	}
+
+	// removes and returns an entry with the smallest key
+	std::pair<Key, Value> Pop() {
+		Refill();
+		const uint32_t index = m_buckets[0];
+		Chunk& chunk = m_chunks[index];
+		std::pair<Key, Value> top = std::move(chunk.entries[--chunk.count]);
+		if (chunk.count == 0) {
+			m_buckets[0] = chunk.next;
+			FreeChunk(index);
+		}
+		--m_size;
+		return top;
+	}
+
+	// keeps the arena for reuse
+	void Clear() {
+		std::fill(std::begin(m_buckets), std::end(m_buckets), noChunk);
+		m_chunks.clear();
+		m_free = noChunk;
+		m_last = 0;
+		m_size = 0;
+	}
+
+private:
+	static constexpr uint32_t noChunk = UINT32_MAX;
+
+	struct Chunk {
+		std::array<std::pair<Key, Value>, chunkEntries> entries;
+		uint32_t count = 0;
+		uint32_t next = noChunk;
+	};
+
+	size_t BucketOf(Key key) const {
+		return static_cast<size_t>(std::bit_width(static_cast<Key>(key ^ m_last)));
+	}
+
+	// the first chunk of a bucket is the one being filled, a full one gets a fresh chunk linked in ahead of it
+	void Append(size_t bucket, std::pair<Key, Value>&& entry) {
+		uint32_t index = m_buckets[bucket];
+		if (index == noChunk || m_chunks[index].count == chunkEntries) {
+			const uint32_t chunk = NewChunk();
+			m_chunks[chunk].next = index;
+			m_buckets[bucket] = chunk;
+			index = chunk;
+		}
+		Chunk& chunk = m_chunks[index];
+		chunk.entries[chunk.count++] = std::move(entry);
+	}
+
+	uint32_t NewChunk() {
+		if (m_free != noChunk) {
+			const uint32_t index = m_free;
+			m_free = m_chunks[index].next;
+			m_chunks[index].count = 0;
+			return index;
+		}
+		if (m_chunks.size() == noChunk)
+			throw std::length_error("RadixHeap can't hold more than 2^32 - 1 chunks");
+		m_chunks.emplace_back();
+		return static_cast<uint32_t>(m_chunks.size() - 1);
+	}
+
+	void FreeChunk(uint32_t index) {
+		m_chunks[index].next = m_free;
+		m_free = index;
+	}
+
+	// the smallest key of the first non empty bucket becomes the new last key, every entry of that bucket then lands in a lower one
+	void Refill() {
+		if (m_buckets[0] != noChunk)
+			return;
+		size_t i = 1;
+		while (m_buckets[i] == noChunk)
+			++i;
+		uint32_t index = m_buckets[i];
+		m_buckets[i] = noChunk;
+		Key last = std::numeric_limits<Key>::max();
+		for (uint32_t iter = index; iter != noChunk; iter = m_chunks[iter].next) {
+			for (uint32_t k = 0; k < m_chunks[iter].count; ++k)
+				last = std::min(last, m_chunks[iter].entries[k].first);
+		}
+		m_last = last;
+		// by index since handing out chunks may grow the arena, a drained chunk is only freed once all its entries moved
+		while (index != noChunk) {
+			for (uint32_t k = 0; k < m_chunks[index].count; ++k) {
+				std::pair<Key, Value> entry = std::move(m_chunks[index].entries[k]);
+				Append(BucketOf(entry.first), std::move(entry));
+			}
+			const uint32_t next = m_chunks[index].next;
+			FreeChunk(index);
+			index = next;
+		}
+	}
+
+	std::vector<Chunk> m_chunks;		// the arena, holds every bucket's chunks and the free chain of drained ones
+	uint32_t m_buckets[bucketCount];	// first chunk of each bucket, bucket i holds keys whose highest bit differing from m_last is bit i - 1
+	uint32_t m_free;
+	Key m_last;
+	size_t m_size;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_RADIX_HEAP_H
\ No newline at end of file
@@ -0,0 +1,310 @@
+#ifndef DATA_STRUCTURES_RING_BUFFER_H
+#define DATA_STRUCTURES_RING_BUFFER_H
+
+#include "pch.h"
+#include "data_structures/container_stats.h"
+
+namespace ads {
+
+/* growable double ended queue in one power of two sized array, indices wrap with a mask and capacity only ever grows,
+   so once it has reached its peak size pushing and popping never allocate */
+template<class T, class Alloc = std::allocator<T>, class StatsPolicy = NoStats>
+class RingBuffer {
+public:
+	using AllocTraits = std::allocator_traits<Alloc>;
+
+	static constexpr size_t minCapacity = 8;
+
+	/* iterator over logical positions, front to back */
+	template<bool IsConst>
+	class RingIterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = std::conditional_t<IsConst, const T*, T*>;
+		using reference = std::conditional_t<IsConst, const T&, T&>;
+		using BufferPointer = std::conditional_t<IsConst, const RingBuffer*, RingBuffer*>;
+
+		RingIterator() : m_pBuffer(nullptr), m_index(0) {}
+
+		RingIterator(BufferPointer pBuffer, size_t index) : m_pBuffer(pBuffer), m_index(index) {}
+
+		// iterator -> const_iterator
+		template<bool OtherConst> requires (IsConst && !OtherConst)
+		RingIterator(const RingIterator<OtherConst>& other) : m_pBuffer(other.GetBuffer()), m_index(other.GetIndex()) {}
+
+		BufferPointer GetBuffer() const	{ return m_pBuffer; }
+		size_t GetIndex() const			{ return m_index; }
+
+		reference operator*() const	{ return (*m_pBuffer)[m_index]; }
+		pointer operator->() const	{ return &(*m_pBuffer)[m_index]; }
+
+		RingIterator& operator++()		{ ++m_index; return *this; }
+		RingIterator& operator--()		{ --m_index; return *this; }
+		RingIterator operator++(int)	{ RingIterator temp = *this; ++m_index; return temp; }
+		RingIterator operator--(int)	{ RingIterator temp = *this; --m_index; return temp; }
+
+		template<bool OtherConst>
+		bool operator==(const RingIterator<OtherConst>& other) const { return m_index == other.GetIndex(); }
+
+	private:
+		BufferPointer m_pBuffer;
+		size_t m_index;
+	};
+
+	using iterator = RingIterator<false>;
+	using const_iterator = RingIterator<true>;
+
+
+	RingBuffer() : m_data(nullptr), m_capacity(0), m_head(0), m_size(0) {}
+
+	explicit RingBuffer(const Alloc& alloc) : m_data(nullptr), m_capacity(0), m_head(0), m_size(0), m_alloc(alloc) {}
+
+	RingBuffer(const RingBuffer& other)
+		: m_data(nullptr), m_capacity(0), m_head(0), m_size(0), m_alloc(AllocTraits::select_on_container_copy_construction(other.m_alloc)) {
+		Reserve(other.m_size);
+		for (const T& val : other)
+			EmplaceBack(val);
+	}
+
+	RingBuffer(RingBuffer&& other) noexcept
+		: m_data(other.m_data), m_capacity(other.m_capacity), m_head(other.m_head), m_size(other.m_size), m_alloc(std::move(other.m_alloc)) {
+		m_stats.SwapLive(other.m_stats);
+		other.m_data = nullptr;
+		other.m_capacity = 0;
+		other.m_head = 0;
+		other.m_size = 0;
+	}
+
+	~RingBuffer() {
+		Clear();
+		FreeArray();
+	}
+
+	RingBuffer& operator=(const RingBuffer& other) {
+		if (this != &other) {
+			Clear();
+			Reserve(other.m_size);
+			for (const T& val : other)
+				EmplaceBack(val);
+		}
+		return *this;
+	}
+
+	RingBuffer& operator=(RingBuffer&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value) {
+		if (this == &other)
+			return *this;
+
+		Clear();
+		if constexpr (!AllocTraits::propagate_on_container_move_assignment::value && !AllocTraits::is_always_equal::value) {
+			if (!(m_alloc == other.m_alloc)) {
+				// other's array can't be freed through m_alloc, so move the values instead
+				Reserve(other.m_size);
+				for (T& val : other)
+					EmplaceBack(std::move(val));
+				other.Clear();
+				return *this;
+			}
+		}
+		FreeArray();
+		m_stats.SwapLive(other.m_stats);
+		if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+			m_alloc = std::move(other.m_alloc);
+		m_data = std::exchange(other.m_data, nullptr);
+		m_capacity = std::exchange(other.m_capacity, 0);
+		m_head = std::exchange(other.m_head, 0);
+		m_size = std::exchange(other.m_size, 0);
+		return *this;
+	}
+
+	size_t Size() const		{ return m_size; }
+	size_t Capacity() const	{ return m_capacity; }
+	bool IsEmpty() const	{ return m_size == 0; }
+
+	// always zero unless StatsPolicy counts, one allocation per growth
+	ContainerStats Stats() const	{ return m_stats.Get(); }
+	void ResetStats()				{ m_stats.Reset(); }
+
+	// index 0 is the front
+	T& operator[](size_t index)				{ return m_data[(m_head + index) & (m_capacity - 1)]; }
+	const T& operator[](size_t index) const	{ return m_data[(m_head + index) & (m_capacity - 1)]; }
+
+	T& Front()				{ return m_data[m_head]; }
+	const T& Front() const	{ return m_data[m_head]; }
+	T& Back()				{ return (*this)[m_size - 1]; }
+	const T& Back() const	{ return (*this)[m_size - 1]; }
+
+	iterator begin()				{ return iterator(this, 0); }
+	iterator end()					{ return iterator(this, m_size); }
+	const_iterator begin() const	{ return const_iterator(this, 0); }
+	const_iterator end() const		{ return const_iterator(this, m_size); }
+	const_iterator cbegin() const	{ return begin(); }
+	const_iterator cend() const		{ return end(); }
+
+	void PushBack(const T& val)		{ EmplaceBack(val); }
+	void PushBack(T&& val)			{ EmplaceBack(std::move(val)); }
+	void PushFront(const T& val)	{ EmplaceFront(val); }
+	void PushFront(T&& val)			{ EmplaceFront(std::move(val)); }
+
+	template<class... Args>
+	T& EmplaceBack(Args&&... args) {
+		T* slot;
+		if (m_size == m_capacity) {
+			Grow(m_size + 1, [&](T* data, size_t) { AllocTraits::construct(m_alloc, data + m_size, std::forward<Args>(args)...); });
+			slot = m_data + m_size;
+		} else {
+			slot = m_data + ((m_head + m_size) & (m_capacity - 1));
+			AllocTraits::construct(m_alloc, slot, std::forward<Args>(args)...);
+		}
+		++m_size;
+		return *slot;
+	}
+
+	template<class... Args>
+	T& EmplaceFront(Args&&... args) {
+		size_t head;
+		if (m_size == m_capacity) {
+			Grow(m_size + 1, [&](T* data, size_t capacity) { AllocTraits::construct(m_alloc, data + capacity - 1, std::forward<Args>(args)...); });
+			head = m_capacity - 1;
+		} else {
+			head = (m_head - 1) & (m_capacity - 1);
+			AllocTraits::construct(m_alloc, m_data + head, std::forward<Args>(args)...);
+		}
+		m_head = head;
+		++m_size;
+		return m_data[head];
+	}
+
+	// copies values to the back, growing at most once and copying in at most two contiguous runs
+	void PushBack(std::span<const T> values) {
+		if (m_size + values.size() > m_capacity) {
+			// values may be a view of this buffer, so they're copied before the old array goes
+			Grow(m_size + values.size(), [&](T* data, size_t) { CopyIn(values.data(), values.size(), data + m_size); });
+			m_size += values.size();
+			return;
+		}
+		const size_t tail = (m_head + m_size) & (m_capacity - 1);
+		const size_t first = std::min(values.size(), m_capacity - tail);
+		CopyIn(values.data(), first, m_data + tail);
+		CopyIn(values.data() + first, values.size() - first, m_data);
+		m_size += values.size();
+	}
+
+	void PopFront() {
+		AllocTraits::destroy(m_alloc, m_data + m_head);
+		m_head = (m_head + 1) & (m_capacity - 1);
+		--m_size;
+	}
+
+	void PopBack() {
+		AllocTraits::destroy(m_alloc, &Back());
+		--m_size;
+	}
+
+	// moves up to count values from the front into out, in at most two contiguous runs, and returns how many were moved
+	size_t PopFront(size_t count, T* out) {
+		count = std::min(count, m_size);
+		const size_t first = std::min(count, m_capacity - m_head);
+		MoveOut(m_data + m_head, first, out);
+		MoveOut(m_data, count - first, out + first);
+		m_head = (m_head + count) & (m_capacity - 1);
+		m_size -= count;
+		return count;
+	}
+
+	// destroys every value, the array is kept for reuse
+	void Clear() {
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			for (size_t i = 0; i < m_size; ++i)
+				AllocTraits::destroy(m_alloc, &(*this)[i]);
+		}
+		m_head = 0;
+		m_size = 0;
+	}
+
+	void Reserve(size_t count) {
+		if (count > m_capacity)
+			Grow(count);
+	}
+
+private:
+	void CopyIn(const T* src, size_t count, T* dest) {
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			if (count > 0)
+				std::memcpy(dest, src, count * sizeof(T));
+		} else {
+			for (size_t i = 0; i < count; ++i)
+				AllocTraits::construct(m_alloc, dest + i, src[i]);
+		}
+	}
+
+	void MoveOut(T* src, size_t count, T* dest) {
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			if (count > 0)
+				std::memcpy(dest, src, count * sizeof(T));
+		} else {
+			for (size_t i = 0; i < count; ++i) {
+				dest[i] = std::move(src[i]);
+				AllocTraits::destroy(m_alloc, src + i);
+			}
+		}
+	}
+
+	// at least doubles, and unwraps the contents to the start of the new array
+	void Grow(size_t count) {
+		Grow(count, [](T*, size_t) {});
+	}
+
+	// construct builds the values being added in the new array before the old values move over and the old array is freed,
+	// as std::vector does, since its arguments may refer to values in the old array
+	template<class Construct>
+	void Grow(size_t count, Construct&& construct) {
+		const size_t capacity = std::max({ std::bit_ceil(count), m_capacity * 2, minCapacity });
+		T* data = AllocTraits::allocate(m_alloc, capacity);
+		try {
+			construct(data, capacity);
+		} catch (...) {
+			AllocTraits::deallocate(m_alloc, data, capacity);
+			throw;
+		}
+		m_stats.OnAllocate(capacity * sizeof(T));
+		const size_t first = std::min(m_size, m_capacity - m_head);
+		Relocate(m_data + m_head, first, data);
+		Relocate(m_data, m_size - first, data + first);
+		FreeArray();
+		m_data = data;
+		m_capacity = capacity;
+		m_head = 0;
+	}
+
+	void FreeArray() {
+		if (m_data != nullptr) {
+			AllocTraits::deallocate(m_alloc, m_data, m_capacity);
+			m_stats.OnFree(m_capacity * sizeof(T));
+		}
+	}
+
+	void Relocate(T* src, size_t count, T* dest) {
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			if (count > 0)
+				std::memcpy(dest, src, count * sizeof(T));
+		} else {
+			for (size_t i = 0; i < count; ++i) {
+				AllocTraits::construct(m_alloc, dest + i, std::move_if_noexcept(src[i]));
+				AllocTraits::destroy(m_alloc, src + i);
+			}
+		}
+	}
+
+	T* m_data;
+	size_t m_capacity;	// 0 or a power of two
+	size_t m_head;		// physical index of the front
+	size_t m_size;
+	ADS_NO_UNIQUE_ADDRESS Alloc m_alloc;
+	ADS_NO_UNIQUE_ADDRESS StatsPolicy m_stats;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_RING_BUFFER_H
\ No newline at end of file
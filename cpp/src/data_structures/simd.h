@@ -0,0 +1,22 @@
+#ifndef DATA_STRUCTURES_SIMD_H
+#define DATA_STRUCTURES_SIMD_H
+
+#include "pch.h"
+
+// instruction sets the build allows, sse2 is baseline on x64 and msvc only defines __AVX__/__AVX2__ under the matching /arch
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define ADS_SSE2 1
+	#include <emmintrin.h>
+#endif
+
+#if defined(__SSE4_2__) || defined(__AVX__)
+	#define ADS_SSE42 1
+	#include <nmmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+	#define ADS_AVX2 1
+	#include <immintrin.h>
+#endif
+
+#endif // DATA_STRUCTURES_SIMD_H
\ No newline at end of file
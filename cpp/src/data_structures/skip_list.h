@@ -0,0 +1,405 @@
+#ifndef DATA_STRUCTURES_SKIP_LIST_H
+#define DATA_STRUCTURES_SKIP_LIST_H
+
+#include "pch.h"
+#include "data_structures/container_stats.h"
+
+namespace ads {
+
+/* ordered map on a tower of singly linked lists, level 0 holds every node in key order and each level above skips ahead
+   over about three quarters of the one below. with Concurrent set, TryEmplace, Get, Contains, Erase and ForEachInRange
+   may run from any number of threads at once: nodes are published with a CAS on level 0 and erasing only marks them
+   deleted, so nothing a reader can reach is freed until Compact, Clear or the destructor, which must not race anything.
+   without Concurrent the links are plain pointers and Erase unlinks and frees the node straight away */
+template<class K, class V, class Compare = std::less<K>, bool Concurrent = false, class StatsPolicy = NoStats>
+class SkipList {
+	static_assert(!Concurrent || !StatsPolicy::enabled, "stats policies count with plain integers, so they only work single threaded");
+
+public:
+	static constexpr uint32_t maxHeight = 20;	// 4^20 keys before the top level stops thinning out
+
+	struct Node;
+	using Link = std::conditional_t<Concurrent, std::atomic<Node*>, Node*>;
+	using Flag = std::conditional_t<Concurrent, std::atomic<bool>, bool>;
+
+	/* the key and value are followed in the same allocation by height links, one per level the node is on */
+	struct Node {
+		template<class... Args>
+		Node(uint32_t h, const K& k, Args&&... args) : key(k), value(std::forward<Args>(args)...), deleted(false), height(h) {}
+
+		Link* Links()				{ return std::launder(reinterpret_cast<Link*>(reinterpret_cast<std::byte*>(this) + linksOffset)); }
+		const Link* Links() const	{ return std::launder(reinterpret_cast<const Link*>(reinterpret_cast<const std::byte*>(this) + linksOffset)); }
+
+		K key;
+		V value;
+		Flag deleted;	// only ever set in concurrent mode, never cleared, a later insert of the key goes in front of it
+		uint32_t height;
+	};
+
+	static constexpr size_t linksOffset = (sizeof(Node) + alignof(Link) - 1) / alignof(Link) * alignof(Link);
+	static constexpr size_t nodeAlignment = std::max(alignof(Node), alignof(Link));
+
+	/* forward iterator over the live nodes of level 0 */
+	template<bool IsConst>
+	class NodeIterator {
+	public:
+		using NodePointer = std::conditional_t<IsConst, const Node*, Node*>;
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = std::pair<K, V>;
+		using difference_type = std::ptrdiff_t;
+		using reference = std::pair<const K&, std::conditional_t<IsConst, const V&, V&>>;
+
+		NodeIterator() : m_node(nullptr) {}
+
+		explicit NodeIterator(NodePointer node) : m_node(SkipDeleted(node)) {}
+
+		// iterator -> const_iterator
+		template<bool OtherConst> requires (IsConst && !OtherConst)
+		NodeIterator(const NodeIterator<OtherConst>& other) : m_node(other.GetNode()) {}
+
+		NodePointer GetNode() const { return m_node; }
+
+		const K& Key() const	{ return m_node->key; }
+		auto& Value() const		{ return m_node->value; }
+
+		reference operator*() const { return reference(m_node->key, m_node->value); }
+
+		NodeIterator& operator++() {
+			m_node = SkipDeleted(Load(m_node->Links()[0]));
+			return *this;
+		}
+
+		NodeIterator operator++(int) {
+			NodeIterator temp = *this;
+			++*this;
+			return temp;
+		}
+
+		template<bool OtherConst>
+		bool operator==(const NodeIterator<OtherConst>& other) const { return m_node == other.GetNode(); }
+
+	private:
+		NodePointer m_node;
+	};
+
+	// in concurrent mode iterating is safe next to inserts and erases but only sees a loose snapshot
+	using iterator = NodeIterator<false>;
+	using const_iterator = NodeIterator<true>;
+
+
+	explicit SkipList(const Compare& compare = Compare()) : m_compare(compare), m_height(1), m_size(0) {
+		for (Link& link : m_head)
+			Store(link, nullptr);
+	}
+
+	SkipList(const SkipList&) = delete;
+	SkipList& operator=(const SkipList&) = delete;
+
+	// must not race any other operation
+	~SkipList() {
+		DestroyAll();
+	}
+
+	// in concurrent mode only a snapshot when other threads are inserting or erasing
+	size_t Size() const {
+		if constexpr (Concurrent)
+			return m_size.load(std::memory_order_relaxed);
+		else
+			return m_size;
+	}
+
+	bool IsEmpty() const { return Size() == 0; }
+
+	// always zero unless StatsPolicy counts, visits are the nodes a search compares against
+	ContainerStats Stats() const	{ return m_stats.Get(); }
+	void ResetStats()				{ m_stats.Reset(); }
+
+	iterator begin()				{ return iterator(Load(m_head[0])); }
+	iterator end()					{ return iterator(); }
+	const_iterator begin() const	{ return const_iterator(Load(m_head[0])); }
+	const_iterator end() const		{ return const_iterator(); }
+	const_iterator cbegin() const	{ return begin(); }
+	const_iterator cend() const		{ return end(); }
+
+	// must not race any other operation
+	void Clear() {
+		DestroyAll();
+		for (Link& link : m_head)
+			Store(link, nullptr);
+		StoreHeight(1);
+		if constexpr (Concurrent)
+			m_size.store(0, std::memory_order_relaxed);
+		else
+			m_size = 0;
+	}
+
+	// the mapped value for key, or nullptr, in concurrent mode values are immutable once inserted
+	const V* Get(const K& key) const {
+		Node* node = LiveNode(key);
+		return node != nullptr ? &node->value : nullptr;
+	}
+
+	V* Get(const K& key) requires (!Concurrent) {
+		Node* node = LiveNode(key);
+		return node != nullptr ? &node->value : nullptr;
+	}
+
+	bool Contains(const K& key) const { return LiveNode(key) != nullptr; }
+
+	// first live entry whose key is not less than key
+	iterator LowerBound(const K& key)				{ return iterator(FirstNotLess(key)); }
+	const_iterator LowerBound(const K& key) const	{ return const_iterator(FirstNotLess(key)); }
+
+	// calls fn(key, value) for every live key in [first, last) in order, returns how many were visited
+	template<class Fn>
+	size_t ForEachInRange(const K& first, const K& last, Fn&& fn) const {
+		size_t visited = 0;
+		for (Node* node = FirstNotLess(first); node != nullptr && m_compare(node->key, last); node = Load(node->Links()[0])) {
+			if (!IsDeleted(node)) {
+				fn(node->key, static_cast<const V&>(node->value));
+				++visited;
+			}
+		}
+		return visited;
+	}
+
+	// constructs the value from args only if key isn't present, returns true when it was inserted
+	template<class... Args>
+	bool TryEmplace(const K& key, Args&&... args) {
+		Link* preds[maxHeight];
+		Node* succs[maxHeight];
+		const uint32_t height = RandomHeight();
+		Node* node = nullptr;
+		while (true) {
+			FindPosition(key, height, preds, succs);
+			if (succs[0] != nullptr && !m_compare(key, succs[0]->key) && !IsDeleted(succs[0])) {
+				if (node != nullptr)
+					DestroyNode(node);
+				return false;
+			}
+			if (node == nullptr)
+				node = CreateNode(height, key, std::forward<Args>(args)...);
+
+			if constexpr (Concurrent) {
+				// level 0 decides whether the insert happened, a failed CAS means a neighbour changed under us
+				Store(node->Links()[0], succs[0]);
+				if (preds[0][0].compare_exchange_strong(succs[0], node, std::memory_order_release, std::memory_order_relaxed))
+					break;
+			} else {
+				for (uint32_t level = 0; level < height; ++level) {
+					Store(node->Links()[level], succs[level]);
+					Store(preds[level][level], node);
+				}
+				++m_size;
+				return true;
+			}
+		}
+
+		if constexpr (Concurrent) {
+			m_size.fetch_add(1, std::memory_order_relaxed);
+			// the upper levels are only shortcuts, linking them late just makes the node a little slower to find
+			for (uint32_t level = 1; level < height; ++level) {
+				while (true) {
+					Store(node->Links()[level], succs[level]);
+					if (preds[level][level].compare_exchange_strong(succs[level], node, std::memory_order_release, std::memory_order_relaxed))
+						break;
+					FindPosition(key, height, preds, succs);
+				}
+			}
+		}
+		return true;
+	}
+
+	bool Insert(const K& key, const V& val)	{ return TryEmplace(key, val); }
+	bool Insert(const K& key, V&& val)		{ return TryEmplace(key, std::move(val)); }
+
+	// removes key, returns how many values were removed
+	size_t Erase(const K& key) {
+		if constexpr (Concurrent) {
+			// the first node with the key is the only one that can be live
+			Node* node = FirstNotLess(key);
+			bool expected = false;
+			if (node == nullptr || m_compare(key, node->key) || !node->deleted.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+				return 0;
+			m_size.fetch_sub(1, std::memory_order_relaxed);
+			return 1;
+		} else {
+			Link* preds[maxHeight];
+			Node* succs[maxHeight];
+			FindPosition(key, 1, preds, succs);
+			Node* node = succs[0];
+			if (node == nullptr || m_compare(key, node->key))
+				return 0;
+			for (uint32_t level = 0; level < node->height; ++level)
+				Store(preds[level][level], Load(node->Links()[level]));
+			DestroyNode(node);
+			--m_size;
+			return 1;
+		}
+	}
+
+	// unlinks and frees the nodes Erase only marked in concurrent mode, must not race any other operation
+	size_t Compact() {
+		size_t freed = 0;
+		if constexpr (Concurrent) {
+			// top down so a node is off every level above by the time level 0 frees it
+			for (uint32_t level = LoadHeight(); level-- > 0;) {
+				Link* links = m_head;
+				for (Node* next = Load(links[level]); next != nullptr; next = Load(links[level])) {
+					if (IsDeleted(next)) {
+						Store(links[level], Load(next->Links()[level]));
+						if (level == 0) {
+							DestroyNode(next);
+							++freed;
+						}
+					} else {
+						links = next->Links();
+					}
+				}
+			}
+		}
+		return freed;
+	}
+
+private:
+	static Node* Load(const Link& link) {
+		if constexpr (Concurrent)
+			return link.load(std::memory_order_acquire);
+		else
+			return link;
+	}
+
+	// only for links nobody else can see yet or when no other thread is running
+	static void Store(Link& link, Node* node) {
+		if constexpr (Concurrent)
+			link.store(node, std::memory_order_relaxed);
+		else
+			link = node;
+	}
+
+	static bool IsDeleted(const Node* node) {
+		if constexpr (Concurrent)
+			return node->deleted.load(std::memory_order_acquire);
+		else
+			return false;
+	}
+
+	template<class NodePointer>
+	static NodePointer SkipDeleted(NodePointer node) {
+		while (node != nullptr && IsDeleted(node))
+			node = Load(node->Links()[0]);
+		return node;
+	}
+
+	uint32_t LoadHeight() const {
+		if constexpr (Concurrent)
+			return m_height.load(std::memory_order_relaxed);
+		else
+			return m_height;
+	}
+
+	void StoreHeight(uint32_t height) {
+		if constexpr (Concurrent)
+			m_height.store(height, std::memory_order_relaxed);
+		else
+			m_height = height;
+	}
+
+	// geometric with p = 1/4 from a per thread xorshift, so concurrent inserts never share generator state
+	uint32_t RandomHeight() {
+		thread_local uint64_t state = 0x9E3779B97F4A7C15ull ^ reinterpret_cast<uintptr_t>(&state);
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		const uint32_t height = std::min<uint32_t>(maxHeight, 1 + static_cast<uint32_t>(std::countr_zero(state | (1ull << 63))) / 2);
+
+		// raise the search start, lookups that read the old height still find everything through the lower levels
+		if constexpr (Concurrent) {
+			uint32_t current = m_height.load(std::memory_order_relaxed);
+			while (current < height && !m_height.compare_exchange_weak(current, height, std::memory_order_relaxed)) {}
+		} else if (m_height < height) {
+			m_height = height;
+		}
+		return height;
+	}
+
+	// for every level below max(height, current height) the links that point at the first node not less than key and that node
+	void FindPosition(const K& key, uint32_t height, Link** preds, Node** succs) const {
+		Link* links = const_cast<Link*>(m_head);
+		for (uint32_t level = std::max(height, LoadHeight()); level-- > 0;) {
+			Node* next = Load(links[level]);
+			while (next != nullptr && m_compare(next->key, key)) {
+				m_stats.OnVisit();
+				links = next->Links();
+				next = Load(links[level]);
+			}
+			preds[level] = links;
+			succs[level] = next;
+		}
+	}
+
+	Node* FirstNotLess(const K& key) const {
+		const Link* links = m_head;
+		Node* next = nullptr;
+		for (uint32_t level = LoadHeight(); level-- > 0;) {
+			next = Load(links[level]);
+			while (next != nullptr && m_compare(next->key, key)) {
+				m_stats.OnVisit();
+				links = next->Links();
+				next = Load(links[level]);
+			}
+		}
+		return next;
+	}
+
+	Node* LiveNode(const K& key) const {
+		Node* node = FirstNotLess(key);
+		return node != nullptr && !m_compare(key, node->key) && !IsDeleted(node) ? node : nullptr;
+	}
+
+	template<class... Args>
+	Node* CreateNode(uint32_t height, const K& key, Args&&... args) {
+		void* memory = ::operator new(linksOffset + height * sizeof(Link), std::align_val_t(nodeAlignment));
+		Node* node;
+		try {
+			node = ::new (memory) Node(height, key, std::forward<Args>(args)...);
+		} catch (...) {
+			::operator delete(memory, std::align_val_t(nodeAlignment));
+			throw;
+		}
+		m_stats.OnAllocate(linksOffset + height * sizeof(Link));
+		for (uint32_t level = 0; level < height; ++level)
+			::new (static_cast<void*>(node->Links() + level)) Link(nullptr);
+		return node;
+	}
+
+	void DestroyNode(Node* node) {
+		m_stats.OnFree(linksOffset + node->height * sizeof(Link));
+		std::destroy_n(node->Links(), node->height);
+		std::destroy_at(node);
+		::operator delete(static_cast<void*>(node), std::align_val_t(nodeAlignment));
+	}
+
+	void DestroyAll() {
+		Node* node = Load(m_head[0]);
+		while (node != nullptr) {
+			Node* next = Load(node->Links()[0]);
+			DestroyNode(node);
+			node = next;
+		}
+	}
+
+	Link m_head[maxHeight];
+	Compare m_compare;
+	std::conditional_t<Concurrent, std::atomic<uint32_t>, uint32_t> m_height;	// levels in use, searches start below it
+	std::conditional_t<Concurrent, std::atomic<size_t>, size_t> m_size;
+	ADS_NO_UNIQUE_ADDRESS StatsPolicy m_stats;
+};
+
+// the lock-free variant under its own name
+template<class K, class V, class Compare = std::less<K>>
+using ConcurrentSkipList = SkipList<K, V, Compare, true>;
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_SKIP_LIST_H
\ No newline at end of file
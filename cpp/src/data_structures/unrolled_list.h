@@ -0,0 +1,361 @@
+#ifndef DATA_STRUCTURES_UNROLLED_LIST_H
+#define DATA_STRUCTURES_UNROLLED_LIST_H
+
+#include "pch.h"
+#include "data_structures/cache_line.h"
+#include "data_structures/container_stats.h"
+#include "data_structures/pool_allocator.h"
+
+namespace ads {
+
+/* doubly linked list of cache line aligned blocks, each block stores as many values as fit in BlockBytes */
+template<class T, size_t BlockBytes = 2 * cacheLineSize, class Alloc = PoolAllocator<T>, class StatsPolicy = NoStats>
+class UnrolledList {
+	static constexpr size_t headerBytes = 2 * sizeof(void*) + sizeof(size_t);
+
+public:
+	static constexpr size_t blockCapacity = BlockBytes > headerBytes + sizeof(T) ? (BlockBytes - headerBytes) / sizeof(T) : 1;
+
+	struct alignas(cacheLineSize > alignof(T) ? cacheLineSize : alignof(T)) Block {
+		Block() : next(nullptr), prev(nullptr), count(0) {}
+
+		Block(const Block&) = delete;
+		Block& operator=(const Block&) = delete;
+
+		~Block() {}
+
+		T* Data()								{ return std::launder(reinterpret_cast<T*>(storage)); }
+		const T* Data() const					{ return std::launder(reinterpret_cast<const T*>(storage)); }
+		T& operator[](size_t i)					{ return Data()[i]; }
+		const T& operator[](size_t i) const		{ return Data()[i]; }
+		bool IsFull() const						{ return count == blockCapacity; }
+
+		Block* next;
+		Block* prev;
+		size_t count;
+		alignas(T) std::byte storage[blockCapacity * sizeof(T)];
+	};
+
+	using BlockAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Block>;
+	using BlockTraits = std::allocator_traits<BlockAllocator>;
+
+	/* bidirectional iterator over the values, end is a null block */
+	template<bool IsConst>
+	class BlockIterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = std::conditional_t<IsConst, const T*, T*>;
+		using reference = std::conditional_t<IsConst, const T&, T&>;
+
+		BlockIterator() : m_block(nullptr), m_index(0), m_pTail(nullptr) {}
+
+		BlockIterator(Block* block, size_t index, Block* const* pTail) : m_block(block), m_index(index), m_pTail(pTail) {}
+
+		// iterator -> const_iterator
+		template<bool OtherConst> requires (IsConst && !OtherConst)
+		BlockIterator(const BlockIterator<OtherConst>& other) : m_block(other.GetBlock()), m_index(other.GetIndex()), m_pTail(other.GetTailRef()) {}
+
+		Block* GetBlock() const				{ return m_block; }
+		size_t GetIndex() const				{ return m_index; }
+		Block* const* GetTailRef() const	{ return m_pTail; }
+
+		reference operator*() const	{ return (*m_block)[m_index]; }
+		pointer operator->() const	{ return &(*m_block)[m_index]; }
+
+		BlockIterator& operator++() {
+			if (++m_index == m_block->count) {
+				m_block = m_block->next;
+				m_index = 0;
+			}
+			return *this;
+		}
+
+		BlockIterator operator++(int) {
+			BlockIterator temp = *this;
+			++*this;
+			return temp;
+		}
+
+		BlockIterator& operator--() {
+			if (m_block == nullptr) {
+				m_block = *m_pTail;
+				m_index = m_block->count - 1;
+			} else if (m_index == 0) {
+				m_block = m_block->prev;
+				m_index = m_block->count - 1;
+			} else {
+				--m_index;
+			}
+			return *this;
+		}
+
+		BlockIterator operator--(int) {
+			BlockIterator temp = *this;
+			--*this;
+			return temp;
+		}
+
+		template<bool OtherConst>
+		bool operator==(const BlockIterator<OtherConst>& other) const { return m_block == other.GetBlock() && m_index == other.GetIndex(); }
+
+	private:
+		Block* m_block;
+		size_t m_index;
+		Block* const* m_pTail;
+	};
+
+	using value_type = T;
+	using iterator = BlockIterator<false>;
+	using const_iterator = BlockIterator<true>;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+
+	UnrolledList() : m_head(nullptr), m_tail(nullptr), m_size(0) {}
+
+	explicit UnrolledList(const Alloc& alloc) : m_head(nullptr), m_tail(nullptr), m_size(0), m_alloc(alloc) {}
+
+	UnrolledList(const UnrolledList& other)
+		: m_head(nullptr), m_tail(nullptr), m_size(0), m_alloc(BlockTraits::select_on_container_copy_construction(other.m_alloc)) {
+		other.ForEach([this](const T& val) { Append(val); });
+	}
+
+	// steals other's blocks, other is left empty
+	UnrolledList(UnrolledList&& other) noexcept : m_head(other.m_head), m_tail(other.m_tail), m_size(other.m_size), m_alloc(std::move(other.m_alloc)) {
+		m_stats.SwapLive(other.m_stats);
+		other.m_head = nullptr;
+		other.m_tail = nullptr;
+		other.m_size = 0;
+	}
+
+	~UnrolledList() {
+		Clear();
+	}
+
+	UnrolledList& operator=(const UnrolledList& other) {
+		if (this != &other) {
+			Clear();
+			other.ForEach([this](const T& val) { Append(val); });
+		}
+		return *this;
+	}
+
+	UnrolledList& operator=(UnrolledList&& other) noexcept(BlockTraits::propagate_on_container_move_assignment::value || BlockTraits::is_always_equal::value) {
+		if (this == &other)
+			return *this;
+
+		Clear();
+		if constexpr (BlockTraits::propagate_on_container_move_assignment::value) {
+			m_alloc = std::move(other.m_alloc);
+		} else if (!(m_alloc == other.m_alloc)) {
+			// other's blocks can't be freed through m_alloc, so move the values instead
+			other.ForEach([this](T& val) { Append(std::move(val)); });
+			other.Clear();
+			return *this;
+		}
+		m_head = other.m_head;
+		m_tail = other.m_tail;
+		m_size = other.m_size;
+		m_stats.SwapLive(other.m_stats);
+		other.m_head = nullptr;
+		other.m_tail = nullptr;
+		other.m_size = 0;
+		return *this;
+	}
+
+	Block* Head() const		{ return m_head; }
+	Block* Tail() const		{ return m_tail; }
+	size_t Size() const		{ return m_size; }
+	bool IsEmpty() const	{ return m_size == 0; }
+
+	BlockAllocator GetAllocator() const { return m_alloc; }
+
+	// always zero unless StatsPolicy counts, visits are blocks
+	ContainerStats Stats() const	{ return m_stats.Get(); }
+	void ResetStats()				{ m_stats.Reset(); }
+
+	iterator begin()						{ return iterator(m_head, 0, &m_tail); }
+	iterator end()							{ return iterator(nullptr, 0, &m_tail); }
+	const_iterator begin() const			{ return const_iterator(m_head, 0, &m_tail); }
+	const_iterator end() const				{ return const_iterator(nullptr, 0, &m_tail); }
+	const_iterator cbegin() const			{ return const_iterator(m_head, 0, &m_tail); }
+	const_iterator cend() const				{ return const_iterator(nullptr, 0, &m_tail); }
+	reverse_iterator rbegin()				{ return reverse_iterator(end()); }
+	reverse_iterator rend()					{ return reverse_iterator(begin()); }
+	const_reverse_iterator rbegin() const	{ return const_reverse_iterator(end()); }
+	const_reverse_iterator rend() const		{ return const_reverse_iterator(begin()); }
+
+	// calls fn on every value from head to tail, walking each block's values contiguously
+	template<class Fn>
+	void ForEach(Fn&& fn) {
+		for (Block* block = m_head; block != nullptr; block = block->next) {
+			T* data = block->Data();
+			for (size_t i = 0; i < block->count; ++i)
+				fn(data[i]);
+		}
+	}
+
+	template<class Fn>
+	void ForEach(Fn&& fn) const {
+		for (const Block* block = m_head; block != nullptr; block = block->next) {
+			const T* data = block->Data();
+			for (size_t i = 0; i < block->count; ++i)
+				fn(data[i]);
+		}
+	}
+
+	// destroys every value and frees every block
+	void Clear() {
+		while (m_head != nullptr) {
+			Block* temp = m_head;
+			m_head = m_head->next;
+			std::destroy_n(temp->Data(), temp->count);
+			DestroyBlock(temp);
+		}
+		m_tail = nullptr;
+		m_size = 0;
+	}
+
+	// adds a new value to the end of the list, only allocates when the tail block is full
+	void Append(const T& val)	{ EmplaceBack(val); }
+	void Append(T&& val)		{ EmplaceBack(std::move(val)); }
+
+	// adds a new value to the head of the list, shifting the head block's values up by one
+	void Prepend(const T& val)	{ EmplaceFront(val); }
+	void Prepend(T&& val)		{ EmplaceFront(std::move(val)); }
+
+	// constructs a new value in place at the end of the list
+	template<class... Args>
+	T& EmplaceBack(Args&&... args) {
+		if (m_tail == nullptr || m_tail->IsFull())
+			LinkBlockAfter(m_tail, CreateBlock());
+		T* slot = ::new (static_cast<void*>(m_tail->Data() + m_tail->count)) T(std::forward<Args>(args)...);
+		++m_tail->count;
+		++m_size;
+		return *slot;
+	}
+
+	// constructs a new value at the head of the list, in place when the head block is empty
+	template<class... Args>
+	T& EmplaceFront(Args&&... args) {
+		if (m_head == nullptr || m_head->IsFull())
+			LinkBlockAfter(nullptr, CreateBlock());
+
+		T* data = m_head->Data();
+		if (m_head->count == 0) {
+			::new (static_cast<void*>(data)) T(std::forward<Args>(args)...);
+		} else {
+			T temp(std::forward<Args>(args)...);
+			::new (static_cast<void*>(data + m_head->count)) T(std::move(data[m_head->count - 1]));
+			std::move_backward(data, data + m_head->count - 1, data + m_head->count);
+			data[0] = std::move(temp);
+		}
+		++m_head->count;
+		++m_size;
+		return data[0];
+	}
+
+	// remove all values equal to val
+	void Remove(const T& val) {
+		RemoveAll(val);
+	}
+
+	// removes every value equal to val, returns how many were removed
+	size_t RemoveAll(const T& val) {
+		return RemoveIf([&val](const T& other) { return other == val; });
+	}
+
+	// removes every value pred returns true for, the survivors are compacted towards the head in the same pass and emptied blocks are freed
+	template<class Pred>
+	size_t RemoveIf(Pred pred) {
+		const size_t oldSize = m_size;
+		// write cursor trails the read cursor, every slot between them has already been moved out or destroyed
+		Block* writeBlock = m_head;
+		size_t writeIndex = 0;
+		for (Block* readBlock = m_head; readBlock != nullptr; readBlock = readBlock->next) {
+			m_stats.OnVisit();
+			T* data = readBlock->Data();
+			const size_t count = readBlock->count;
+			for (size_t readIndex = 0; readIndex < count; ++readIndex) {
+				if (pred(data[readIndex])) {
+					std::destroy_at(data + readIndex);
+					--m_size;
+					continue;
+				}
+				if (writeIndex == blockCapacity) {
+					writeBlock->count = blockCapacity;
+					writeBlock = writeBlock->next;
+					writeIndex = 0;
+				}
+				if (writeBlock != readBlock || writeIndex != readIndex) {
+					::new (static_cast<void*>(writeBlock->Data() + writeIndex)) T(std::move(data[readIndex]));
+					std::destroy_at(data + readIndex);
+				}
+				++writeIndex;
+			}
+		}
+
+		if (writeBlock == nullptr)
+			return oldSize - m_size;
+		writeBlock->count = writeIndex;
+
+		// everything after the write block is now empty
+		Block* unused = writeBlock->next;
+		if (writeIndex == 0) {
+			unused = writeBlock;
+			writeBlock = writeBlock->prev;
+		}
+		if (writeBlock != nullptr)
+			writeBlock->next = nullptr;
+		else
+			m_head = nullptr;
+		m_tail = writeBlock;
+		while (unused != nullptr) {
+			Block* temp = unused;
+			unused = unused->next;
+			DestroyBlock(temp);
+		}
+		return oldSize - m_size;
+	}
+
+private:
+	Block* CreateBlock() {
+		Block* block = BlockTraits::allocate(m_alloc, 1);
+		BlockTraits::construct(m_alloc, block);
+		m_stats.OnAllocate(sizeof(Block));
+		return block;
+	}
+
+	// the block's values must already be destroyed
+	void DestroyBlock(Block* block) {
+		BlockTraits::destroy(m_alloc, block);
+		BlockTraits::deallocate(m_alloc, block, 1);
+		m_stats.OnFree(sizeof(Block));
+	}
+
+	// links block after pos, or at the head when pos is null
+	void LinkBlockAfter(Block* pos, Block* block) {
+		block->prev = pos;
+		block->next = pos != nullptr ? pos->next : m_head;
+		if (block->next != nullptr)
+			block->next->prev = block;
+		else
+			m_tail = block;
+		if (pos != nullptr)
+			pos->next = block;
+		else
+			m_head = block;
+	}
+
+	Block* m_head;
+	Block* m_tail;
+	size_t m_size;
+	BlockAllocator m_alloc;
+	ADS_NO_UNIQUE_ADDRESS StatsPolicy m_stats;
+};
+
+} // namespace ads
+
+#endif // DATA_STRUCTURES_UNROLLED_LIST_H
\ No newline at end of file
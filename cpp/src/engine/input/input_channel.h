@@ -0,0 +1,61 @@
+#ifndef ENGINE_INPUT_INPUT_CHANNEL_H
+#define ENGINE_INPUT_INPUT_CHANNEL_H
+
+#include "data_structures/bounded_spsc_queue.h"
+#include "engine/input/input_events.h"
+
+namespace engine {
+
+/* hands timestamped input from a capture thread to the update loop without locks, exactly one thread may push and one may drain,
+   pushing never blocks, when the update loop falls a whole ring behind new events are dropped and counted */
+class InputChannel {
+public:
+	explicit InputChannel(size_t capacity = 4096) : m_queue(capacity), m_dropped(0) {}
+	InputChannel(const InputChannel&) = delete;
+	InputChannel& operator=(const InputChannel&) = delete;
+
+	// monotonic nanoseconds every event is stamped with
+	static int64_t Now() noexcept {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	size_t Capacity() const noexcept { return m_queue.Capacity(); }
+	uint64_t GetDroppedCount() const noexcept { return m_dropped.load(std::memory_order_relaxed); }
+
+	// capture thread only
+	bool Push(const KeyboardEvent& key) { return Push(InputEvent(key, Now())); }
+	bool PushChar(const unsigned char character) { return Push(InputEvent(character, Now())); }
+	bool Push(const MouseEvent& mouse) { return Push(InputEvent(mouse, Now())); }
+	bool PushRawDelta(const MouseXY rawDelta) { return Push(InputEvent(rawDelta, Now())); }
+
+	bool Push(const InputEvent& event) {
+		if (m_queue.TryPush(event))
+			return true;
+		m_dropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	// update thread only, moves up to out.size() events oldest first, returns how many were written
+	size_t Drain(std::span<InputEvent> out) {
+		return m_queue.TryPop(out.data(), out.size());
+	}
+
+	// update thread only, calls fn for every event pushed so far, in batches so the producer sees freed cells a batch at a time
+	template<class Fn>
+	size_t Dispatch(Fn&& fn) {
+		InputEvent batch[64];
+		size_t total = 0;
+		for (size_t count; (count = m_queue.TryPop(batch, std::size(batch))) > 0; total += count) {
+			for (size_t i = 0; i < count; ++i)
+				fn(batch[i]);
+		}
+		return total;
+	}
+private:
+	ads::BoundedSpscQueue<InputEvent> m_queue;
+	std::atomic<uint64_t> m_dropped;
+};
+
+} // namespace engine
+
+#endif // ENGINE_INPUT_INPUT_CHANNEL_H
\ No newline at end of file
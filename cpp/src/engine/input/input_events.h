@@ -0,0 +1,98 @@
+#ifndef ENGINE_INPUT_INPUT_EVENTS_H
+#define ENGINE_INPUT_INPUT_EVENTS_H
+
+namespace engine {
+
+class KeyboardEvent {
+public:
+	enum class EventType {
+		Down,
+		Up,
+		Invalid
+	};
+
+	KeyboardEvent() noexcept : m_type(EventType::Invalid), m_key(0u) {}
+	KeyboardEvent(const EventType type, const unsigned char key) noexcept : m_type(type), m_key(key) {}
+	bool IsKeyDown() const noexcept { return m_type == EventType::Down; }
+	bool IsKeyUp() const noexcept { return m_type == EventType::Up; }
+	bool IsValid() const noexcept { return m_type != EventType::Invalid; }
+	unsigned char GetKey() const noexcept { return m_key; }
+private:
+	EventType m_type;
+	unsigned char m_key;
+};
+
+struct MouseXY {
+	int x;
+	int y;
+};
+
+struct ScreenCoords {
+	long x;
+	long y;
+};
+
+class MouseEvent {
+public:
+	enum class EventType {
+		LeftDown,
+		LeftUp,
+		RightDown,
+		RightUp,
+		MiddleDown,
+		MiddleUp,
+		WheelDown,
+		WheelUp,
+		Move,
+		MoveRaw,
+		Invalid
+	};
+
+	MouseEvent() noexcept : m_type(EventType::Invalid), m_x(0), m_y(0) {}
+	MouseEvent(const EventType type, const int x, const int y) noexcept : m_type(type), m_x(x), m_y(y) {}
+	bool IsValid() const noexcept { return m_type != EventType::Invalid; }
+	EventType GetType() const noexcept { return m_type; }
+	int GetX() const noexcept { return m_x; }
+	int GetY() const noexcept { return m_y; }
+	MouseXY GetMouseXY() const noexcept { return { m_x, m_y }; }
+private:
+	EventType m_type;
+	int m_x;
+	int m_y;
+};
+
+/* one keyboard, character or mouse event stamped with the time it was captured, what the input thread hands to the update loop */
+class InputEvent {
+public:
+	enum class Source : uint8_t {
+		Key,
+		Char,
+		Mouse,
+		RawDelta
+	};
+
+	InputEvent() noexcept : m_source(Source::Key), m_timestamp(0), m_key() {}
+	InputEvent(const KeyboardEvent& key, const int64_t timestamp) noexcept : m_source(Source::Key), m_timestamp(timestamp), m_key(key) {}
+	InputEvent(const unsigned char character, const int64_t timestamp) noexcept : m_source(Source::Char), m_timestamp(timestamp), m_char(character) {}
+	InputEvent(const MouseEvent& mouse, const int64_t timestamp) noexcept : m_source(Source::Mouse), m_timestamp(timestamp), m_mouse(mouse) {}
+	InputEvent(const MouseXY rawDelta, const int64_t timestamp) noexcept : m_source(Source::RawDelta), m_timestamp(timestamp), m_rawDelta(rawDelta) {}
+	Source GetSource() const noexcept { return m_source; }
+	int64_t GetTimestamp() const noexcept { return m_timestamp; }
+	const KeyboardEvent& GetKeyboardEvent() const noexcept { return m_key; }
+	unsigned char GetChar() const noexcept { return m_char; }
+	const MouseEvent& GetMouseEvent() const noexcept { return m_mouse; }
+	MouseXY GetRawDelta() const noexcept { return m_rawDelta; }
+private:
+	Source m_source;
+	int64_t m_timestamp;	// steady clock nanoseconds, see InputChannel::Now
+	union {
+		KeyboardEvent m_key;
+		unsigned char m_char;
+		MouseEvent m_mouse;
+		MouseXY m_rawDelta;
+	};
+};
+
+} // namespace engine
+
+#endif // ENGINE_INPUT_INPUT_EVENTS_H
\ No newline at end of file
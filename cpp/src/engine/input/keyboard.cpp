@@ -5,40 +5,52 @@ namespace engine {
 
 Keyboard::Keyboard() {
 	memset(m_keyStates, 0, sizeof(m_keyStates));
+	// room for a busy frame up front, the buffers only grow past it during bursts and never shrink
+	m_keyBuffer.Reserve(64);
+	m_charBuffer.Reserve(64);
 }
 
 KeyboardEvent Keyboard::ReadKey() {
-	if (m_keyBuffer.empty()) {
+	if (m_keyBuffer.IsEmpty()) {
 		return KeyboardEvent(KeyboardEvent::EventType::Invalid, 0u);
 	} else {
-		KeyboardEvent e = m_keyBuffer.front();
-		m_keyBuffer.pop();
+		KeyboardEvent e = m_keyBuffer.Front();
+		m_keyBuffer.PopFront();
 		return e;
 	}
 }
 
 unsigned char Keyboard::ReadChar() {
-	if (m_charBuffer.empty()) {
+	if (m_charBuffer.IsEmpty()) {
 		return 0u;
 	} else {
-		unsigned char e = m_charBuffer.front();
-		m_charBuffer.pop();
+		unsigned char e = m_charBuffer.Front();
+		m_charBuffer.PopFront();
 		return e;
 	}
 }
 
+// drains up to out.size() events oldest first, returns how many were written
+size_t Keyboard::ReadKeys(std::span<KeyboardEvent> out) {
+	return m_keyBuffer.PopFront(out.size(), out.data());
+}
+
+size_t Keyboard::ReadChars(std::span<unsigned char> out) {
+	return m_charBuffer.PopFront(out.size(), out.data());
+}
+
 void Keyboard::OnKeyDown(const unsigned char key) {
 	m_keyStates[key] = true;
-	m_keyBuffer.push(KeyboardEvent(KeyboardEvent::EventType::Down, key));
+	m_keyBuffer.PushBack(KeyboardEvent(KeyboardEvent::EventType::Down, key));
 }
 
 void Keyboard::OnKeyUp(const unsigned char key) {
 	m_keyStates[key] = false;
-	m_keyBuffer.push(KeyboardEvent(KeyboardEvent::EventType::Up, key));
+	m_keyBuffer.PushBack(KeyboardEvent(KeyboardEvent::EventType::Up, key));
 }
 
 void Keyboard::OnChar(const unsigned char key) {
-	m_charBuffer.push(key);
+	m_charBuffer.PushBack(key);
 }
 
 void Keyboard::ClearKeyStates() {
@@ -46,7 +58,7 @@ void Keyboard::ClearKeyStates() {
 }
 
 void Keyboard::ClearKeyBuffer() {
-	m_keyBuffer = {};
+	m_keyBuffer.Clear();
 }
 
 void Keyboard::EnableAutoRepeatKeys() {
@@ -6,6 +6,9 @@ namespace engine {
 
 Mouse::Mouse(HWND hWnd) {
 	m_applicationHWnd = hWnd;
+	// raw deltas arrive at the device polling rate, several per frame
+	m_eventBuffer.Reserve(64);
+	m_rawDeltaBuffer.Reserve(256);
 }
 
 Mouse::~Mouse() {
@@ -14,75 +17,84 @@ Mouse::~Mouse() {
 
 void Mouse::OnLeftDown(int x, int y) {
 	m_isLeftDown = true;
-	m_eventBuffer.push({ MouseEvent::EventType::LeftDown, x, y });
+	m_eventBuffer.PushBack({ MouseEvent::EventType::LeftDown, x, y });
 }
 
 void Mouse::OnLeftUp(int x, int y) {
 	m_isLeftDown = false;
-	m_eventBuffer.push({ MouseEvent::EventType::LeftUp, x, y });
+	m_eventBuffer.PushBack({ MouseEvent::EventType::LeftUp, x, y });
 }
 
 void Mouse::OnRightDown(int x, int y) {
 	m_isRightDown = true;
-	m_eventBuffer.push({ MouseEvent::EventType::RightDown, x, y });
+	m_eventBuffer.PushBack({ MouseEvent::EventType::RightDown, x, y });
 }
 
 void Mouse::OnRightUp(int x, int y) {
 	m_isRightDown = false;
-	m_eventBuffer.push({ MouseEvent::EventType::RightUp, x, y });
+	m_eventBuffer.PushBack({ MouseEvent::EventType::RightUp, x, y });
 }
 
 void Mouse::OnMiddleDown(int x, int y) {
 	m_isMiddleDown = true;
-	m_eventBuffer.push({ MouseEvent::EventType::MiddleDown, x, y });
+	m_eventBuffer.PushBack({ MouseEvent::EventType::MiddleDown, x, y });
 }
 
 void Mouse::OnMiddleUp(int x, int y) {
 	m_isMiddleDown = false;
-	m_eventBuffer.push({ MouseEvent::EventType::MiddleUp, x, y });
+	m_eventBuffer.PushBack({ MouseEvent::EventType::MiddleUp, x, y });
 }
 
 void Mouse::OnWheelDown(int x, int y) {
-	m_eventBuffer.push({ MouseEvent::EventType::WheelDown, x, y });
+	m_eventBuffer.PushBack({ MouseEvent::EventType::WheelDown, x, y });
 }
 
 void Mouse::OnWheelUp(int x, int y) {
-	m_eventBuffer.push({ MouseEvent::EventType::WheelUp, x, y });
+	m_eventBuffer.PushBack({ MouseEvent::EventType::WheelUp, x, y });
 }
 
 void Mouse::OnMouseMove(int x, int y) {
 	if (!m_lockCursorPosition) {
 		m_x = x;
 		m_y = y;
-		m_eventBuffer.push({ MouseEvent::EventType::Move, x, y });
+		m_eventBuffer.PushBack({ MouseEvent::EventType::Move, x, y });
 	}
 }
 
 void Mouse::OnMouseMoveRaw(int x, int y) {
-	//m_eventBuffer.push({ MouseEvent::EventType::MoveRaw, x, y });
-	m_rawDeltaBuffer.push({x, y});
+	//m_eventBuffer.PushBack({ MouseEvent::EventType::MoveRaw, x, y });
+	m_rawDeltaBuffer.PushBack({x, y});
 }
 
 MouseEvent Mouse::ReadEvent() {
-	if (m_eventBuffer.empty()) {
+	if (m_eventBuffer.IsEmpty()) {
 		return { MouseEvent::EventType::Invalid, 0, 0 };
 	} else {
-		MouseEvent e = m_eventBuffer.front();
-		m_eventBuffer.pop();
+		MouseEvent e = m_eventBuffer.Front();
+		m_eventBuffer.PopFront();
 		return e;
 	}
 }
 
 MouseXY Mouse::ReadRawDelta() {
-	if (m_rawDeltaBuffer.empty()) {
+	if (m_rawDeltaBuffer.IsEmpty()) {
 		return { 0, 0 };
 	} else {
-		const MouseXY d = m_rawDeltaBuffer.front();
-		m_rawDeltaBuffer.pop();
+		const MouseXY d = m_rawDeltaBuffer.Front();
+		m_rawDeltaBuffer.PopFront();
 		return d;
 	}
 }
 
+// drains up to out.size() events oldest first, returns how many were written
+size_t Mouse::ReadEvents(std::span<MouseEvent> out) {
+	return m_eventBuffer.PopFront(out.size(), out.data());
+}
+
+size_t Mouse::ReadRawDeltas(std::span<MouseXY> out) {
+	return m_rawDeltaBuffer.PopFront(out.size(), out.data());
+}
+
 bool Mouse::IsButtonDown(const uint16_t buttonValue) const noexcept {
 	switch (buttonValue) {
 	case constants::inputMouseLeft:
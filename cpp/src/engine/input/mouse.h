@@ -1,45 +1,10 @@
 #ifndef ENGINE_INPUT_MOUSE_H
 #define ENGINE_INPUT_MOUSE_H
 
-namespace engine {
-
-struct MouseXY {
-	int x;
-	int y;
-};
-
-struct ScreenCoords {
-	long x;
-	long y;
-};
-
-class MouseEvent {
-public:
-	enum class EventType {
-		LeftDown,
-		LeftUp,
-		RightDown,
-		RightUp,
-		MiddleDown,
-		MiddleUp,
-		WheelDown,
-		WheelUp,
-		Move,
-		MoveRaw,
-		Invalid
-	};
+#include "data_structures/ring_buffer.h"
+#include "engine/input/input_events.h"
 
-	MouseEvent(const EventType type, const int x, const int y) noexcept : m_type(type), m_x(x), m_y(y) {}
-	bool IsValid() const noexcept { return m_type != EventType::Invalid; }
-	EventType GetType() const noexcept { return m_type; }
-	int GetX() const noexcept { return m_x; }
-	int GetY() const noexcept { return m_y; }
-	MouseXY GetMouseXY() const noexcept { return { m_x, m_y }; }
-private:
-	EventType m_type;
-	int m_x;
-	int m_y;
-};
+namespace engine {
 
 class Mouse {
 public:
@@ -57,20 +22,22 @@ public:
 	void OnMouseMoveRaw(int x, int y);
 	MouseEvent ReadEvent();
 	MouseXY ReadRawDelta();
+	size_t ReadEvents(std::span<MouseEvent> out);
+	size_t ReadRawDeltas(std::span<MouseXY> out);
 
 	bool IsCursorEnabled() const noexcept { return m_isCursorEnabled; }
 	bool IsLeftDown() const noexcept { return m_isLeftDown; }
 	bool IsRightDown() const noexcept { return m_isRightDown; }
 	bool IsMiddleDown() const noexcept { return m_isMiddleDown; }
 	bool IsRawEnabled() const noexcept { return m_isRawEnabled; }
-	bool IsEventBufferEmpty() const noexcept { return m_eventBuffer.empty(); }
-	bool IsRawDeltaBufferEmpty() const noexcept { return m_rawDeltaBuffer.empty(); }
+	bool IsEventBufferEmpty() const noexcept { return m_eventBuffer.IsEmpty(); }
+	bool IsRawDeltaBufferEmpty() const noexcept { return m_rawDeltaBuffer.IsEmpty(); }
 	bool IsButtonDown(uint16_t buttonValue) const noexcept;
 
 	int GetX() const noexcept { return m_x; }
 	int GetY() const noexcept { return m_y; }
 	MouseXY GetPosition() const noexcept { return { m_x, m_y }; }
-	void FlushRawDeltaBuffer() { m_rawDeltaBuffer = std::queue<MouseXY>(); }
+	void FlushRawDeltaBuffer() { m_rawDeltaBuffer.Clear(); }
 	void EnableRaw(bool enable) noexcept { m_isRawEnabled = enable; }
 	void EnableCursor(bool enable) noexcept;
 	void ConfineCursor() noexcept;
@@ -79,8 +46,8 @@ public:
 	void ShowCursor() noexcept;
 	void ClearDownButtons() noexcept;
 private:
-	std::queue<MouseEvent> m_eventBuffer;
-	std::queue<MouseXY> m_rawDeltaBuffer;
+	ads::RingBuffer<MouseEvent> m_eventBuffer;
+	ads::RingBuffer<MouseXY> m_rawDeltaBuffer;
 	HWND m_applicationHWnd;
 	bool m_isCursorEnabled = true;
 	bool m_lockCursorPosition = false;
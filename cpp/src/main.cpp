@@ -1,10 +1,14 @@
 #include "pch.h"
 
 // define which subsystem to use
-#ifndef SUB_SYS_CONSOLE
+#if !defined(SUB_SYS_CONSOLE) && !defined(SUB_SYS_BENCHMARK)
 #define SUB_SYS_CONSOLE		// console
 #endif
 
+//#ifndef SUB_SYS_BENCHMARK
+//#define SUB_SYS_BENCHMARK		// console benchmarks
+//#endif
+
 //#ifndef SUB_SYS_WINDOWS
 //#define SUB_SYS_WINDOWS		// windows desktop
 //#endif
@@ -13,8 +17,26 @@
 // console testing entry point
 #ifdef SUB_SYS_CONSOLE
 
+#include "tests/array_linked_list_tests.h"
+#include "tests/btree_map_tests.h"
+#include "tests/cache_tests.h"
+#include "tests/concurrent_queue_tests.h"
+#include "tests/container_stats_tests.h"
+#include "tests/flat_hash_map_tests.h"
+#include "tests/graph_tests.h"
+#include "tests/heap_tests.h"
+#include "tests/input_channel_tests.h"
 #include "tests/linked_list_tests.h"
 #include "tests/doubly_linked_list_tests.h"
+#include "tests/intrusive_list_tests.h"
+#include "tests/pool_allocator_tests.h"
+#include "tests/ring_buffer_tests.h"
+#include "tests/search_tests.h"
+#include "tests/shortest_path_tests.h"
+#include "tests/skip_list_tests.h"
+#include "tests/sort_tests.h"
+#include "tests/string_search_tests.h"
+#include "tests/unrolled_list_tests.h"
 
 int main() {
 	TestLinkedList_Float(std::cout);
@@ -23,16 +45,197 @@ int main() {
 	TestLinkedList_Class(std::cout);
 	std::cout << std::endl;
 
+	TestLinkedList_AppendRange(std::cout);
+	std::cout << std::endl;
+
+	TestLinkedList_Iterators(std::cout);
+	std::cout << std::endl;
+
+	TestLinkedList_Move(std::cout);
+	std::cout << std::endl;
+
+	TestLinkedList_RemoveIf(std::cout);
+	std::cout << std::endl;
+
 	TestTrackedLinkedList(std::cout);
 	std::cout << std::endl;
 
+	TestTrackedLinkedList_Cursor(std::cout);
+	std::cout << std::endl;
+
 	TestDoublyLinkedList_Int(std::cout);
 	std::cout << std::endl;
+
+	TestDoublyLinkedList_Iterators(std::cout);
+	std::cout << std::endl;
+
+	TestDoublyLinkedList_Emplace(std::cout);
+	std::cout << std::endl;
+
+	TestDoublyLinkedList_SpliceMergeSort(std::cout);
+	std::cout << std::endl;
+
+	TestDoublyLinkedList_RemoveIf(std::cout);
+	std::cout << std::endl;
+
+	TestArrayLinkedList(std::cout);
+	std::cout << std::endl;
+
+	TestIntrusiveList(std::cout);
+	std::cout << std::endl;
+
+	TestBTreeMap(std::cout);
+	std::cout << std::endl;
+
+	TestFlatHashMap(std::cout);
+	std::cout << std::endl;
+
+	TestLruCache(std::cout);
+	std::cout << std::endl;
+
+	TestLfuCache(std::cout);
+	std::cout << std::endl;
+
+	TestDaryHeap(std::cout);
+	std::cout << std::endl;
+
+	TestRadixHeap(std::cout);
+	std::cout << std::endl;
+
+	TestSkipList(std::cout);
+	std::cout << std::endl;
+
+	TestConcurrentSkipList(std::cout);
+	std::cout << std::endl;
+
+	TestRadixSort(std::cout);
+	std::cout << std::endl;
+
+	TestPdqSort(std::cout);
+	std::cout << std::endl;
+
+	TestParallelMergeSort(std::cout);
+	std::cout << std::endl;
+
+	TestBranchlessLowerBound(std::cout);
+	std::cout << std::endl;
+
+	TestEytzingerArray(std::cout);
+	std::cout << std::endl;
+
+	TestStaticBTree(std::cout);
+	std::cout << std::endl;
+
+	TestSubstringSearcher(std::cout);
+	std::cout << std::endl;
+
+	TestTwoWaySearcher(std::cout);
+	std::cout << std::endl;
+
+	TestAhoCorasick(std::cout);
+	std::cout << std::endl;
+
+	TestCsrGraph(std::cout);
+	std::cout << std::endl;
+
+	TestGraphGenerators(std::cout);
+	std::cout << std::endl;
+
+	TestBreadthFirstSearch(std::cout);
+	std::cout << std::endl;
+
+	TestConnectedComponents(std::cout);
+	std::cout << std::endl;
+
+	TestPageRank(std::cout);
+	std::cout << std::endl;
+
+	TestDijkstra(std::cout);
+	std::cout << std::endl;
+
+	TestDeltaStepping(std::cout);
+	std::cout << std::endl;
+
+	TestAStar(std::cout);
+	std::cout << std::endl;
+
+	TestConcurrentQueues(std::cout);
+	std::cout << std::endl;
+
+	TestInputChannel(std::cout);
+	std::cout << std::endl;
+
+	TestContainerSizes(std::cout);
+	std::cout << std::endl;
+
+	TestContainerStats(std::cout);
+	std::cout << std::endl;
+
+	TestPoolAllocator(std::cout);
+	std::cout << std::endl;
+
+	TestRingBuffer(std::cout);
+	std::cout << std::endl;
+
+	TestUnrolledList_Int(std::cout);
+	std::cout << std::endl;
+
+	TestUnrolledList_String(std::cout);
+	std::cout << std::endl;
 }
 
 #endif	// SUB_SYS_CONSOLE
 
 
+// console benchmark entry point
+#ifdef SUB_SYS_BENCHMARK
+
+#include "benchmarks/btree_map_benchmarks.h"
+#include "benchmarks/cache_benchmarks.h"
+#include "benchmarks/concurrent_queue_benchmarks.h"
+#include "benchmarks/container_benchmarks.h"
+#include "benchmarks/graph_benchmarks.h"
+#include "benchmarks/hash_map_benchmarks.h"
+#include "benchmarks/heap_benchmarks.h"
+#include "benchmarks/input_channel_benchmarks.h"
+#include "benchmarks/ring_buffer_benchmarks.h"
+#include "benchmarks/search_benchmarks.h"
+#include "benchmarks/shortest_path_benchmarks.h"
+#include "benchmarks/skip_list_benchmarks.h"
+#include "benchmarks/sort_benchmarks.h"
+#include "benchmarks/string_search_benchmarks.h"
+
+// e.g. main --format=json --max-size=100000 --filter=ads::DoublyLinkedList --output=results.json
+int main(int argc, char* argv[]) {
+	const BenchmarkOptions options = BenchmarkOptions::Parse(argc, argv);
+	BenchmarkReport report(&std::cerr);
+
+	BenchmarkContainers(report, options);
+	BenchmarkCaches(report, options);
+	BenchmarkHashMaps(report, options);
+	BenchmarkOrderedMaps(report, options);
+	BenchmarkHeaps(report, options);
+	BenchmarkSkipLists(report, options);
+	BenchmarkRingBuffers(report, options);
+	BenchmarkConcurrentQueues(report, options);
+	BenchmarkInputChannels(report, options);
+	BenchmarkSorts(report, options);
+	BenchmarkSearches(report, options);
+	BenchmarkStringSearches(report, options);
+	BenchmarkGraphs(report, options);
+	BenchmarkShortestPaths(report, options);
+
+	if (options.outputPath.empty()) {
+		report.Write(std::cout, options.format);
+	} else {
+		std::ofstream file(options.outputPath);
+		report.Write(file, options.format);
+	}
+}
+
+#endif	// SUB_SYS_BENCHMARK
+
+
 // windows desktop entry point
 #ifdef SUB_SYS_WINDOWS
 
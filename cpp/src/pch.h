@@ -14,6 +14,7 @@
 	#include <dwrite_3.h>
 	#include <dxgi1_4.h>
 	#include <dxgidebug.h>
+	#include <tchar.h>
 	#include <wincodec.h>
 	#include <Windows.h>
 	#include <wrl.h>
@@ -23,6 +24,8 @@
 
 #elif defined(__linux__)			// Debian, Ubuntu, Gentoo, Fedora, openSUSE, RedHat, Centos and other
 	#define PLATFORM_NAME "linux"
+	#include <pthread.h>
+	#include <sched.h>
 
 #elif defined(__unix__) || !defined(__APPLE__) && defined(__MACH__)
 	#include <sys/param.h>
@@ -31,11 +34,49 @@
 	#endif
 #endif
 
+// msvc accepts the standard [[no_unique_address]] but ignores it, empty members only take no space with its own spelling
+#if defined(_MSC_VER)
+	#define ADS_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+	#define ADS_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <forward_list>
+#include <fstream>
+#include <functional>
 #include <future>
+#include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
 #include <queue>
+#include <random>
+#include <span>
+#include <sstream>
 #include <string>
-#include <tchar.h>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #endif // PCH_H
\ No newline at end of file
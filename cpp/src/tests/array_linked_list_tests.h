@@ -0,0 +1,80 @@
+#ifndef TESTS_ARRAY_LINKED_LIST_TESTS_H
+#define TESTS_ARRAY_LINKED_LIST_TESTS_H
+
+#include "pch.h"
+#include "data_structures/array_linked_list.h"
+
+void TestArrayLinkedList(std::ostream& os) {
+	typedef ads::ArrayLinkedList<int> iList;
+	static_assert(std::bidirectional_iterator<iList::iterator>);
+	static_assert(std::bidirectional_iterator<iList::const_iterator>);
+
+	os << ":: TestArrayLinkedList ::\n";
+	os << "node bytes: " << sizeof(iList::Node) << std::endl;
+
+	iList list;
+	list.Append(1);
+	list.Append(2);
+	list.Append(3);
+	list.Append(4);
+	list.Prepend(0);
+	list.Prepend(2);
+	list.Append(5);
+	list.Append(2);
+
+	os << "list values from head -> end, with their slot:\n";
+	for (uint32_t i = list.Head(); i != iList::nullIndex; i = list.GetNode(i).next)
+		os << list.GetNode(i).Value() << " @ " << i << std::endl;
+
+	os << "remove all 2 nodes: " << list.RemoveAll(2) << " removed\n";
+	os << "list values from end -> head:\n";
+	for (auto it = list.rbegin(); it != list.rend(); ++it)
+		os << *it << std::endl;
+
+	// freed slots are handed out again before the array grows
+	list.Append(6);
+	list.Prepend(-1);
+	list.Append(7);
+	os << "reused slots, tail " << list.GetNode(list.Tail()).Value() << " @ " << list.Tail() << ", head " << list.GetNode(list.Head()).Value() << " @ " << list.Head() << std::endl;
+
+	list.Compact();
+	os << "after compacting, size " << list.Size() << ", capacity " << list.Capacity() << ", slots in list order:";
+	for (uint32_t i = list.Head(); i != iList::nullIndex; i = list.GetNode(i).next)
+		os << " " << i;
+	os << std::endl;
+
+	// indices outlive the array growing underneath them
+	const uint32_t first = list.Head();
+	for (int i = 0; i < 1000; ++i)
+		list.Append(i);
+	os << "head slot still holds " << list.GetNode(first).Value() << ", size " << list.Size() << std::endl;
+
+	list.Erase(list.begin());
+	os << "odd values removed: " << list.RemoveIf([](int val) { return val % 2 != 0; }) << ", sum " << std::accumulate(list.begin(), list.end(), 0) << std::endl;
+
+	iList copy = list;
+	iList moved = std::move(list);
+	os << "copy size: " << copy.Size() << ", moved size: " << moved.Size() << ", moved-from is empty: " << (list.IsEmpty() ? "yes" : "no") << std::endl;
+
+	ads::ArrayLinkedList<std::string> strings;
+	strings.Append("b");
+	strings.Prepend("a");
+	strings.EmplaceBack(3, 'c');
+	strings.Remove("b");
+	for (int i = 0; i < 40; ++i)
+		strings.EmplaceBack("long enough to live on the heap " + std::to_string(i));
+	strings.RemoveIf([](const std::string& val) { return val.size() > 3; });
+	os << "strings:";
+	for (const std::string& val : strings)
+		os << " " << val;
+	os << std::endl;
+
+	// appending one of the list's own values while the array is full, growing it must not free the value first
+	ads::ArrayLinkedList<std::string> full;
+	while (full.Size() < 16 || full.Size() < full.Capacity())
+		full.Append("value that lives on the heap " + std::to_string(full.Size()));
+	full.Append(*full.begin());
+	os << "own value appended while growing: " << *std::prev(full.end()) << ", capacity " << full.Capacity() << std::endl;
+}
+
+#endif // TESTS_ARRAY_LINKED_LIST_TESTS_H
\ No newline at end of file
@@ -0,0 +1,118 @@
+#ifndef TESTS_BTREE_MAP_TESTS_H
+#define TESTS_BTREE_MAP_TESTS_H
+
+#include "pch.h"
+#include "data_structures/btree_map.h"
+
+void TestBTreeMap(std::ostream& os) {
+	os << ":: TestBTreeMap ::\n";
+
+	// the in-node search against std::lower_bound for signed, unsigned and non integer keys
+	bool searchMatches = true;
+	const std::vector<int32_t> signedKeys = { -50, -7, -3, 0, 2, 9, 11, 40, 41, 100, 250 };
+	const std::vector<uint64_t> unsignedKeys = { 1, 5, 9, 1ull << 40, 1ull << 63, (1ull << 63) + 7, UINT64_MAX };
+	const std::vector<double> doubleKeys = { -1.5, 0.25, 3.0, 8.5, 9.0 };
+	for (int32_t key = -60; key <= 260; ++key)
+		searchMatches &= ads::NodeLowerBound(signedKeys.data(), 11, key) == std::lower_bound(signedKeys.begin(), signedKeys.end(), key) - signedKeys.begin();
+	for (uint64_t key : std::initializer_list<uint64_t>{ 0, 1, 6, 1ull << 41, 1ull << 63, (1ull << 63) + 8, UINT64_MAX })
+		searchMatches &= ads::NodeLowerBound(unsignedKeys.data(), 7, key) == std::lower_bound(unsignedKeys.begin(), unsignedKeys.end(), key) - unsignedKeys.begin();
+	for (double key : { -2.0, 0.25, 5.0, 9.0, 10.0 })
+		searchMatches &= ads::NodeLowerBound(doubleKeys.data(), 5, key) == std::lower_bound(doubleKeys.begin(), doubleKeys.end(), key) - doubleKeys.begin();
+	os << "node lower bound matches std::lower_bound: " << (searchMatches ? "yes" : "no") << std::endl;
+
+	ads::BTreeMap<int, std::string> names;
+	names.Insert(3, "three");
+	names.Insert(1, "one");
+	names[2] = "two";
+	os << "inserted again: " << (names.TryEmplace(2, "TWO").second ? "yes" : "no") << ", in order:";
+	for (auto [key, value] : names)
+		os << " " << key << "=" << value;
+	os << std::endl;
+
+	// 64 byte nodes hold a handful of keys, so a few thousand keys build a deep tree
+	using SmallTree = ads::BTreeMap<int, int, 64>;
+	SmallTree tree;
+	std::map<int, int> reference;
+	std::mt19937 rng(7);
+	for (int i = 0; i < 20000; ++i) {
+		const int key = static_cast<int>(rng() % 5000);
+		if (rng() % 3 == 0) {
+			tree.Erase(key);
+			reference.erase(key);
+		} else {
+			tree.InsertOrAssign(key, i);
+			reference[key] = i;
+		}
+	}
+	bool same = tree.Size() == reference.size() && std::equal(tree.begin(), tree.end(), reference.begin(), reference.end(),
+		[](const auto& a, const auto& b) { return a.first == b.first && a.second == b.second; });
+	for (int key = -1; key <= 5001; key += 7) {
+		const auto it = reference.lower_bound(key);
+		const auto found = tree.LowerBound(key);
+		same &= it == reference.end() ? found == tree.end() : found != tree.end() && found.Key() == it->first;
+	}
+	os << "random inserts and erases match std::map: " << (same ? "yes" : "no") << ", size " << tree.Size()
+		<< ", slots " << SmallTree::leafSlots << "/" << SmallTree::innerSlots << ", height " << tree.Height() << std::endl;
+
+	for (int key = 0; key < 5000; ++key)
+		tree.Erase(key);
+	os << "after erasing everything: size " << tree.Size() << ", height " << tree.Height() << ", begin == end: " << (tree.begin() == tree.end() ? "yes" : "no") << std::endl;
+
+	// sorted timestamps loaded in one pass, the duplicate and the out of order one are skipped
+	std::vector<std::pair<long long, int>> events;
+	for (int i = 0; i < 1000; ++i)
+		events.emplace_back(1000LL * i, i);
+	events.insert(events.begin() + 10, { 9000LL, -1 });
+	events.emplace_back(5, -2);
+	ads::BTreeMap<long long, int, 64> timeline;
+	timeline.BulkLoad(events.begin(), events.end());
+	long long sum = 0;
+	const size_t visited = timeline.ForEachInRange(250000, 260000, [&sum](long long, int value) { sum += value; });
+	os << "bulk loaded " << timeline.Size() << ", height " << timeline.Height() << ", range [250000, 260000) visited " << visited << " sum " << sum
+		<< ", upper bound of 9000 is " << timeline.UpperBound(9000).Key() << std::endl;
+
+	// values can be changed in place, keys only ever arrive const
+	bool keysConst = true;
+	timeline.ForEachInRange(250000, 253000, [&keysConst](auto& key, int& value) {
+		keysConst = keysConst && std::is_const_v<std::remove_reference_t<decltype(key)>>;
+		value = 0;
+	});
+	long long cleared = 0;
+	const size_t changed = timeline.ForEachInRange(250000, 253000, [&cleared](long long, int value) { cleared += value; });
+	os << "range values changed in place: " << (changed == 3 && cleared == 0 ? "yes" : "no") << ", keys passed const: " << (keysConst ? "yes" : "no") << std::endl;
+
+	// bulk loaded trees must still rebalance like grown ones
+	for (long long t = 0; t < 1000000; t += 2000)
+		timeline.Erase(t);
+	for (long long t = 500; t < 100000; t += 1000)
+		timeline.Insert(t, 1);
+	size_t count = 0;
+	long long previous = -1;
+	bool ordered = true;
+	for (auto [key, value] : timeline) {
+		ordered &= previous < key;
+		previous = key;
+		++count;
+	}
+	os << "after erasing evens and inserting between: " << timeline.Size() << " entries, iterated " << count << ", ordered: " << (ordered ? "yes" : "no") << std::endl;
+
+	ads::BTreeMap<long long, int, 64> copy = timeline;
+	ads::BTreeMap<long long, int, 64> moved = std::move(timeline);
+	os << "copy " << copy.Size() << ", moved " << moved.Size() << ", source " << timeline.Size() << ", copy 1500 = " << *copy.Get(1500) << std::endl;
+
+	// values taken from the map itself, once shifted within a leaf and once split off into a new one
+	const std::string text(40, 'x');
+	ads::BTreeMap<int, std::string> roomy;
+	ads::BTreeMap<int, std::string, 64> tight;
+	for (int k = 0; k <= 8; k += 2) {
+		roomy.Insert(k, text);
+		if (k < 8)
+			tight.Insert(k, text);
+	}
+	roomy.Insert(7, roomy.Find(8).Value());
+	tight.Insert(5, tight.Find(6).Value());
+	os << "own value inserted by shifting: " << (*roomy.Get(7) == text ? "yes" : "no")
+		<< ", by splitting: " << (*tight.Get(5) == text && *tight.Get(6) == text ? "yes" : "no") << std::endl;
+}
+
+#endif // TESTS_BTREE_MAP_TESTS_H
\ No newline at end of file
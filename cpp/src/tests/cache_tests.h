@@ -0,0 +1,93 @@
+#ifndef TESTS_CACHE_TESTS_H
+#define TESTS_CACHE_TESTS_H
+
+#include "pch.h"
+#include "data_structures/lfu_cache.h"
+#include "data_structures/lru_cache.h"
+
+void TestLruCache(std::ostream& os) {
+	os << ":: TestLruCache ::\n";
+
+	ads::LruCache<int, std::string> cache(3);
+	cache.Put(1, "one");
+	cache.Put(2, "two");
+	cache.Put(3, "three");
+	os << "get 1: " << *cache.Get(1) << std::endl;
+
+	// 2 is now the least recently used
+	cache.Put(4, "four");
+	os << "2 evicted: " << (cache.Get(2) == nullptr ? "yes" : "no") << ", oldest is now " << cache.Oldest()->key << std::endl;
+
+	cache.Put(3, "THREE");
+	os << "recency order after updating 3:";
+	cache.ForEach([&os](int key, const std::string& value) { os << " " << key << "=" << value; });
+	os << std::endl;
+
+	cache.Erase(1);
+	const ads::CacheStats& stats = cache.Stats();
+	os << "size " << cache.Size() << ", hits " << stats.hits << ", misses " << stats.misses << ", evictions " << stats.evictions << std::endl;
+
+	// byte budget, the newest entry stays even when it alone is over budget
+	ads::LruCache<std::string, std::vector<char>> assets(SIZE_MAX, 1000);
+	for (int i = 0; i < 10; ++i)
+		assets.Put("asset" + std::to_string(i), std::vector<char>(300), 300);
+	os << "byte budget 1000 holds " << assets.Size() << " 300 byte assets, " << assets.Bytes() << " bytes, oldest " << assets.Oldest()->key << std::endl;
+	assets.Put("huge", std::vector<char>(5000), 5000);
+	os << "after a 5000 byte asset: " << assets.Size() << " entry, " << assets.Bytes() << " bytes" << std::endl;
+
+	// enough churn to rehash the index and shift probe runs on erase
+	ads::LruCache<int, int> big(1000);
+	for (int i = 0; i < 5000; ++i)
+		big.Put(i, i * 2);
+	int found = 0;
+	for (int i = 0; i < 5000; ++i)
+		found += big.Peek(i) != nullptr && *big.Peek(i) == i * 2;
+	os << "after 5000 puts into 1000 entries: " << found << " cached, oldest " << big.Oldest()->key << std::endl;
+}
+
+void TestLfuCache(std::ostream& os) {
+	os << ":: TestLfuCache ::\n";
+
+	ads::LfuCache<int, std::string> cache(3);
+	cache.Put(1, "one");
+	cache.Put(2, "two");
+	cache.Put(3, "three");
+	cache.Get(1);
+	cache.Get(1);
+	cache.Get(2);
+	os << "frequencies: 1=" << cache.Frequency(1) << " 2=" << cache.Frequency(2) << " 3=" << cache.Frequency(3) << std::endl;
+
+	cache.Put(4, "four");
+	os << "3 was the least frequently used, evicted: " << (cache.Contains(3) ? "no" : "yes") << std::endl;
+
+	// 4 has a single use, so it goes before 2 even though it is newer
+	cache.Put(5, "five");
+	os << "4 evicted before 2: " << (!cache.Contains(4) && cache.Contains(2) ? "yes" : "no") << std::endl;
+
+	// ties go to the least recently used
+	cache.Get(5);
+	os << "2 and 5 tie at " << cache.Frequency(2) << ", 2 is older so it goes: ";
+	cache.Put(6, "six");
+	cache.Put(7, "seven");
+	os << (cache.Contains(2) ? "no" : "yes") << std::endl;
+
+	cache.Put(1, "ONE");
+	os << "updating 1 counts as a use: " << cache.Frequency(1) << ", value " << *cache.Peek(1) << std::endl;
+
+	const ads::CacheStats& stats = cache.Stats();
+	os << "size " << cache.Size() << ", hits " << stats.hits << ", misses " << stats.misses << ", evictions " << stats.evictions << std::endl;
+
+	ads::LfuCache<int, int> big(256, 256 * 8);
+	for (int i = 0; i < 4096; ++i) {
+		big.Put(i % 512, i, 8);
+		big.Get(i % 7);
+	}
+	int hot = 0;
+	for (int i = 0; i < 7; ++i)
+		hot += big.Contains(i);
+	os << "after 4096 puts: size " << big.Size() << ", bytes " << big.Bytes() << ", hot keys still cached " << hot << "/7" << std::endl;
+	big.Clear();
+	os << "cleared size: " << big.Size() << std::endl;
+}
+
+#endif // TESTS_CACHE_TESTS_H
\ No newline at end of file
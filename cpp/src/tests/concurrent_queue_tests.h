@@ -0,0 +1,74 @@
+#ifndef TESTS_CONCURRENT_QUEUE_TESTS_H
+#define TESTS_CONCURRENT_QUEUE_TESTS_H
+
+#include "pch.h"
+#include "data_structures/bounded_mpmc_queue.h"
+#include "data_structures/bounded_spsc_queue.h"
+#include "data_structures/concurrent_queue.h"
+
+// pushes 1..itemsPerProducer from every producer and checks the consumers saw every item exactly once by comparing sums
+template<class Queue, class PushFn>
+bool CheckConcurrentQueue(Queue& queue, PushFn push, unsigned producers, unsigned consumers, uint64_t itemsPerProducer) {
+	std::atomic<uint64_t> popped = 0;
+	std::atomic<uint64_t> sum = 0;
+	const uint64_t totalItems = producers * itemsPerProducer;
+	std::vector<std::thread> threads;
+
+	for (unsigned p = 0; p < producers; ++p) {
+		threads.emplace_back([&]() {
+			for (uint64_t i = 1; i <= itemsPerProducer; ++i) {
+				while (!push(queue, i))
+					std::this_thread::yield();
+			}
+		});
+	}
+	for (unsigned c = 0; c < consumers; ++c) {
+		threads.emplace_back([&]() {
+			uint64_t val;
+			uint64_t localSum = 0;
+			while (popped.load(std::memory_order_relaxed) < totalItems) {
+				if (queue.TryPop(val)) {
+					localSum += val;
+					popped.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+			sum.fetch_add(localSum);
+		});
+	}
+	for (std::thread& thread : threads)
+		thread.join();
+
+	uint64_t val;
+	return sum.load() == producers * itemsPerProducer * (itemsPerProducer + 1) / 2 && !queue.TryPop(val);
+}
+
+void TestConcurrentQueues(std::ostream& os) {
+	os << ":: TestConcurrentQueues ::\n";
+
+	auto pushAlways = [](auto& queue, uint64_t val) { queue.Push(val); return true; };
+	auto tryPush = [](auto& queue, uint64_t val) { return queue.TryPush(val); };
+
+	ads::ConcurrentQueue<std::string> stringQueue;
+	stringQueue.Push("first");
+	stringQueue.Emplace(3, 'x');
+	std::string out;
+	os << "single thread order:";
+	while (stringQueue.TryPop(out))
+		os << " " << out;
+	os << std::endl;
+
+	ads::MpscQueue<uint64_t> mpsc;
+	os << "MpscQueue 4 producers, 1 consumer: " << (CheckConcurrentQueue(mpsc, pushAlways, 4, 1, 100000) ? "ok" : "FAILED") << std::endl;
+
+	ads::ConcurrentQueue<uint64_t> mpmc;
+	os << "ConcurrentQueue 4 producers, 4 consumers: " << (CheckConcurrentQueue(mpmc, pushAlways, 4, 4, 100000) ? "ok" : "FAILED") << std::endl;
+
+	ads::BoundedMpmcQueue<uint64_t> ring(1000);
+	os << "BoundedMpmcQueue capacity: " << ring.Capacity() << std::endl;
+	os << "BoundedMpmcQueue 4 producers, 4 consumers: " << (CheckConcurrentQueue(ring, tryPush, 4, 4, 100000) ? "ok" : "FAILED") << std::endl;
+
+	ads::BoundedSpscQueue<uint64_t> spsc(1000);
+	os << "BoundedSpscQueue 1 producer, 1 consumer: " << (CheckConcurrentQueue(spsc, tryPush, 1, 1, 200000) ? "ok" : "FAILED") << std::endl;
+}
+
+#endif // TESTS_CONCURRENT_QUEUE_TESTS_H
\ No newline at end of file
@@ -0,0 +1,121 @@
+#ifndef TESTS_CONTAINER_STATS_TESTS_H
+#define TESTS_CONTAINER_STATS_TESTS_H
+
+#include "pch.h"
+#include "data_structures/bounded_mpmc_queue.h"
+#include "data_structures/btree_map.h"
+#include "data_structures/container_stats.h"
+#include "data_structures/doubly_linked_list.h"
+#include "data_structures/flat_hash_map.h"
+#include "data_structures/linked_list.h"
+#include "data_structures/ring_buffer.h"
+#include "data_structures/skip_list.h"
+
+void PrintContainerStats(std::ostream& os, const char* name, const ads::ContainerStats& stats) {
+	os << name << ": " << stats.allocations << " allocations, " << stats.frees << " frees, " << stats.liveBytes << " live bytes, "
+		<< stats.peakBytes << " peak bytes, " << stats.nodeVisits << " node visits" << std::endl;
+}
+
+void TestContainerSizes(std::ostream& os) {
+	os << ":: TestContainerSizes ::\n";
+
+	ads::LinkedList<int> list;
+	for (int i = 0; i < 10; ++i)
+		list.Append(i);
+	list.RemoveIf([](int val) { return val % 3 == 0; });
+	ads::LinkedList<int> moved(std::move(list));
+	os << "linked list after RemoveIf: " << moved.Size() << ", moved-from: " << list.Size() << std::endl;
+
+	ads::TrackedLinkedList<int> tracked;
+	tracked.InsertRange(std::vector<int>{ 1, 2, 3, 4 });
+	tracked.Advance(1);
+	tracked.EraseCurrent();
+	os << "tracked list after erasing at the cursor: " << tracked.Size() << std::endl;
+
+	// splicing between lists counts the range, within one list nothing changes
+	ads::DoublyLinkedList<int> a;
+	ads::DoublyLinkedList<int> b;
+	for (int i = 0; i < 6; ++i) {
+		a.Append(i);
+		b.Append(10 + i);
+	}
+	b.Splice(b.cbegin(), a, std::next(a.cbegin()), std::next(a.cbegin(), 4));
+	os << "after splicing 3 nodes: " << a.Size() << " and " << b.Size();
+	b.Splice(b.cend(), b, b.cbegin(), std::next(b.cbegin(), 2));
+	b.Splice(b.cend(), a);
+	os << ", after splicing the rest: " << a.Size() << " and " << b.Size() << std::endl;
+
+	ads::BoundedMpmcQueue<int> queue(8);
+	queue.TryPush(1);
+	queue.TryPush(2);
+	int out;
+	queue.TryPop(out);
+	os << "bounded queue: " << queue.Size() << std::endl;
+}
+
+void TestContainerStats(std::ostream& os) {
+	os << ":: TestContainerStats ::\n";
+
+	// the default policy adds no bytes, the ring buffer is still a pointer and three counters
+	os << "NoStats ring buffer is " << sizeof(ads::RingBuffer<int>) << " bytes, counting one is " << sizeof(ads::RingBuffer<int, std::allocator<int>, ads::CountingStats>)
+		<< " bytes" << std::endl;
+
+	ads::LinkedList<int, std::allocator<int>, ads::CountingStats> list;
+	for (int i = 0; i < 100; ++i)
+		list.Append(i);
+	list.RemoveIf([](int val) { return val % 2 == 0; });
+	const ads::ContainerStats listStats = list.Stats();
+	os << "linked list bytes match its nodes: " << (listStats.liveBytes == list.Size() * sizeof(ads::LinkedList<int>::Node<int>)
+		&& listStats.peakBytes == 2 * listStats.liveBytes ? "yes" : "no") << std::endl;
+	PrintContainerStats(os, "linked list, 100 appends then RemoveIf", listStats);
+
+	// live bytes travel with the nodes, the counters stay with the object that did the work
+	ads::LinkedList<int, std::allocator<int>, ads::CountingStats> moved(std::move(list));
+	os << "after a move the new list holds " << moved.Stats().liveBytes << " live bytes, the old one " << list.Stats().liveBytes << std::endl;
+
+	ads::DoublyLinkedList<int, ads::PoolAllocator<int>, ads::CountingStats> first;
+	ads::DoublyLinkedList<int, ads::PoolAllocator<int>, ads::CountingStats> second(first.GetAllocator());
+	for (int i = 0; i < 8; ++i)
+		first.Append(i);
+	second.Splice(second.cend(), first, first.cbegin(), std::next(first.cbegin(), 3));
+	os << "splicing 3 of 8 nodes moves " << second.Stats().liveBytes * 8 / (first.Stats().liveBytes + second.Stats().liveBytes) << "/8 of the live bytes" << std::endl;
+
+	ads::BTreeMap<int, int, 256, ads::CountingStats> tree;
+	for (int i = 0; i < 10000; ++i)
+		tree.Insert(i, i);
+	tree.ResetStats();
+	size_t found = 0;
+	for (int i = 0; i < 1000; ++i)
+		found += tree.Contains(i * 7);
+	os << "btree lookups visit one node per level: " << (tree.Stats().nodeVisits == 1000 * tree.Height() && found == 1000 ? "yes" : "no")
+		<< ", nothing allocated since the reset: " << (tree.Stats().allocations == 0 ? "yes" : "no") << std::endl;
+
+	ads::FlatHashMap<int, int, std::hash<int>, std::equal_to<int>, std::allocator<std::pair<const int, int>>, ads::CountingStats> map;
+	map.Reserve(1000);
+	map.ResetStats();
+	for (int i = 0; i < 1000; ++i)
+		map.TryEmplace(i, i);
+	const uint64_t growths = map.Stats().allocations;
+	map.ResetStats();
+	for (int i = 0; i < 1000; ++i)
+		map.Contains(i);
+	const ads::ContainerStats mapStats = map.Stats();
+	os << "hash map reserved up front grew " << growths << " times while inserting, lookups probed "
+		<< std::fixed << std::setprecision(2) << mapStats.nodeVisits / 1000.0 << std::defaultfloat << " groups on average" << std::endl;
+
+	ads::RingBuffer<int, std::allocator<int>, ads::CountingStats> ring;
+	for (int i = 0; i < 100; ++i)
+		ring.PushBack(i);
+	PrintContainerStats(os, "ring buffer, 100 pushes", ring.Stats());
+
+	ads::SkipList<int, int, std::less<int>, false, ads::CountingStats> skipList;
+	for (int i = 0; i < 1000; ++i)
+		skipList.Insert(i, i);
+	for (int i = 0; i < 1000; i += 2)
+		skipList.Erase(i);
+	os << "skip list frees match erases: " << (skipList.Stats().frees == 500 && skipList.Stats().allocations == 1000 ? "yes" : "no") << std::endl;
+	skipList.Clear();
+	os << "cleared skip list holds " << skipList.Stats().liveBytes << " bytes" << std::endl;
+}
+
+#endif // TESTS_CONTAINER_STATS_TESTS_H
\ No newline at end of file
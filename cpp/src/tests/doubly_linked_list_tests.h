@@ -37,4 +37,133 @@ void TestDoublyLinkedList_Int(std::ostream& os) {
 	}
 }
 
+void TestDoublyLinkedList_Iterators(std::ostream& os) {
+	static_assert(std::bidirectional_iterator<ads::DoublyLinkedList<int>::iterator>);
+	static_assert(std::bidirectional_iterator<ads::DoublyLinkedList<int>::const_iterator>);
+
+	os << ":: TestDoublyLinkedList_Iterators ::\n";
+
+	ads::DoublyLinkedList<int> dll;
+	for (int i = 1; i <= 5; ++i)
+		dll.Append(i);
+
+	os << "list values from end -> head:\n";
+	for (auto it = dll.rbegin(); it != dll.rend(); ++it)
+		os << *it << std::endl;
+
+	auto last = std::prev(dll.end());
+	os << "std::prev(end()): " << *last << std::endl;
+
+	std::for_each(dll.begin(), dll.end(), [](int& val) { val += 10; });
+	os << "sum after adding 10 to each: " << std::accumulate(dll.cbegin(), dll.cend(), 0) << std::endl;
+}
+
+void TestDoublyLinkedList_Emplace(std::ostream& os) {
+	os << ":: TestDoublyLinkedList_Emplace ::\n";
+
+	ads::DoublyLinkedList<std::string> dll;
+	dll.EmplaceBack("b");
+	dll.EmplaceFront("a");
+	dll.EmplaceAfter(dll.begin(), 2, 'x');
+	dll.Append(std::string("c"));
+
+	ads::DoublyLinkedList<std::string> moved(std::move(dll));
+	os << "list values from end -> head:\n";
+	for (auto it = moved.rbegin(); it != moved.rend(); ++it)
+		os << *it << std::endl;
+	os << "moved-from list is empty: " << (dll.Head() == nullptr && dll.Tail() == nullptr ? "yes" : "no") << std::endl;
+}
+
+void TestDoublyLinkedList_SpliceMergeSort(std::ostream& os) {
+	typedef ads::DoublyLinkedList<std::pair<int, char>> pList;
+
+	os << ":: TestDoublyLinkedList_SpliceMergeSort ::\n";
+
+	auto print = [&os](const char* label, const pList& list) {
+		os << label;
+		for (const auto& val : list)
+			os << " " << val.first << val.second;
+		os << std::endl;
+	};
+	auto byKey = [](const std::pair<int, char>& a, const std::pair<int, char>& b) { return a.first < b.first; };
+
+	pList a;
+	char letter = 'a';
+	for (int key : { 5, 1, 4, 1, 3, 5, 2 })
+		a.EmplaceBack(key, letter++);
+	pList copy(a);
+	a.Sort(byKey);
+	print("sorted a (stable, equal keys keep insertion order):", a);
+	print("copy is untouched:", copy);
+
+	// b shares a's pool, so merging and splicing between them relink the nodes instead of moving the values
+	pList b(a.GetAllocator());
+	for (int key : { 0, 1, 6 })
+		b.EmplaceBack(key, letter++);
+	std::vector<const std::pair<int, char>*> addresses;
+	for (const auto& val : b)
+		addresses.push_back(&val);
+	a.Merge(b, byKey);
+	print("a merged with b:", a);
+	bool relinked = true;
+	for (const auto* address : addresses)
+		relinked = relinked && std::any_of(a.begin(), a.end(), [address](const auto& val) { return &val == address; });
+	os << "b is empty: " << (b.Head() == nullptr ? "yes" : "no") << ", merged nodes kept their addresses: " << (relinked ? "yes" : "no") << std::endl;
+
+	const std::pair<int, char>* spliced = &a.Tail()->value;
+	b.Splice(b.cend(), a, std::prev(a.cend()));
+	os << "spliced node kept its address: " << (&b.Head()->value == spliced ? "yes" : "no") << std::endl;
+	a.Splice(a.cend(), b);
+
+	// move the three middle nodes of copy to the front of b, copy has its own pool so the values are moved instead
+	auto first = std::next(copy.cbegin(), 2);
+	auto last = std::next(first, 3);
+	b.Splice(b.cbegin(), copy, first, last);
+	print("b after splice:", b);
+	print("copy after splice:", copy);
+
+	b.Splice(b.cend(), copy);
+	print("b after splicing the rest of copy:", b);
+	os << "b tail: " << b.Tail()->value.first << ", copy is empty: " << (copy.Head() == nullptr && copy.Tail() == nullptr ? "yes" : "no") << std::endl;
+
+	// splicing a node or range in front of itself leaves the list as it was, like std::list::splice
+	auto second = std::next(b.cbegin());
+	b.Splice(second, b, second);
+	b.Splice(b.cbegin(), b, b.cbegin(), std::next(b.cbegin(), 2));
+	print("b after splicing in place:", b);
+	os << "size " << b.Size() << ", counted " << std::distance(b.begin(), b.end()) << std::endl;
+}
+
+void TestDoublyLinkedList_RemoveIf(std::ostream& os) {
+	os << ":: TestDoublyLinkedList_RemoveIf ::\n";
+
+	ads::DoublyLinkedList<int> dll;
+	for (int val : { 2, 2, 1, 2, 3, 2, 2 })
+		dll.Append(val);
+
+	os << "leading, middle and trailing 2s removed: " << dll.RemoveAll(2) << std::endl;
+	os << "list values from end -> head:\n";
+	for (auto it = dll.rbegin(); it != dll.rend(); ++it)
+		os << *it << std::endl;
+
+	os << "removing every node empties the list: " << dll.RemoveIf([](int) { return true; }) << " removed, "
+		<< (dll.Head() == nullptr && dll.Tail() == nullptr ? "empty" : "not empty") << std::endl;
+
+	for (int i = 0; i < 10; ++i)
+		dll.Append(i);
+	os << "odd values removed: " << dll.RemoveIf([](int val) { return val % 2 != 0; }) << std::endl;
+
+	// erase 2, 4, 6 in one unlink
+	auto first = std::next(dll.begin());
+	auto last = std::next(first, 3);
+	auto next = dll.EraseRange(first, last);
+	os << "after erasing [2, 8): next is " << *next << ", list:";
+	for (int val : dll)
+		os << " " << val;
+	os << std::endl;
+
+	dll.EraseRange(std::next(dll.begin()), dll.end());
+	os << "erase to end, tail is " << dll.Tail()->value << ", head->next is " << (dll.Head()->next == nullptr ? "null" : "not null") << std::endl;
+}
+
 #endif // TESTS_DOUBLY_LINKED_LIST_TESTS_H
\ No newline at end of file
@@ -0,0 +1,122 @@
+#ifndef TESTS_FLAT_HASH_MAP_TESTS_H
+#define TESTS_FLAT_HASH_MAP_TESTS_H
+
+#include "pch.h"
+#include "data_structures/flat_hash_map.h"
+
+/* transparent string hash so lookups can take a std::string_view without building a std::string */
+struct StringViewHash {
+	using is_transparent = void;
+
+	size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+};
+
+/* every default constructed hasher gets its own seed, like a per instance randomised hash, copies keep it */
+struct SeededHash {
+	SeededHash() : seed(NextSeed()) {}
+
+	size_t operator()(int key) const { return static_cast<size_t>((static_cast<uint64_t>(key) ^ seed) * 0x9E3779B97F4A7C15ull); }
+
+	static uint64_t NextSeed() {
+		static uint64_t counter = 0;
+		return ++counter * 0x2545F4914F6CDD1Dull;
+	}
+
+	uint64_t seed;
+};
+
+void TestFlatHashMap(std::ostream& os) {
+	os << ":: TestFlatHashMap ::\n";
+
+	ads::FlatHashMap<std::string, int, StringViewHash, std::equal_to<>> words;
+	words["one"] = 1;
+	words.TryEmplace("two", 2);
+	words.Insert({ "three", 3 });
+	os << "inserted again: " << (words.TryEmplace("two", 22).second ? "yes" : "no") << ", two = " << *words.Get("two") << std::endl;
+	words.InsertOrAssign("two", 22);
+	const std::string_view key = "three";
+	os << "two after assign = " << words["two"] << ", string_view lookup three = " << words.Find(key)->second
+		<< ", contains four: " << (words.Contains(std::string_view("four")) ? "yes" : "no") << std::endl;
+
+	// enough values to grow the table several times, then erase every other one leaving tombstones behind
+	ads::FlatHashMap<int, int> numbers;
+	for (int i = 0; i < 10000; ++i)
+		numbers[i] = i * 3;
+	size_t erased = 0;
+	for (int i = 0; i < 10000; i += 2)
+		erased += numbers.Erase(i);
+	int found = 0;
+	int wrong = 0;
+	for (int i = 0; i < 10000; ++i) {
+		const int* value = numbers.Get(i);
+		found += value != nullptr;
+		wrong += value != nullptr && (i % 2 == 0 || *value != i * 3);
+	}
+	os << "erased " << erased << ", size " << numbers.Size() << ", found " << found << ", wrong " << wrong << std::endl;
+
+	// churn through the tombstones, the table should rehash in place rather than keep growing
+	const size_t capacity = numbers.Capacity();
+	for (int round = 0; round < 20; ++round) {
+		for (int i = 0; i < 1000; ++i)
+			numbers[20000 + i] = i;
+		for (int i = 0; i < 1000; ++i)
+			numbers.Erase(20000 + i);
+	}
+	os << "after churn size " << numbers.Size() << ", capacity unchanged: " << (numbers.Capacity() == capacity ? "yes" : "no") << std::endl;
+
+	long long sum = 0;
+	size_t visited = 0;
+	for (const auto& [k, v] : numbers) {
+		sum += v;
+		++visited;
+	}
+	os << "iteration visited " << visited << ", value sum " << sum << std::endl;
+
+	// erasing through an iterator keeps the others valid
+	for (auto it = numbers.begin(); it != numbers.end(); ++it) {
+		if (it->first % 3 == 0)
+			numbers.Erase(it);
+	}
+	os << "after erasing multiples of 3: " << numbers.Size() << std::endl;
+
+	ads::FlatHashMap<int, std::string> reserved;
+	reserved.Reserve(1000);
+	const size_t reservedCapacity = reserved.Capacity();
+	for (int i = 0; i < 1000; ++i)
+		reserved.TryEmplace(i, std::to_string(i));
+	os << "reserve 1000 held without growing: " << (reserved.Capacity() == reservedCapacity ? "yes" : "no") << ", 999 = " << *reserved.Get(999) << std::endl;
+
+	ads::FlatHashMap<int, std::string> copy = reserved;
+	ads::FlatHashMap<int, std::string> moved = std::move(reserved);
+	copy.Clear();
+	os << "copy cleared " << copy.Size() << ", moved " << moved.Size() << ", source after move " << reserved.Size() << ", 500 = " << *moved.Get(500) << std::endl;
+
+	// values taken from the table itself while inserting grows it
+	ads::FlatHashMap<int, std::string> own;
+	own.TryEmplace(0, "a value long enough to live on the heap");
+	size_t growths = 0;
+	for (int i = 1; i < 200; ++i) {
+		const size_t before = own.Capacity();
+		own.TryEmplace(i, own.Find(0)->second);
+		growths += own.Capacity() != before;
+	}
+	bool allCopied = true;
+	for (int i = 0; i < 200; ++i)
+		allCopied = allCopied && *own.Get(i) == *own.Get(0);
+	os << "own values inserted across " << growths << " growths: " << (allCopied ? "yes" : "no") << std::endl;
+
+	// assigned maps take the hasher their slots were placed with
+	ads::FlatHashMap<int, int, SeededHash> seeded;
+	for (int i = 0; i < 1000; ++i)
+		seeded[i] = i;
+	ads::FlatHashMap<int, int, SeededHash> copyAssigned;
+	ads::FlatHashMap<int, int, SeededHash> moveAssigned;
+	copyAssigned = seeded;
+	moveAssigned = std::move(seeded);
+	int missing = 0;
+	for (int i = 0; i < 1000; ++i)
+		missing += !copyAssigned.Contains(i) + !moveAssigned.Contains(i);
+	os << "seeded hash maps found every key after copy and move assignment: " << (missing == 0 ? "yes" : "no") << std::endl;
+}
+
+#endif // TESTS_FLAT_HASH_MAP_TESTS_H
\ No newline at end of file
@@ -0,0 +1,263 @@
+#ifndef TESTS_GRAPH_TESTS_H
+#define TESTS_GRAPH_TESTS_H
+
+#include "pch.h"
+#include "algorithms/graph/bfs.h"
+#include "algorithms/graph/connected_components.h"
+#include "algorithms/graph/csr_builder.h"
+#include "algorithms/graph/graph_generators.h"
+#include "algorithms/graph/page_rank.h"
+#include "algorithms/thread_pool.h"
+#include "data_structures/csr_graph.h"
+
+template<class Weight>
+void PrintOutNeighbors(std::ostream& os, const ads::CsrGraph<Weight>& graph) {
+	for (uint32_t v = 0; v < graph.VertexCount(); ++v) {
+		os << " " << v << ":{";
+		const std::span<const uint32_t> neighbours = graph.OutNeighbors(v);
+		for (size_t i = 0; i < neighbours.size(); ++i)
+			os << (i != 0 ? " " : "") << neighbours[i];
+		os << "}";
+	}
+}
+
+// plain queue BFS depths to check the parallel one against
+template<class Weight>
+std::vector<uint32_t> ReferenceBfsDepths(const ads::CsrGraph<Weight>& graph, uint32_t source) {
+	std::vector<uint32_t> depths(graph.VertexCount(), ads::CsrGraph<Weight>::noVertex);
+	std::queue<uint32_t> queue;
+	depths[source] = 0;
+	queue.push(source);
+	while (!queue.empty()) {
+		const uint32_t u = queue.front();
+		queue.pop();
+		for (uint32_t v : graph.OutNeighbors(u)) {
+			if (depths[v] == ads::CsrGraph<Weight>::noVertex) {
+				depths[v] = depths[u] + 1;
+				queue.push(v);
+			}
+		}
+	}
+	return depths;
+}
+
+// depths match the reference and every parent is one level up and really has an edge to its child
+template<class Weight>
+bool CheckBfs(const ads::CsrGraph<Weight>& graph, uint32_t source, const ads::BfsResult& result) {
+	if (result.depths != ReferenceBfsDepths(graph, source))
+		return false;
+	for (uint32_t v = 0; v < graph.VertexCount(); ++v) {
+		const uint32_t parent = result.parents[v];
+		if (v == source || parent == ads::CsrGraph<Weight>::noVertex) {
+			if (parent != (v == source ? source : ads::CsrGraph<Weight>::noVertex))
+				return false;
+			continue;
+		}
+		const std::span<const uint32_t> neighbours = graph.OutNeighbors(parent);
+		if (result.depths[parent] + 1 != result.depths[v] || !std::binary_search(neighbours.begin(), neighbours.end(), v))
+			return false;
+	}
+	return true;
+}
+
+void TestCsrGraph(std::ostream& os) {
+	os << ":: TestCsrGraph ::\n";
+
+	ads::ThreadPool pool(4);
+	// a duplicate edge and a self loop
+	const std::vector<ads::CsrEdge<>> edges = { { 0, 1, {} }, { 0, 2, {} }, { 2, 0, {} }, { 1, 3, {} }, { 0, 1, {} }, { 3, 3, {} }, { 2, 3, {} } };
+	const ads::CsrGraph<> directed = ads::BuildCsrGraph(4, edges, pool, { .buildInEdges = true });
+	os << "directed: " << directed.VertexCount() << " vertices, " << directed.EdgeCount() << " edges, out";
+	PrintOutNeighbors(os, directed);
+	os << ", in of 3:";
+	for (uint32_t u : directed.InNeighbors(3))
+		os << " " << u;
+	os << std::endl;
+
+	const ads::CsrGraph<> undirected = ads::BuildCsrGraph(4, edges, pool, { .symmetrize = true });
+	os << "symmetrized: " << undirected.EdgeCount() << " edges,";
+	PrintOutNeighbors(os, undirected);
+	os << std::endl;
+
+	const std::vector<ads::CsrEdge<uint32_t>> weightedEdges = { { 0, 1, 7 }, { 0, 1, 3 }, { 1, 0, 5 }, { 0, 1, 9 } };
+	const ads::CsrGraph<uint32_t> weighted = ads::BuildCsrGraph(2, weightedEdges, pool);
+	os << "weighted duplicates keep the lightest: " << weighted.OutWeights(0)[0] << std::endl;
+
+	// the layout is the same whatever the thread count
+	bool sameLayout = true;
+	for (unsigned threads : { 1u, 3u }) {
+		ads::ThreadPool other(threads);
+		const std::vector<ads::CsrEdge<>> random = ads::GraphGenerator::Uniform(5000, 40000, 11, other);
+		const ads::CsrGraph<> a = ads::BuildCsrGraph(5000, random, other, { .buildInEdges = true });
+		const ads::CsrGraph<> b = ads::BuildCsrGraph(5000, random, pool, { .buildInEdges = true });
+		sameLayout = sameLayout && std::ranges::equal(a.Offsets(), b.Offsets()) && std::ranges::equal(a.Targets(), b.Targets());
+	}
+	os << "same layout on 1, 3 and 4 threads: " << (sameLayout ? "yes" : "no") << std::endl;
+
+	std::vector<uint32_t> hits(100000, 0);
+	ads::ParallelFor(pool, 0, hits.size(), 1000, [&hits](size_t first, size_t last) {
+		for (size_t i = first; i < last; ++i)
+			++hits[i];
+	});
+	os << "parallel for visits every index once: " << (std::ranges::all_of(hits, [](uint32_t n) { return n == 1; }) ? "yes" : "no") << std::endl;
+}
+
+void TestGraphGenerators(std::ostream& os) {
+	os << ":: TestGraphGenerators ::\n";
+
+	ads::ThreadPool single(1);
+	ads::ThreadPool pool(4);
+	const std::vector<ads::CsrEdge<>> rmat = ads::GraphGenerator::Rmat(12, 8, 5, pool);
+	const std::vector<ads::CsrEdge<>> rmatSingle = ads::GraphGenerator::Rmat(12, 8, 5, single);
+	const auto sameEdges = [](const std::vector<ads::CsrEdge<>>& a, const std::vector<ads::CsrEdge<>>& b) {
+		return std::ranges::equal(a, b, [](const auto& x, const auto& y) { return x.source == y.source && x.target == y.target; });
+	};
+	os << "rmat edges: " << rmat.size() << ", same on 1 and 4 threads: " << (sameEdges(rmat, rmatSingle) ? "yes" : "no") << std::endl;
+
+	// the a quadrant piles edges onto low ids, Kronecker relabelling spreads them out
+	const ads::CsrGraph<> rmatGraph = ads::BuildCsrGraph(1u << 12, rmat, pool, { .symmetrize = true });
+	size_t maxDegree = 0;
+	for (uint32_t v = 0; v < rmatGraph.VertexCount(); ++v)
+		maxDegree = std::max(maxDegree, rmatGraph.OutDegree(v));
+	os << "rmat degrees are skewed: " << (maxDegree > 20 * rmatGraph.EdgeCount() / rmatGraph.VertexCount() ? "yes" : "no")
+		<< ", vertex 0 is the hub: " << (rmatGraph.OutDegree(0) == maxDegree ? "yes" : "no") << std::endl;
+
+	const std::vector<ads::CsrEdge<>> kronecker = ads::GraphGenerator::Kronecker(12, 8, 5, pool);
+	const ads::CsrGraph<> kroneckerGraph = ads::BuildCsrGraph(1u << 12, kronecker, pool, { .symmetrize = true });
+	size_t kroneckerMax = 0;
+	for (uint32_t v = 0; v < kroneckerGraph.VertexCount(); ++v)
+		kroneckerMax = std::max(kroneckerMax, kroneckerGraph.OutDegree(v));
+	os << "kronecker keeps the degree skew: " << (kroneckerMax == maxDegree ? "yes" : "no")
+		<< ", same on 1 and 4 threads: " << (sameEdges(kronecker, ads::GraphGenerator::Kronecker(12, 8, 5, single)) ? "yes" : "no") << std::endl;
+
+	const std::vector<ads::CsrEdge<>> uniform = ads::GraphGenerator::Uniform(1000, 50000, 3, pool);
+	os << "uniform endpoints in range: " << (std::ranges::all_of(uniform, [](const auto& e) { return e.source < 1000 && e.target < 1000; }) ? "yes" : "no") << std::endl;
+}
+
+void TestBreadthFirstSearch(std::ostream& os) {
+	os << ":: TestBreadthFirstSearch ::\n";
+
+	ads::ThreadPool pool(4);
+	// path 0-1-2-3 plus a shortcut 0-2, vertex 4 unreachable
+	const std::vector<ads::CsrEdge<>> small = { { 0, 1, {} }, { 1, 2, {} }, { 2, 3, {} }, { 0, 2, {} } };
+	const ads::CsrGraph<> path = ads::BuildCsrGraph(5, small, pool, { .symmetrize = true });
+	const ads::BfsResult fromZero = ads::BreadthFirstSearch(path, 0, pool);
+	os << "depths from 0:";
+	for (uint32_t depth : fromZero.depths)
+		os << " " << (depth == ads::CsrGraph<>::noVertex ? std::string("-") : std::to_string(depth));
+	os << ", levels " << fromZero.levels << std::endl;
+
+	const std::vector<ads::CsrEdge<>> kronecker = ads::GraphGenerator::Kronecker(14, 16, 9, pool);
+	const ads::CsrGraph<> undirected = ads::BuildCsrGraph(1u << 14, kronecker, pool, { .symmetrize = true });
+	const ads::CsrGraph<> directed = ads::BuildCsrGraph(1u << 14, kronecker, pool, { .buildInEdges = true });
+	const uint32_t source = kronecker.front().source;
+	for (unsigned threads : { 1u, 4u }) {
+		ads::ThreadPool other(threads);
+		const ads::BfsResult symmetric = ads::BreadthFirstSearch(undirected, source, other);
+		const ads::BfsResult withInEdges = ads::BreadthFirstSearch(directed, source, other);
+		const ads::BfsResult topDown = ads::BreadthFirstSearch(undirected, source, other, { .directionOptimizing = false });
+		os << threads << " thread(s), undirected matches a queue BFS: " << (CheckBfs(undirected, source, symmetric) ? "yes" : "no")
+			<< ", went bottom-up: " << (symmetric.bottomUpSteps > 0 ? "yes" : "no")
+			<< ", directed: " << (CheckBfs(directed, source, withInEdges) ? "yes" : "no")
+			<< ", top-down only: " << (CheckBfs(undirected, source, topDown) && topDown.bottomUpSteps == 0 ? "yes" : "no") << std::endl;
+	}
+}
+
+void TestConnectedComponents(std::ostream& os) {
+	os << ":: TestConnectedComponents ::\n";
+
+	ads::ThreadPool pool(4);
+	// {0, 1, 2} {3, 4} {5}, the 4 -> 3 edge only points at the smaller id in the directed graph
+	const std::vector<ads::CsrEdge<>> small = { { 1, 0, {} }, { 2, 1, {} }, { 4, 3, {} } };
+	const std::vector<uint32_t> labels = ads::ConnectedComponentLabels(ads::BuildCsrGraph(6, small, pool, { .symmetrize = true }), pool);
+	os << "labels:";
+	for (uint32_t label : labels)
+		os << " " << label;
+	os << ", components: " << ads::ConnectedComponents<ads::Unweighted>::CountComponents(labels) << std::endl;
+
+	// sparse uniform graphs fall apart into many pieces, a serial union-find with min roots gives the same labels
+	const uint32_t vertexCount = 20000;
+	const std::vector<ads::CsrEdge<>> edges = ads::GraphGenerator::Uniform(vertexCount, 11000, 4, pool);
+	std::vector<uint32_t> roots(vertexCount);
+	std::iota(roots.begin(), roots.end(), 0u);
+	const auto find = [&roots](uint32_t v) {
+		while (roots[v] != v)
+			v = roots[v] = roots[roots[v]];
+		return v;
+	};
+	for (const ads::CsrEdge<>& edge : edges) {
+		const uint32_t a = find(edge.source);
+		const uint32_t b = find(edge.target);
+		roots[std::max(a, b)] = std::min(a, b);
+	}
+	std::vector<uint32_t> expected(vertexCount);
+	for (uint32_t v = 0; v < vertexCount; ++v)
+		expected[v] = find(v);
+
+	const ads::CsrGraph<> undirected = ads::BuildCsrGraph(vertexCount, edges, pool, { .symmetrize = true });
+	const ads::CsrGraph<> withInEdges = ads::BuildCsrGraph(vertexCount, edges, pool, { .buildInEdges = true });
+	const ads::CsrGraph<> outOnly = ads::BuildCsrGraph(vertexCount, edges, pool);
+	os << "undirected matches union-find: " << (ads::ConnectedComponentLabels(undirected, pool) == expected ? "yes" : "no")
+		<< ", directed with in edges: " << (ads::ConnectedComponentLabels(withInEdges, pool) == expected ? "yes" : "no")
+		<< ", out edges only: " << (ads::ConnectedComponentLabels(outOnly, pool) == expected ? "yes" : "no") << std::endl;
+
+	// one giant component, which the last pass skips
+	const std::vector<ads::CsrEdge<>> dense = ads::GraphGenerator::Kronecker(13, 8, 2, pool);
+	const ads::CsrGraph<> kronecker = ads::BuildCsrGraph(1u << 13, dense, pool, { .symmetrize = true });
+	const std::vector<uint32_t> kroneckerLabels = ads::ConnectedComponentLabels(kronecker, pool);
+	bool consistent = true;
+	for (uint32_t u = 0; u < kronecker.VertexCount(); ++u) {
+		for (uint32_t v : kronecker.OutNeighbors(u))
+			consistent = consistent && kroneckerLabels[u] == kroneckerLabels[v];
+		consistent = consistent && kroneckerLabels[kroneckerLabels[u]] == kroneckerLabels[u] && kroneckerLabels[u] <= u;
+	}
+	os << "kronecker labels agree across every edge: " << (consistent ? "yes" : "no") << std::endl;
+}
+
+void TestPageRank(std::ostream& os) {
+	os << ":: TestPageRank ::\n";
+
+	ads::ThreadPool pool(4);
+	// a symmetric star, the centre gets the biggest share
+	const std::vector<ads::CsrEdge<>> star = { { 0, 1, {} }, { 0, 2, {} }, { 0, 3, {} }, { 0, 4, {} } };
+	const ads::PageRankResult starRanks = ads::ComputePageRank(ads::BuildCsrGraph(5, star, pool, { .symmetrize = true }), pool);
+	os << std::fixed << std::setprecision(4) << "star:";
+	for (double rank : starRanks.ranks)
+		os << " " << rank;
+	os << std::defaultfloat << std::endl;
+
+	// directed with dangling vertices, checked against a serial power iteration
+	const std::vector<ads::CsrEdge<>> edges = ads::GraphGenerator::Rmat(11, 4, 8, pool);
+	const ads::CsrGraph<> graph = ads::BuildCsrGraph(1u << 11, edges, pool, { .buildInEdges = true });
+	const ads::PageRankResult result = ads::ComputePageRank(graph, pool, { .tolerance = 1e-10 });
+	const size_t n = graph.VertexCount();
+	std::vector<double> expected(n, 1.0 / static_cast<double>(n));
+	for (unsigned iteration = 0; iteration < result.iterations; ++iteration) {
+		double dangling = 0.0;
+		std::vector<double> next(n, 0.0);
+		for (uint32_t u = 0; u < n; ++u) {
+			if (graph.OutDegree(u) == 0)
+				dangling += expected[u];
+			for (uint32_t v : graph.OutNeighbors(u))
+				next[v] += 0.85 * expected[u] / static_cast<double>(graph.OutDegree(u));
+		}
+		for (double& rank : next)
+			rank += (0.15 + 0.85 * dangling) / static_cast<double>(n);
+		expected.swap(next);
+	}
+	double difference = 0.0;
+	for (size_t v = 0; v < n; ++v)
+		difference = std::max(difference, std::abs(expected[v] - result.ranks[v]));
+	os << "converged: " << (result.error < 1e-10 ? "yes" : "no") << ", matches serial power iteration: " << (difference < 1e-12 ? "yes" : "no")
+		<< ", sums to 1: " << (std::abs(std::accumulate(result.ranks.begin(), result.ranks.end(), 0.0) - 1.0) < 1e-9 ? "yes" : "no") << std::endl;
+
+	bool thrown = false;
+	try {
+		ads::ComputePageRank(ads::BuildCsrGraph(5, star, pool), pool);
+	} catch (const std::invalid_argument&) {
+		thrown = true;
+	}
+	os << "needs in edges: " << (thrown ? "yes" : "no") << std::endl;
+}
+
+#endif // TESTS_GRAPH_TESTS_H
\ No newline at end of file
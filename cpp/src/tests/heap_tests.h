@@ -0,0 +1,124 @@
+#ifndef TESTS_HEAP_TESTS_H
+#define TESTS_HEAP_TESTS_H
+
+#include "pch.h"
+#include "data_structures/dary_heap.h"
+#include "data_structures/radix_heap.h"
+
+// pops every value and checks they come out in the order std::priority_queue would give
+template<size_t D>
+bool CheckDaryHeapOrder(const std::vector<int>& values) {
+	ads::DaryHeap<int, D> heap;
+	std::priority_queue<int> reference;
+	for (int val : values) {
+		heap.Push(val);
+		reference.push(val);
+	}
+	while (!reference.empty()) {
+		if (heap.IsEmpty() || heap.PopTop() != reference.top())
+			return false;
+		reference.pop();
+	}
+	return heap.IsEmpty();
+}
+
+void TestDaryHeap(std::ostream& os) {
+	os << ":: TestDaryHeap ::\n";
+
+	std::mt19937 rng(3);
+	std::vector<int> values(5000);
+	for (int& val : values)
+		val = static_cast<int>(rng() % 1000);
+	os << "pop order matches std::priority_queue for D = 2, 3, 4, 8: " << (CheckDaryHeapOrder<2>(values) && CheckDaryHeapOrder<3>(values)
+		&& CheckDaryHeapOrder<4>(values) && CheckDaryHeapOrder<8>(values) ? "yes" : "no") << std::endl;
+
+	// min heap of strings built in one go, then the top replaced in place
+	const std::vector<std::string> words = { "pear", "fig", "apple", "kiwi", "date", "lime" };
+	ads::DaryHeap<std::string, 4, std::greater<std::string>> wordHeap(words.begin(), words.end());
+	wordHeap.ReplaceTop("melon");
+	os << "heapified words after replacing the top:";
+	while (!wordHeap.IsEmpty())
+		os << " " << wordHeap.PopTop();
+	os << std::endl;
+
+	// min heap on distances, the way Dijkstra drives it
+	ads::IndexedDaryHeap<int, 4, std::greater<int>> distances(10);
+	distances.Push(3, 30);
+	distances.Push(7, 70);
+	distances.Push(1, 10);
+	distances.Push(5, 50);
+	const bool lowered = distances.DecreaseKey(7, 5);
+	const bool ignored = !distances.DecreaseKey(5, 60);
+	distances.DecreaseKey(9, 40);
+	distances.Update(1, 100);
+	distances.Erase(3);
+	os << "decrease-key moved 7 to the top: " << (lowered && distances.Top() == 7 ? "yes" : "no") << ", worse key ignored: " << (ignored ? "yes" : "no")
+		<< ", contains 3: " << (distances.Contains(3) ? "yes" : "no") << ", pop order:";
+	while (!distances.IsEmpty()) {
+		const auto entry = distances.PopTop();
+		os << " " << entry.id << "(" << entry.priority << ")";
+	}
+	os << std::endl;
+
+	// random updates in both directions against a brute force minimum
+	ads::IndexedDaryHeap<int, 8, std::greater<int>> indexed(1000);
+	std::vector<int> current(1000, INT_MAX);
+	for (int i = 0; i < 20000; ++i) {
+		const uint32_t id = rng() % 1000;
+		const int priority = static_cast<int>(rng() % 100000);
+		if (indexed.Contains(id))
+			indexed.Update(id, priority);
+		else
+			indexed.Push(id, priority);
+		current[id] = priority;
+	}
+	bool sorted = true;
+	int previous = INT_MIN;
+	size_t popped = 0;
+	while (!indexed.IsEmpty()) {
+		const auto entry = indexed.PopTop();
+		sorted &= entry.priority >= previous && current[entry.id] == entry.priority;
+		previous = entry.priority;
+		++popped;
+	}
+	os << "random updates: popped " << popped << " ids in order with their latest priority: " << (sorted ? "yes" : "no") << std::endl;
+}
+
+void TestRadixHeap(std::ostream& os) {
+	os << ":: TestRadixHeap ::\n";
+
+	ads::RadixHeap<uint32_t, char> heap;
+	heap.Push(5, 'b');
+	heap.Push(2, 'a');
+	heap.Push(9, 'c');
+	os << "min key " << heap.MinKey() << ", pops:";
+	while (!heap.IsEmpty()) {
+		const auto [key, val] = heap.Pop();
+		os << " " << key << val;
+		// monotone pushes after a pop are allowed as long as they don't go below it
+		if (key == 5)
+			heap.Push(7, 'x');
+	}
+	os << std::endl;
+
+	// a Dijkstra shaped stream, every push is the popped key plus a non negative weight
+	ads::RadixHeap<uint64_t, uint32_t> stream;
+	std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>> reference;
+	std::mt19937_64 rng(11);
+	stream.Push(0, 0);
+	reference.push(0);
+	bool same = true;
+	for (int i = 0; i < 50000 && !reference.empty(); ++i) {
+		const uint64_t key = stream.Pop().first;
+		same &= key == reference.top();
+		reference.pop();
+		for (int j = 0; j < 2; ++j) {
+			const uint64_t next = key + rng() % (1ull << (rng() % 40));
+			stream.Push(next, 0);
+			reference.push(next);
+		}
+	}
+	os << "monotone stream matches std::priority_queue: " << (same ? "yes" : "no") << ", left " << stream.Size() << std::endl;
+}
+
+#endif // TESTS_HEAP_TESTS_H
\ No newline at end of file
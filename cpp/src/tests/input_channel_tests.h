@@ -0,0 +1,91 @@
+#ifndef TESTS_INPUT_CHANNEL_TESTS_H
+#define TESTS_INPUT_CHANNEL_TESTS_H
+
+#include "pch.h"
+#include "engine/input/input_channel.h"
+
+// spreads the two sides of the stress test over separate cores where there are some, so it really runs in parallel
+inline void PinThreadToCore([[maybe_unused]] std::thread& thread, [[maybe_unused]] unsigned core) {
+#if defined(__linux__)
+	const unsigned cores = std::thread::hardware_concurrency();
+	if (cores < 2)
+		return;
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(core % cores, &set);
+	pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#endif
+}
+
+void TestInputChannel(std::ostream& os) {
+	os << ":: TestInputChannel ::\n";
+
+	engine::InputChannel channel(8);
+	channel.Push(engine::KeyboardEvent(engine::KeyboardEvent::EventType::Down, 'W'));
+	channel.PushChar('w');
+	channel.Push(engine::MouseEvent(engine::MouseEvent::EventType::LeftDown, 10, 20));
+	channel.PushRawDelta({ -3, 4 });
+	int64_t previous = 0;
+	bool ordered = true;
+	os << "drained:";
+	channel.Dispatch([&](const engine::InputEvent& event) {
+		ordered &= event.GetTimestamp() >= previous;
+		previous = event.GetTimestamp();
+		switch (event.GetSource()) {
+		case engine::InputEvent::Source::Key:
+			os << " key " << event.GetKeyboardEvent().GetKey() << (event.GetKeyboardEvent().IsKeyDown() ? " down" : " up");
+			break;
+		case engine::InputEvent::Source::Char:
+			os << ", char " << event.GetChar();
+			break;
+		case engine::InputEvent::Source::Mouse:
+			os << ", mouse " << event.GetMouseEvent().GetX() << "," << event.GetMouseEvent().GetY();
+			break;
+		case engine::InputEvent::Source::RawDelta:
+			os << ", raw " << event.GetRawDelta().x << "," << event.GetRawDelta().y;
+			break;
+		}
+	});
+	os << ", timestamps ordered: " << (ordered ? "yes" : "no") << std::endl;
+
+	for (int i = 0; i < 10; ++i)
+		channel.PushChar(static_cast<unsigned char>('a' + i));
+	engine::InputEvent frame[16];
+	const size_t drained = channel.Drain(frame);
+	os << "10 pushes into 8 slots: drained " << drained << ", dropped " << channel.GetDroppedCount() << ", last " << frame[drained - 1].GetChar() << std::endl;
+
+	// the capture thread sends a sequence through the mouse coordinates, the update thread checks nothing was lost or reordered
+	constexpr int eventCount = 1000000;
+	engine::InputChannel stress(1024);
+	std::atomic<bool> orderOk = true;
+	std::thread consumer([&]() {
+		engine::InputEvent batch[256];
+		int expected = 0;
+		int64_t lastTimestamp = 0;
+		while (expected < eventCount) {
+			const size_t count = stress.Drain(batch);
+			for (size_t i = 0; i < count; ++i) {
+				if (batch[i].GetMouseEvent().GetX() != expected++ || batch[i].GetTimestamp() < lastTimestamp)
+					orderOk = false;
+				lastTimestamp = batch[i].GetTimestamp();
+			}
+			if (count == 0)
+				std::this_thread::yield();
+		}
+	});
+	std::thread producer([&]() {
+		for (int i = 0; i < eventCount; ++i) {
+			const engine::InputEvent event(engine::MouseEvent(engine::MouseEvent::EventType::Move, i, -i), engine::InputChannel::Now());
+			// the test wants every event, so wait for room instead of dropping
+			while (!stress.Push(event))
+				std::this_thread::yield();
+		}
+	});
+	PinThreadToCore(consumer, 0);
+	PinThreadToCore(producer, 1);
+	producer.join();
+	consumer.join();
+	os << "stress " << eventCount << " events across threads: " << (orderOk ? "ok" : "FAILED") << std::endl;
+}
+
+#endif // TESTS_INPUT_CHANNEL_TESTS_H
\ No newline at end of file
@@ -0,0 +1,60 @@
+#ifndef TESTS_INTRUSIVE_LIST_TESTS_H
+#define TESTS_INTRUSIVE_LIST_TESTS_H
+
+#include "pch.h"
+#include "data_structures/intrusive_list.h"
+
+struct Entity {
+	Entity(int id) : id(id) {}
+
+	int id;
+	ads::IntrusiveListHook activeHook;
+	ads::IntrusiveListHook renderHook;
+};
+
+void TestIntrusiveList(std::ostream& os) {
+	typedef ads::IntrusiveList<Entity, offsetof(Entity, activeHook)> ActiveList;
+	typedef ads::IntrusiveList<Entity, offsetof(Entity, renderHook)> RenderList;
+
+	os << ":: TestIntrusiveList ::\n";
+
+	std::vector<Entity> pool;
+	for (int i = 0; i < 5; ++i)
+		pool.emplace_back(i);
+
+	ActiveList active;
+	RenderList render;
+	for (Entity& e : pool)
+		active.Append(e);
+	render.Prepend(pool[1]);
+	render.Prepend(pool[3]);
+
+	os << "active list values:\n";
+	for (const Entity& e : active)
+		os << e.id << std::endl;
+
+	os << "remove entity 1 from the active list only\n";
+	ActiveList::Remove(pool[1]);
+	os << "active list values from end -> head:\n";
+	for (auto it = active.rbegin(); it != active.rend(); ++it)
+		os << it->id << std::endl;
+	os << "render list values:\n";
+	for (const Entity& e : render)
+		os << e.id << std::endl;
+
+	os << "destroy a temporary entity, it unlinks itself from both lists\n";
+	{
+		Entity temp(9);
+		active.Insert(ActiveList::IteratorTo(pool[4]), temp);
+		render.Append(temp);
+		os << "active size with temp: " << std::distance(active.begin(), active.end()) << std::endl;
+	}
+	os << "active size after temp is destroyed: " << std::distance(active.begin(), active.end()) << std::endl;
+
+	ActiveList moved(std::move(active));
+	os << "moved list front: " << moved.Front().id << ", back: " << moved.Back().id << ", moved-from is empty: " << (active.IsEmpty() ? "yes" : "no") << std::endl;
+	moved.Clear();
+	render.Clear();
+}
+
+#endif // TESTS_INTRUSIVE_LIST_TESTS_H
\ No newline at end of file
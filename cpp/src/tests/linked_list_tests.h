@@ -69,6 +69,104 @@ void TestLinkedList_Class(std::ostream& os) {
 	os << std::endl;
 }
 
+void TestLinkedList_AppendRange(std::ostream& os) {
+	typedef ads::LinkedList<int>::Node<int> iNode;
+
+	os << ":: TestLinkedList_AppendRange ::\n";
+
+	ads::LinkedList<int> linkedList;
+	linkedList.Append(2);
+	std::vector<int> batch = { 1, 2, 3, 2 };
+	linkedList.AppendRange(batch);
+	linkedList.Append(4);
+
+	os << "linked list values:\n";
+	iNode* pNode = linkedList.Head();
+	while (pNode != nullptr) {
+		os << pNode->value << std::endl;
+		pNode = pNode->next;
+	}
+
+	os << "remove all 2 nodes, then append 5\n";
+	linkedList.Remove(2);
+	linkedList.Append(5);
+	os << "tail value: " << linkedList.Tail()->value << std::endl;
+
+	os << "remove all 5 nodes, tail should move back\n";
+	linkedList.Remove(5);
+	os << "tail value: " << linkedList.Tail()->value << std::endl;
+	os << std::endl;
+}
+
+void TestLinkedList_Iterators(std::ostream& os) {
+	static_assert(std::forward_iterator<ads::LinkedList<int>::iterator>);
+	static_assert(std::forward_iterator<ads::LinkedList<int>::const_iterator>);
+	static_assert(std::forward_iterator<ads::TrackedLinkedList<int>::iterator>);
+
+	os << ":: TestLinkedList_Iterators ::\n";
+
+	ads::LinkedList<int> linkedList;
+	for (int i = 1; i <= 5; ++i)
+		linkedList.Append(i);
+
+	os << "range-for doubling values:\n";
+	for (int& val : linkedList)
+		val *= 2;
+	for (int val : linkedList)
+		os << val << std::endl;
+
+	const ads::LinkedList<int>& constList = linkedList;
+	auto it = std::find_if(constList.begin(), constList.end(), [](int val) { return val > 5; });
+	os << "first value > 5: " << *it << std::endl;
+	os << "count of values > 5: " << std::count_if(linkedList.cbegin(), linkedList.cend(), [](int val) { return val > 5; }) << std::endl;
+
+	ads::TrackedLinkedList<int> trackedList;
+	trackedList.Append(7);
+	trackedList.Append(8);
+	os << "tracked list sum: " << std::accumulate(trackedList.begin(), trackedList.end(), 0) << std::endl;
+	os << std::endl;
+}
+
+ads::LinkedList<std::string> MakeStringList() {
+	ads::LinkedList<std::string> linkedList;
+	linkedList.EmplaceBack(3, 'b');
+	linkedList.EmplaceFront("front");
+	linkedList.Append(std::string("moved"));
+	return linkedList;
+}
+
+void TestLinkedList_Move(std::ostream& os) {
+	os << ":: TestLinkedList_Move ::\n";
+
+	ads::LinkedList<std::string> linkedList = MakeStringList();
+	linkedList.EmplaceAfter(linkedList.begin(), "after front");
+
+	os << "linked list values:\n";
+	for (const std::string& val : linkedList)
+		os << val << std::endl;
+
+	ads::LinkedList<std::string> moved(std::move(linkedList));
+	os << "moved-from list is empty: " << (linkedList.Head() == nullptr ? "yes" : "no") << std::endl;
+	ads::LinkedList<std::string> copied(moved);
+	copied.Append("copy only");
+	os << "copy tail: " << copied.Tail()->value << ", original tail: " << moved.Tail()->value << std::endl;
+
+	ads::LinkedList<std::unique_ptr<int>> ptrList;
+	ptrList.EmplaceBack(std::make_unique<int>(42));
+	ptrList.Append(std::make_unique<int>(43));
+	os << "move-only values: " << *ptrList.Head()->value << ", " << *ptrList.Tail()->value << std::endl;
+
+	ads::TrackedLinkedList<std::string> trackedList;
+	trackedList.EmplaceBack("1");
+	trackedList.EmplaceBack("3");
+	trackedList.EmplaceAfterCurrent("2");
+	trackedList.EmplaceFront("0");
+	os << "tracked list values:\n";
+	for (const std::string& val : trackedList)
+		os << val << std::endl;
+	os << std::endl;
+}
+
 void TestTrackedLinkedList(std::ostream& os) {
 	os << ":: TestTrackedLinkedList ::\n";
 
@@ -89,4 +187,77 @@ void TestTrackedLinkedList(std::ostream& os) {
 	os << std::endl;
 }
 
+void TestTrackedLinkedList_Cursor(std::ostream& os) {
+	os << ":: TestTrackedLinkedList_Cursor ::\n";
+
+	auto print = [&os](const char* label, const ads::TrackedLinkedList<int>& list) {
+		os << label << ":";
+		for (int val : list)
+			os << " " << val;
+		os << ", end " << (list.End() != nullptr ? std::to_string(list.End()->value) : "null") << std::endl;
+	};
+
+	// inserting into an empty list sets the head, end and cursor
+	ads::TrackedLinkedList<int> list;
+	list.Insert(1);
+	list.Append(5);
+	print("insert into empty then append", list);
+
+	const std::vector<int> batch = { 2, 3, 4 };
+	os << "inserted after the cursor: " << list.InsertRange(batch) << std::endl;
+	print("after InsertRange", list);
+
+	// inserting after the end has to move the end
+	os << "advanced " << list.Advance(10) << " nodes, cursor valid: " << (list.IsCurrentValid() ? "yes" : "no") << std::endl;
+	list.Insert(6);
+	list.Append(7);
+	print("insert past the end then append", list);
+
+	list.Reset();
+	list.Advance(2);
+	const auto mark = list.Tell();
+	os << "remembered " << list.CurrentValue() << std::endl;
+
+	list.Reset();
+	os << "erase the head, new current: " << list.EraseCurrent()->value << std::endl;
+	list.Seek(mark);
+	while (list.IsCurrentValid() && list.CurrentValue() % 2 != 0)
+		list.EraseCurrent();
+	print("seek back and erase odd values from the mark", list);
+
+	list.Reset();
+	list.Advance(4);
+	os << "erase the last node, new current is null: " << (list.EraseCurrent() == nullptr ? "yes" : "no") << std::endl;
+	print("after erasing the end", list);
+
+	list.EmplaceFront(0);
+	list.Reset();
+	while (list.IsCurrentValid())
+		list.EraseCurrent();
+	os << "erased everything through the cursor, empty: " << (list.Head() == nullptr && list.End() == nullptr ? "yes" : "no") << std::endl;
+}
+
+void TestLinkedList_RemoveIf(std::ostream& os) {
+	os << ":: TestLinkedList_RemoveIf ::\n";
+
+	ads::LinkedList<int> linkedList;
+	for (int i = 0; i < 10; ++i)
+		linkedList.Append(i);
+
+	os << "values below 3 or above 7 removed: " << linkedList.RemoveIf([](int val) { return val < 3 || val > 7; }) << std::endl;
+	os << "head value: " << linkedList.Head()->value << ", tail value: " << linkedList.Tail()->value << std::endl;
+	os << "nothing equal to 42: " << linkedList.RemoveAll(42) << std::endl;
+
+	// drop 4, 5, 6 after the head
+	auto next = linkedList.EraseRangeAfter(linkedList.begin(), std::next(linkedList.begin(), 4));
+	os << "after erasing the 3 nodes after the head, next is " << *next << ", list:";
+	for (int val : linkedList)
+		os << " " << val;
+	os << std::endl;
+
+	linkedList.EraseRangeAfter(linkedList.begin(), linkedList.end());
+	linkedList.Append(8);
+	os << "erase to end then append 8, tail value: " << linkedList.Tail()->value << std::endl;
+}
+
 #endif // TESTS_LINKED_LIST_TESTS_H
\ No newline at end of file
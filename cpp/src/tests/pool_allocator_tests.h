@@ -0,0 +1,61 @@
+#ifndef TESTS_POOL_ALLOCATOR_TESTS_H
+#define TESTS_POOL_ALLOCATOR_TESTS_H
+
+#include "pch.h"
+#include "data_structures/pool_allocator.h"
+#include "data_structures/linked_list.h"
+#include "data_structures/doubly_linked_list.h"
+
+void TestPoolAllocator(std::ostream& os) {
+	os << ":: TestPoolAllocator ::\n";
+
+	ads::PoolAllocator<double> alloc;
+	double* a = alloc.allocate(1);
+	double* b = alloc.allocate(1);
+	os << "neighbouring blocks are adjacent: " << (b == a + 1 ? "yes" : "no") << std::endl;
+
+	alloc.deallocate(a, 1);
+	double* c = alloc.allocate(1);
+	os << "freed block is recycled: " << (c == a ? "yes" : "no") << std::endl;
+	alloc.deallocate(b, 1);
+	alloc.deallocate(c, 1);
+
+	ads::PoolAllocator<double> copy(alloc);
+	os << "copies share the pool: " << (copy == alloc ? "yes" : "no") << std::endl;
+	os << "slabs reserved: " << alloc.Pool()->SlabCount() << ", bytes: " << alloc.Pool()->BytesReserved() << std::endl;
+
+	const size_t slabs = alloc.Pool()->SlabCount();
+	alloc.Pool()->Reserve(1000);
+	std::vector<double*> blocks;
+	for (int i = 0; i < 1000; ++i)
+		blocks.push_back(alloc.allocate(1));
+	os << "1000 reserved blocks took " << alloc.Pool()->SlabCount() - slabs << " more slab" << std::endl;
+	for (double* block : blocks)
+		alloc.deallocate(block, 1);
+
+	os << "pooled list values:\n";
+	ads::DoublyLinkedList<int> dll;
+	for (int i = 0; i < 100; ++i)
+		dll.Append(i);
+	dll.Remove(50);
+	dll.Append(50);
+	os << dll.Head()->value << " .. " << dll.Tail()->value << std::endl;
+	os << "slabs reserved: " << dll.GetAllocator().Pool()->SlabCount() << std::endl;
+
+	// a list built from another's allocator rebinds it to its node type and still shares the pools, a copied list gets its own
+	ads::DoublyLinkedList<int> shared(dll.GetAllocator());
+	ads::DoublyLinkedList<int> copied(dll);
+	const ads::PoolAllocator<int> rebound(dll.GetAllocator());
+	os << "rebound allocators compare equal: " << (shared.GetAllocator() == dll.GetAllocator() && rebound == dll.GetAllocator() ? "yes" : "no")
+		<< ", same node pool: " << (shared.GetAllocator().Pool() == dll.GetAllocator().Pool() ? "yes" : "no")
+		<< ", copy has its own: " << (copied.GetAllocator() == dll.GetAllocator() ? "no" : "yes") << std::endl;
+
+	os << "std::allocator list values:\n";
+	ads::LinkedList<int, std::allocator<int>> linkedList;
+	linkedList.Append(1);
+	linkedList.Append(2);
+	for (auto* pNode = linkedList.Head(); pNode != nullptr; pNode = pNode->next)
+		os << pNode->value << std::endl;
+}
+
+#endif // TESTS_POOL_ALLOCATOR_TESTS_H
\ No newline at end of file
@@ -0,0 +1,74 @@
+#ifndef TESTS_RING_BUFFER_TESTS_H
+#define TESTS_RING_BUFFER_TESTS_H
+
+#include "pch.h"
+#include "data_structures/ring_buffer.h"
+
+void TestRingBuffer(std::ostream& os) {
+	os << ":: TestRingBuffer ::\n";
+
+	ads::RingBuffer<int> ring;
+	for (int i = 0; i < 6; ++i)
+		ring.PushBack(i);
+	ring.PopFront();
+	ring.PopFront();
+	ring.PushFront(-1);
+	ring.PushBack(6);
+	os << "front " << ring.Front() << ", back " << ring.Back() << ", contents:";
+	for (int val : ring)
+		os << " " << val;
+	os << std::endl;
+
+	// head sits mid array, so these pushes wrap and the growth has to unwrap them
+	for (int i = 7; i < 20; ++i)
+		ring.PushBack(i);
+	ring.PopBack();
+	os << "size " << ring.Size() << ", capacity " << ring.Capacity() << ", [0] " << ring[0] << ", [15] " << ring[15] << std::endl;
+
+	// bulk copies in and out across the wrap point
+	const std::vector<int> frame = { 100, 101, 102, 103, 104, 105, 106, 107, 108, 109 };
+	int drained[32];
+	const size_t popped = ring.PopFront(12, drained);
+	ring.PushBack(frame);
+	const size_t capacity = ring.Capacity();
+	os << "popped " << popped << " starting " << drained[0] << ", size after bulk push " << ring.Size() << ", back " << ring.Back() << ", contents:";
+	for (int val : ring)
+		os << " " << val;
+	os << std::endl;
+
+	// steady state pumping stays inside the existing array
+	for (int round = 0; round < 100; ++round) {
+		ring.PushBack(frame);
+		ring.PopFront(frame.size(), drained);
+	}
+	os << "after 100 pumped frames capacity unchanged: " << (ring.Capacity() == capacity ? "yes" : "no") << ", drained " << ring.PopFront(32, drained) << std::endl;
+
+	ads::RingBuffer<std::string> words;
+	for (int i = 0; i < 5; ++i)
+		words.EmplaceBack("word" + std::to_string(i));
+	words.PopFront();
+	for (int i = 5; i < 12; ++i)
+		words.EmplaceBack("word" + std::to_string(i));
+	ads::RingBuffer<std::string> copy = words;
+	std::string out[4];
+	words.PopFront(4, out);
+	const std::string batch[] = { "x", "y" };
+	words.PushBack(std::span<const std::string>(batch));
+	os << "strings popped " << out[0] << ".." << out[3] << ", front " << words.Front() << ", back " << words.Back() << ", copy front " << copy.Front() << " size " << copy.Size() << std::endl;
+
+	// pushing the buffer's own values while it is full, growing must not free them before they are copied
+	ads::RingBuffer<std::string> own;
+	auto fill = [&own]() {
+		while (own.Size() < own.Capacity() || own.IsEmpty())
+			own.EmplaceBack("value that lives on the heap " + std::to_string(own.Size()));
+	};
+	fill();
+	own.PushBack(own.Front());
+	fill();
+	own.PushFront(own.Back());
+	fill();
+	own.PushBack(std::span<const std::string>(&own[1], 2));
+	os << "own values pushed while growing, front " << own.Front() << ", back " << own.Back() << ", size " << own.Size() << std::endl;
+}
+
+#endif // TESTS_RING_BUFFER_TESTS_H
\ No newline at end of file
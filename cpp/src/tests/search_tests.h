@@ -0,0 +1,109 @@
+#ifndef TESTS_SEARCH_TESTS_H
+#define TESTS_SEARCH_TESTS_H
+
+#include "pch.h"
+#include "algorithms/search/branchless_search.h"
+#include "algorithms/search/eytzinger_array.h"
+#include "algorithms/search/static_btree.h"
+#include "data_structures/linked_list.h"
+
+// sorted keys with gaps and duplicates, plus probes below, between, on and above them
+template<class T>
+std::pair<std::vector<T>, std::vector<T>> SearchTestKeys(size_t size, uint32_t seed) {
+	std::mt19937 rng(seed);
+	std::vector<T> keys(size);
+	for (size_t i = 0; i < size; ++i)
+		keys[i] = static_cast<T>(3 * i + rng() % 3);
+	std::vector<T> probes;
+	for (size_t i = 0; i < 3 * size + 3; ++i)
+		probes.push_back(static_cast<T>(i));
+	return { keys, probes };
+}
+
+// every layout must find the same value std::lower_bound does, for sizes on both sides of a full tree
+template<class T>
+bool CheckSearchesMatchLowerBound() {
+	for (size_t size : { size_t(0), size_t(1), size_t(7), size_t(15), size_t(16), size_t(17), size_t(100), size_t(289), size_t(5000) }) {
+		const auto [keys, probes] = SearchTestKeys<T>(size, static_cast<uint32_t>(size));
+		const ads::EytzingerArray<T> eytzinger(keys.begin(), keys.end());
+		const ads::StaticBTree<T> btree(keys.begin(), keys.end());
+		for (const T& probe : probes) {
+			const auto expected = std::lower_bound(keys.begin(), keys.end(), probe);
+			const T* eytzingerFound = eytzinger.LowerBound(probe);
+			const T* btreeFound = btree.LowerBound(probe);
+			if (ads::BranchlessLowerBound(keys.begin(), keys.end(), probe) != expected)
+				return false;
+			if (expected == keys.end() ? (eytzingerFound != nullptr || btreeFound != nullptr)
+				: (eytzingerFound == nullptr || btreeFound == nullptr || *eytzingerFound != *expected || *btreeFound != *expected))
+				return false;
+		}
+	}
+	return true;
+}
+
+void TestBranchlessLowerBound(std::ostream& os) {
+	os << ":: TestBranchlessLowerBound ::\n";
+
+	os << "int32 matches std::lower_bound: " << (CheckSearchesMatchLowerBound<int32_t>() ? "yes" : "no") << std::endl;
+
+	// descending order through the comparator, on a plain array
+	const int descending[] = { 90, 70, 70, 50, 30, 10 };
+	const int* found = ads::BranchlessLowerBound(std::begin(descending), std::end(descending), 70, std::greater<>());
+	const int* missing = ads::BranchlessLowerBound(std::begin(descending), std::end(descending), 5, std::greater<>());
+	os << "descending: 70 at index " << (found - descending) << ", 5 past the end: " << (missing == std::end(descending) ? "yes" : "no") << std::endl;
+
+	std::vector<std::string> words = { "apple", "banana", "cherry", "date", "fig" };
+	os << "first word not before \"cat\": " << *ads::BranchlessLowerBound(words.begin(), words.end(), std::string("cat")) << std::endl;
+}
+
+void TestEytzingerArray(std::ostream& os) {
+	os << ":: TestEytzingerArray ::\n";
+
+	// 1..7 fills a perfect tree, breadth first order is 4, 2 6, 1 3 5 7
+	const std::vector<int> sorted = { 1, 2, 3, 4, 5, 6, 7 };
+	const ads::EytzingerArray<int> small(sorted.begin(), sorted.end());
+	os << "layout:";
+	for (int val : small.Layout().subspan(1))
+		os << " " << val;
+	os << ", cache line aligned: " << (reinterpret_cast<uintptr_t>(small.Layout().data()) % ads::cacheLineSize == 0 ? "yes" : "no") << std::endl;
+
+	os << "int32, uint64, float and double match std::lower_bound: " << (CheckSearchesMatchLowerBound<int32_t>() && CheckSearchesMatchLowerBound<uint64_t>()
+		&& CheckSearchesMatchLowerBound<float>() && CheckSearchesMatchLowerBound<double>() ? "yes" : "no") << std::endl;
+
+	// built straight from a sorted linked list, which could only be searched linearly
+	ads::LinkedList<std::string> list;
+	for (const char* word : { "alpha", "bravo", "charlie", "delta", "echo" })
+		list.Append(word);
+	const ads::EytzingerArray<std::string> words(list.begin(), list.end());
+	os << "from a linked list: size " << words.Size() << ", contains delta: " << (words.Contains("delta") ? "yes" : "no")
+		<< ", contains dog: " << (words.Contains("dog") ? "yes" : "no") << ", lower bound of c: " << *words.LowerBound("c") << std::endl;
+}
+
+void TestStaticBTree(std::ostream& os) {
+	os << ":: TestStaticBTree ::\n";
+
+	os << "int32, uint32, int64, uint64, float and double match std::lower_bound: " << (CheckSearchesMatchLowerBound<int32_t>()
+		&& CheckSearchesMatchLowerBound<uint32_t>() && CheckSearchesMatchLowerBound<int64_t>() && CheckSearchesMatchLowerBound<uint64_t>()
+		&& CheckSearchesMatchLowerBound<float>() && CheckSearchesMatchLowerBound<double>() ? "yes" : "no") << std::endl;
+
+	// unsigned keys above INT32_MAX go through the sign flip in the vector compare
+	std::vector<uint32_t> high(1000);
+	for (size_t i = 0; i < high.size(); ++i)
+		high[i] = 0x7FFFFF00u + static_cast<uint32_t>(i * 2);
+	const ads::StaticBTree<uint32_t> highTree(high.begin(), high.end());
+	os << "unsigned keys across 2^31 found: " << (highTree.Contains(0x80000000u) && !highTree.Contains(0x80000001u) ? "yes" : "no") << std::endl;
+
+	// 16 int32 keys per line, a million keys is 5 levels where a binary search takes 20 steps
+	std::vector<int32_t> million(1000000);
+	std::iota(million.begin(), million.end(), 0);
+	const ads::StaticBTree<int32_t> tree(million.begin(), million.end());
+	os << "keys per node: " << tree.keysPerNode << ", height for a million keys: " << tree.Height()
+		<< ", last key found: " << (tree.Contains(999999) ? "yes" : "no") << ", past the end: " << (tree.LowerBound(1000000) == nullptr ? "nullptr" : "value") << std::endl;
+
+	// any comparator goes through the scalar rank
+	const std::vector<std::string> words = { "echo", "delta", "charlie", "bravo", "alpha" };
+	const ads::StaticBTree<std::string, std::greater<std::string>> descending(words.begin(), words.end());
+	os << "descending strings, lower bound of cat: " << *descending.LowerBound("cat") << std::endl;
+}
+
+#endif // TESTS_SEARCH_TESTS_H
\ No newline at end of file
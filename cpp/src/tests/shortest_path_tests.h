@@ -0,0 +1,224 @@
+#ifndef TESTS_SHORTEST_PATH_TESTS_H
+#define TESTS_SHORTEST_PATH_TESTS_H
+
+#include "pch.h"
+#include "algorithms/graph/astar.h"
+#include "algorithms/graph/csr_builder.h"
+#include "algorithms/graph/delta_stepping.h"
+#include "algorithms/graph/dijkstra.h"
+#include "algorithms/graph/graph_generators.h"
+#include "algorithms/thread_pool.h"
+#include "data_structures/csr_graph.h"
+
+// textbook Dijkstra over std::priority_queue to check the others against
+template<class Weight>
+std::vector<typename ads::PathDistance<Weight>::Type> ReferenceDistances(const ads::CsrGraph<Weight>& graph, uint32_t source) {
+	using Distance = typename ads::PathDistance<Weight>::Type;
+	std::vector<Distance> distances(graph.VertexCount(), ads::PathDistance<Weight>::unreached);
+	std::priority_queue<std::pair<Distance, uint32_t>, std::vector<std::pair<Distance, uint32_t>>, std::greater<>> queue;
+	distances[source] = 0;
+	queue.push({ 0, source });
+	while (!queue.empty()) {
+		const auto [distance, u] = queue.top();
+		queue.pop();
+		if (distance > distances[u])
+			continue;
+		for (size_t i = 0; i < graph.OutDegree(u); ++i) {
+			const uint32_t v = graph.OutNeighbors(u)[i];
+			const Distance next = distance + ads::PathDistance<Weight>::Of(graph.OutWeights(u)[i]);
+			if (next < distances[v]) {
+				distances[v] = next;
+				queue.push({ next, v });
+			}
+		}
+	}
+	return distances;
+}
+
+template<class Weight>
+std::vector<typename ads::PathDistance<Weight>::Type> ContextDistances(const ads::ShortestPathContext<Weight>& context, size_t vertexCount) {
+	std::vector<typename ads::PathDistance<Weight>::Type> distances(vertexCount);
+	for (uint32_t v = 0; v < vertexCount; ++v)
+		distances[v] = context.DistanceTo(v);
+	return distances;
+}
+
+// the path runs from source to target over real edges and its weights add up to the reported distance
+template<class Weight>
+bool CheckPath(const ads::CsrGraph<Weight>& graph, const ads::ShortestPathContext<Weight>& context, uint32_t source, uint32_t target) {
+	std::vector<uint32_t> path;
+	context.PathTo(target, path);
+	if (path.empty() || path.front() != source || path.back() != target)
+		return false;
+	typename ads::PathDistance<Weight>::Type total = 0;
+	for (size_t i = 0; i + 1 < path.size(); ++i) {
+		const std::span<const uint32_t> neighbours = graph.OutNeighbors(path[i]);
+		const auto it = std::lower_bound(neighbours.begin(), neighbours.end(), path[i + 1]);
+		if (it == neighbours.end() || *it != path[i + 1])
+			return false;
+		total += ads::PathDistance<Weight>::Of(graph.OutWeights(path[i])[it - neighbours.begin()]);
+	}
+	return total == context.DistanceTo(target);
+}
+
+void TestDijkstra(std::ostream& os) {
+	os << ":: TestDijkstra ::\n";
+
+	ads::ThreadPool pool(4);
+	// 0 -> 1 -> 2 is cheaper than the direct 0 -> 2, vertex 3 can't be reached
+	const std::vector<ads::CsrEdge<uint32_t>> small = { { 0, 1, 2 }, { 1, 2, 3 }, { 0, 2, 10 }, { 3, 0, 1 } };
+	const ads::CsrGraph<uint32_t> smallGraph = ads::BuildCsrGraph(4, small, pool);
+	ads::ShortestPathContext<uint32_t> context(4);
+	std::vector<uint32_t> path;
+	context.PathTo(0, path);
+	os << "fresh context reached nothing: " << (!context.IsReached(0) && context.DistanceTo(0) == context.unreached && path.empty() ? "yes" : "no") << std::endl;
+	ads::ShortestPaths(smallGraph, 0, context);
+	context.PathTo(2, path);
+	os << "distance to 2: " << context.DistanceTo(2) << ", path:";
+	for (uint32_t v : path)
+		os << " " << v;
+	os << ", 3 reached: " << (context.IsReached(3) ? "yes" : "no") << std::endl;
+
+	const uint32_t vertexCount = 5000;
+	const std::vector<ads::CsrEdge<>> edges = ads::GraphGenerator::Uniform(vertexCount, 40000, 6, pool);
+	const ads::CsrGraph<uint32_t> graph = ads::BuildCsrGraph(vertexCount, ads::GraphGenerator::Weighted<uint32_t>(edges, 1, 1000, 7, pool), pool);
+	const ads::CsrGraph<double> real = ads::BuildCsrGraph(vertexCount, ads::GraphGenerator::Weighted<double>(edges, 0.0, 1.0, 8, pool), pool);
+	bool radixMatches = true;
+	bool daryMatches = true;
+	bool realMatches = true;
+	bool pathsValid = true;
+	ads::ShortestPathContext<double> realContext;
+	for (uint32_t source : { 0u, 17u, 4999u }) {
+		ads::ShortestPaths<ads::DijkstraQueue::RadixHeap>(graph, source, context);
+		radixMatches = radixMatches && ContextDistances(context, vertexCount) == ReferenceDistances(graph, source);
+		pathsValid = pathsValid && CheckPath(graph, context, source, (source + 1234) % vertexCount);
+		ads::ShortestPaths<ads::DijkstraQueue::DaryHeap>(graph, source, context);
+		daryMatches = daryMatches && ContextDistances(context, vertexCount) == ReferenceDistances(graph, source);
+		const std::vector<double> expected = ReferenceDistances(real, source);
+		ads::ShortestPaths<ads::DijkstraQueue::RadixHeap>(real, source, realContext);
+		realMatches = realMatches && ContextDistances(realContext, vertexCount) == expected;
+		ads::ShortestPaths<ads::DijkstraQueue::DaryHeap>(real, source, realContext);
+		realMatches = realMatches && ContextDistances(realContext, vertexCount) == expected;
+	}
+	os << "radix heap matches a priority queue Dijkstra: " << (radixMatches ? "yes" : "no") << ", d-ary heap: " << (daryMatches ? "yes" : "no")
+		<< ", double weights: " << (realMatches ? "yes" : "no") << ", paths add up: " << (pathsValid ? "yes" : "no") << std::endl;
+
+	// a target stops the search early with the same distance
+	ads::ShortestPaths(graph, 0, context);
+	const uint64_t full = context.DistanceTo(42);
+	const size_t fullSettled = context.SettledCount();
+	ads::ShortestPaths(graph, 0, context, 42);
+	os << "early exit: same distance " << (context.DistanceTo(42) == full ? "yes" : "no") << ", settled fewer: " << (context.SettledCount() < fullSettled ? "yes" : "no") << std::endl;
+
+	// unweighted edges count 1, so distances are BFS depths
+	const ads::CsrGraph<> unweighted = ads::BuildCsrGraph(4, std::vector<ads::CsrEdge<>>{ { 0, 1, {} }, { 1, 2, {} }, { 2, 3, {} }, { 0, 3, {} } }, pool);
+	ads::ShortestPathContext<ads::Unweighted> hops;
+	ads::ShortestPaths(unweighted, 0, hops);
+	os << "unweighted hops:";
+	for (uint32_t v = 0; v < 4; ++v)
+		os << " " << hops.DistanceTo(v);
+	os << std::endl;
+}
+
+void TestDeltaStepping(std::ostream& os) {
+	os << ":: TestDeltaStepping ::\n";
+
+	ads::ThreadPool pool(4);
+	const std::vector<ads::CsrEdge<uint32_t>> small = { { 0, 1, 2 }, { 1, 2, 3 }, { 0, 2, 10 }, { 3, 0, 1 } };
+	const std::vector<uint64_t> smallDistances = ads::DeltaSteppingDistances(ads::BuildCsrGraph(4, small, pool), 0, pool, 4);
+	os << "distances:";
+	for (uint64_t distance : smallDistances)
+		os << " " << (distance == ads::PathDistance<uint32_t>::unreached ? std::string("-") : std::to_string(distance));
+	os << std::endl;
+
+	const std::vector<ads::CsrEdge<>> kronecker = ads::GraphGenerator::Kronecker(13, 8, 3, pool);
+	const ads::CsrGraph<uint32_t> graph = ads::BuildCsrGraph(1u << 13, ads::GraphGenerator::Weighted<uint32_t>(kronecker, 1, 255, 4, pool), pool, { .symmetrize = true });
+	const std::vector<ads::CsrEdge<>> grid = ads::GraphGenerator::Grid(120, 80, pool);
+	const ads::CsrGraph<double> gridGraph = ads::BuildCsrGraph(120 * 80, ads::GraphGenerator::Weighted<double>(grid, 1.0, 2.0, 5, pool), pool, { .symmetrize = true });
+	const uint32_t source = kronecker.front().source;
+	const std::vector<uint64_t> expected = ReferenceDistances(graph, source);
+	const std::vector<double> gridExpected = ReferenceDistances(gridGraph, 0);
+	for (unsigned threads : { 1u, 4u }) {
+		ads::ThreadPool other(threads);
+		bool matches = true;
+		for (uint64_t delta : { 1u, 32u, 1000u })
+			matches = matches && ads::DeltaSteppingDistances(graph, source, other, delta) == expected;
+		bool gridMatches = true;
+		for (double delta : { 0.5, 4.0 }) {
+			const std::vector<double> distances = ads::DeltaSteppingDistances(gridGraph, 0, other, delta);
+			for (size_t v = 0; v < distances.size(); ++v)
+				gridMatches = gridMatches && std::abs(distances[v] - gridExpected[v]) < 1e-9;
+		}
+		os << threads << " thread(s), kronecker matches Dijkstra for every delta: " << (matches ? "yes" : "no")
+			<< ", weighted grid: " << (gridMatches ? "yes" : "no") << std::endl;
+	}
+
+	// a long chain of heavy edges runs through millions of buckets, only a thousand or so are ever held at once
+	std::vector<ads::CsrEdge<uint32_t>> chainEdges;
+	for (uint32_t v = 0; v + 1 < 20000; ++v)
+		chainEdges.push_back({ v, v + 1, 1000 });
+	const std::vector<uint64_t> chainDistances = ads::DeltaSteppingDistances(ads::BuildCsrGraph(20000, chainEdges, pool), 0, pool, 1);
+	os << "chain end at " << chainDistances.back() << std::endl;
+
+	bool tinyRejected = false;
+	try {
+		ads::DeltaSteppingDistances(gridGraph, 0, pool, 1e-300);
+	} catch (const std::invalid_argument&) {
+		tinyRejected = true;
+	}
+	size_t thrown = 0;
+	try {
+		ads::DeltaSteppingDistances(graph, source, pool, 0);
+	} catch (const std::invalid_argument&) {
+		++thrown;
+	}
+	try {
+		ads::DeltaSteppingDistances(gridGraph, 0, pool, 0.0);
+	} catch (const std::invalid_argument&) {
+		++thrown;
+	}
+	os << "bucket width too small for the distances rejected: " << (tinyRejected ? "yes" : "no")
+		<< ", zero delta rejected for integer and double weights: " << (thrown == 2 ? "yes" : "no") << std::endl;
+}
+
+void TestAStar(std::ostream& os) {
+	os << ":: TestAStar ::\n";
+
+	ads::ThreadPool pool(4);
+	const uint32_t width = 200;
+	const uint32_t height = 150;
+	const std::vector<ads::CsrEdge<>> grid = ads::GraphGenerator::Grid(width, height, pool);
+	const ads::CsrGraph<uint32_t> graph = ads::BuildCsrGraph(width * height, ads::GraphGenerator::Weighted<uint32_t>(grid, 10, 20, 9, pool), pool, { .symmetrize = true });
+
+	// one context serves every query, fresh ones have to agree with it
+	ads::ShortestPathContext<uint32_t> context(graph.VertexCount());
+	ads::ShortestPathContext<uint32_t> dijkstra;
+	std::mt19937 rng(10);
+	bool sameDistances = true;
+	bool pathsValid = true;
+	size_t aStarSettled = 0;
+	size_t dijkstraSettled = 0;
+	for (int query = 0; query < 50; ++query) {
+		const uint32_t source = rng() % graph.VertexCount();
+		const uint32_t target = rng() % graph.VertexCount();
+		const bool found = ads::FindPath(graph, source, target, ads::GridManhattanHeuristic<uint64_t>(width, target, 10), context);
+		ads::ShortestPaths(graph, source, dijkstra, target);
+		sameDistances = sameDistances && found && context.DistanceTo(target) == dijkstra.DistanceTo(target);
+		pathsValid = pathsValid && CheckPath(graph, context, source, target);
+		aStarSettled += context.SettledCount();
+		dijkstraSettled += dijkstra.SettledCount();
+	}
+	os << "grid queries match Dijkstra: " << (sameDistances ? "yes" : "no") << ", paths add up: " << (pathsValid ? "yes" : "no")
+		<< ", settles under half as many vertices: " << (2 * aStarSettled < dijkstraSettled ? "yes" : "no") << std::endl;
+
+	ads::FindPath(graph, 0, 0, ads::ZeroHeuristic(), context);
+	os << "source is target: distance " << context.DistanceTo(0) << ", settled " << context.SettledCount() << std::endl;
+
+	// a one way edge into vertex 2 only
+	const ads::CsrGraph<uint32_t> oneWay = ads::BuildCsrGraph(3, std::vector<ads::CsrEdge<uint32_t>>{ { 2, 0, 1 }, { 0, 1, 1 } }, pool);
+	ads::ShortestPathContext<uint32_t> small;
+	const bool found = ads::FindPath(oneWay, 0, 2, ads::ZeroHeuristic(), small);
+	os << "unreachable target found: " << (found ? "yes" : "no") << ", distance unreached: " << (small.DistanceTo(2) == small.unreached ? "yes" : "no") << std::endl;
+}
+
+#endif // TESTS_SHORTEST_PATH_TESTS_H
\ No newline at end of file
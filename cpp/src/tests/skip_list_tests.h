@@ -0,0 +1,111 @@
+#ifndef TESTS_SKIP_LIST_TESTS_H
+#define TESTS_SKIP_LIST_TESTS_H
+
+#include "pch.h"
+#include "data_structures/skip_list.h"
+
+void TestSkipList(std::ostream& os) {
+	os << ":: TestSkipList ::\n";
+
+	ads::SkipList<int, std::string> names;
+	names.Insert(3, "three");
+	names.Insert(1, "one");
+	names.TryEmplace(2, 3, 'x');
+	os << "inserted again: " << (names.Insert(2, "two") ? "yes" : "no") << ", in order:";
+	for (auto [key, value] : names)
+		os << " " << key << "=" << value;
+	os << std::endl;
+
+	*names.Get(2) = "two";
+	names.Erase(1);
+	os << "after erasing 1: size " << names.Size() << ", contains 1: " << (names.Contains(1) ? "yes" : "no") << ", get 2: " << *names.Get(2)
+		<< ", lower bound of 0: " << names.LowerBound(0).Key() << std::endl;
+
+	// random inserts and erases against std::map
+	ads::SkipList<int, int> list;
+	std::map<int, int> reference;
+	std::mt19937 rng(5);
+	for (int i = 0; i < 20000; ++i) {
+		const int key = static_cast<int>(rng() % 3000);
+		if (rng() % 3 == 0) {
+			if (list.Erase(key) != reference.erase(key))
+				os << "erase mismatch for " << key << std::endl;
+		} else if (list.Insert(key, i) != reference.emplace(key, i).second) {
+			os << "insert mismatch for " << key << std::endl;
+		}
+	}
+	const bool sameOrder = list.Size() == reference.size() && std::equal(list.begin(), list.end(), reference.begin(),
+		[](const auto& a, const auto& b) { return a.first == b.first && a.second == b.second; });
+	size_t inRange = 0;
+	const size_t visited = list.ForEachInRange(1000, 2000, [&](int key, int) { inRange += key >= 1000 && key < 2000; });
+	const auto expected = std::distance(reference.lower_bound(1000), reference.lower_bound(2000));
+	os << "random operations match std::map: " << (sameOrder ? "yes" : "no") << ", range [1000, 2000) visits "
+		<< (visited == inRange && static_cast<std::ptrdiff_t>(visited) == expected ? "exactly the keys in it" : "wrong keys") << std::endl;
+
+	list.Clear();
+	os << "cleared: " << (list.IsEmpty() && list.begin() == list.end() ? "yes" : "no") << std::endl;
+}
+
+void TestConcurrentSkipList(std::ostream& os) {
+	os << ":: TestConcurrentSkipList ::\n";
+
+	// erased keys stay as tombstones until a later insert goes in front of them or Compact frees them
+	ads::ConcurrentSkipList<int, int> list;
+	list.Insert(1, 10);
+	list.Insert(2, 20);
+	list.Erase(2);
+	const bool reinserted = list.Insert(2, 21);
+	list.Erase(1);
+	os << "reinserted after erase: " << (reinserted ? "yes" : "no") << ", get 2: " << *list.Get(2) << ", contains 1: " << (list.Contains(1) ? "yes" : "no")
+		<< ", compact freed " << list.Compact() << ", size " << list.Size() << std::endl;
+
+	// every thread inserts its own stripe plus a range shared with all the others, then erases half its stripe
+	constexpr int threadCount = 4;
+	constexpr int perThread = 20000;
+	constexpr int shared = 5000;
+	ads::ConcurrentSkipList<int, int> concurrent;
+	std::atomic<int> sharedWins = 0;
+	std::atomic<bool> start = false;
+	std::atomic<size_t> readerHits = 0;
+	std::vector<std::thread> threads;
+	for (int t = 0; t < threadCount; ++t) {
+		threads.emplace_back([&, t]() {
+			while (!start.load(std::memory_order_acquire)) {}
+			for (int i = 0; i < perThread; ++i) {
+				concurrent.Insert(shared + i * threadCount + t, t);
+				if (i < shared && concurrent.Insert(i, t))
+					sharedWins.fetch_add(1, std::memory_order_relaxed);
+			}
+			for (int i = 0; i < perThread; i += 2)
+				concurrent.Erase(shared + i * threadCount + t);
+		});
+	}
+	// a reader scanning while the writers run must only ever see increasing keys
+	threads.emplace_back([&]() {
+		while (!start.load(std::memory_order_acquire)) {}
+		for (int pass = 0; pass < 20; ++pass) {
+			int previous = -1;
+			concurrent.ForEachInRange(0, INT_MAX, [&](int key, int) {
+				if (key <= previous)
+					readerHits.store(SIZE_MAX, std::memory_order_relaxed);
+				previous = key;
+			});
+			if (readerHits.load(std::memory_order_relaxed) != SIZE_MAX)
+				readerHits.fetch_add(1, std::memory_order_relaxed);
+		}
+	});
+	start.store(true, std::memory_order_release);
+	for (std::thread& thread : threads)
+		thread.join();
+
+	bool stripesRight = true;
+	for (int i = 0; i < perThread * threadCount; ++i)
+		stripesRight &= concurrent.Contains(shared + i) == ((i / threadCount) % 2 == 1);
+	const size_t expectedSize = shared + perThread * threadCount / 2;
+	os << "each shared key inserted once: " << (sharedWins == shared ? "yes" : "no") << ", odd stripes left: " << (stripesRight ? "yes" : "no")
+		<< ", size " << (concurrent.Size() == expectedSize ? "matches" : "wrong") << ", reader saw sorted scans: " << (readerHits == 20 ? "yes" : "no") << std::endl;
+	const size_t freed = concurrent.Compact();
+	os << "compact freed " << freed << ", iteration count after: " << std::distance(concurrent.begin(), concurrent.end()) << std::endl;
+}
+
+#endif // TESTS_SKIP_LIST_TESTS_H
\ No newline at end of file
@@ -0,0 +1,175 @@
+#ifndef TESTS_SORT_TESTS_H
+#define TESTS_SORT_TESTS_H
+
+#include "pch.h"
+#include "algorithms/sort/parallel_merge_sort.h"
+#include "algorithms/sort/pdq_sort.h"
+#include "algorithms/sort/radix_sort.h"
+#include "algorithms/thread_pool.h"
+#include "data_structures/doubly_linked_list.h"
+#include "data_structures/linked_list.h"
+
+// inputs quicksorts tend to trip over: sorted, reversed, organ pipe, sawtooth, few distinct values and random
+std::vector<std::vector<int>> SortTestPatterns(size_t size, uint32_t seed) {
+	std::mt19937 rng(seed);
+	std::vector<std::vector<int>> patterns(6, std::vector<int>(size));
+	for (size_t i = 0; i < size; ++i) {
+		const int val = static_cast<int>(i);
+		patterns[0][i] = val;
+		patterns[1][i] = static_cast<int>(size) - val;
+		patterns[2][i] = i < size / 2 ? val : static_cast<int>(size) - val;
+		patterns[3][i] = val % 97;
+		patterns[4][i] = static_cast<int>(rng() % 4);
+		patterns[5][i] = static_cast<int>(rng() >> 1) - INT_MAX / 2;
+	}
+	return patterns;
+}
+
+// sorts every pattern at several sizes with sort and checks the result matches std::sort
+template<class SortFn>
+bool CheckSortPatterns(SortFn&& sort) {
+	for (size_t size : { size_t(0), size_t(1), size_t(2), size_t(23), size_t(100), size_t(1000), size_t(100000) }) {
+		for (std::vector<int>& values : SortTestPatterns(size, static_cast<uint32_t>(size))) {
+			std::vector<int> expected = values;
+			std::sort(expected.begin(), expected.end());
+			sort(values);
+			if (values != expected)
+				return false;
+		}
+	}
+	return true;
+}
+
+// sorts (key, original position) pairs on the key only and checks equal keys kept their order
+template<class SortFn>
+bool CheckSortIsStable(SortFn&& sort) {
+	std::mt19937 rng(11);
+	std::vector<std::pair<int, int>> values(50000);
+	for (size_t i = 0; i < values.size(); ++i)
+		values[i] = { static_cast<int>(rng() % 100) - 50, static_cast<int>(i) };
+	std::vector<std::pair<int, int>> expected = values;
+	std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+	sort(values);
+	return values == expected;
+}
+
+void TestRadixSort(std::ostream& os) {
+	os << ":: TestRadixSort ::\n";
+
+	os << "int patterns match std::sort: " << (CheckSortPatterns([](std::vector<int>& v) { ads::RadixSort(v.begin(), v.end()); }) ? "yes" : "no") << std::endl;
+	os << "stable on a key extractor: " << (CheckSortIsStable([](auto& v) { ads::RadixSort(v.begin(), v.end(), [](const auto& p) { return p.first; }); }) ? "yes" : "no") << std::endl;
+
+	// floats order negatives, signed zero and infinities the way operator< does
+	std::vector<float> floats = { 3.5f, -0.25f, 1e30f, -1e30f, 0.0f, -7.0f, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), 2.0f };
+	std::mt19937 rng(5);
+	std::uniform_real_distribution<double> dist(-1e6, 1e6);
+	for (int i = 0; i < 5000; ++i)
+		floats.push_back(static_cast<float>(dist(rng)));
+	std::vector<double> doubles(floats.begin(), floats.end());
+	ads::RadixSort(floats.begin(), floats.end());
+	ads::RadixSort(doubles.begin(), doubles.end());
+	os << "floats sorted: " << (std::is_sorted(floats.begin(), floats.end()) ? "yes" : "no")
+		<< ", doubles sorted: " << (std::is_sorted(doubles.begin(), doubles.end()) ? "yes" : "no") << std::endl;
+
+	// 64 bit keys that only differ in their low byte take one scatter pass
+	std::vector<uint64_t> wide = { 0xFFFF00000000000Bull, 0xFFFF000000000003ull, 0xFFFF000000000007ull, 0xFFFF000000000001ull };
+	for (uint64_t i = 0; i < 100; ++i)
+		wide.push_back(0xFFFF000000000000ull | (i * 37 % 256));
+	ads::RadixSort(wide.begin(), wide.end());
+	os << "wide keys sorted: " << (std::is_sorted(wide.begin(), wide.end()) ? "yes" : "no") << std::endl;
+
+	// descending through a negated key, on a singly linked list
+	ads::LinkedList<int> list;
+	for (int val : { 4, -2, 9, 0, 7, -5 })
+		list.Append(val);
+	ads::RadixSort(list.begin(), list.end(), [](int val) { return -val; });
+	os << "linked list by descending key:";
+	for (int val : list)
+		os << " " << val;
+	os << std::endl;
+}
+
+void TestPdqSort(std::ostream& os) {
+	os << ":: TestPdqSort ::\n";
+
+	os << "int patterns match std::sort: " << (CheckSortPatterns([](std::vector<int>& v) { ads::PdqSort(v.begin(), v.end()); }) ? "yes" : "no") << std::endl;
+	os << "with a lambda comparator: " << (CheckSortPatterns([](std::vector<int>& v) { ads::PdqSort(v.begin(), v.end(), [](int a, int b) { return a < b; }); }) ? "yes" : "no") << std::endl;
+
+	// std::greater takes the branchless partition too
+	std::vector<int> descending = SortTestPatterns(20000, 9)[5];
+	ads::PdqSort(descending.begin(), descending.end(), std::greater<>());
+	os << "descending with std::greater: " << (std::is_sorted(descending.begin(), descending.end(), std::greater<>()) ? "yes" : "no") << std::endl;
+
+	// a comparator that counts its calls, a killer input for plain median of three quicksort must stay around n log n
+	const size_t size = 1 << 16;
+	std::vector<int> organ(size);
+	for (size_t i = 0; i < size; ++i)
+		organ[i] = static_cast<int>(i % 2 == 0 ? i : size - i);
+	size_t comparisons = 0;
+	ads::PdqSort(organ.begin(), organ.end(), [&comparisons](int a, int b) { ++comparisons; return a < b; });
+	os << "alternating input sorted: " << (std::is_sorted(organ.begin(), organ.end()) ? "yes" : "no")
+		<< ", comparisons under 4 n log n: " << (comparisons < 4 * size * 16 ? "yes" : "no") << std::endl;
+
+	// sorted input is recognised and finished by the partial insertion sort
+	std::vector<int> sorted(size);
+	std::iota(sorted.begin(), sorted.end(), 0);
+	comparisons = 0;
+	ads::PdqSort(sorted.begin(), sorted.end(), [&comparisons](int a, int b) { ++comparisons; return a < b; });
+	os << "sorted input takes linear comparisons: " << (comparisons < 4 * size ? "yes" : "no") << std::endl;
+
+	std::vector<std::string> words = { "pear", "fig", "apple", "kiwi", "date", "lime", "banana", "cherry" };
+	ads::PdqSort(words.begin(), words.end());
+	os << "words:";
+	for (const std::string& word : words)
+		os << " " << word;
+	os << std::endl;
+
+	ads::DoublyLinkedList<std::string> list;
+	for (const char* word : { "delta", "alpha", "echo", "charlie", "bravo" })
+		list.Append(word);
+	ads::PdqSort(list.begin(), list.end());
+	os << "doubly linked list:";
+	for (const std::string& word : list)
+		os << " " << word;
+	os << std::endl;
+}
+
+void TestParallelMergeSort(std::ostream& os) {
+	os << ":: TestParallelMergeSort ::\n";
+
+	for (unsigned threads : { 1u, 4u }) {
+		ads::ThreadPool pool(threads);
+		os << threads << " thread(s), int patterns match std::sort: "
+			<< (CheckSortPatterns([&pool](std::vector<int>& v) { ads::ParallelMergeSort(v.begin(), v.end(), pool); }) ? "yes" : "no")
+			<< ", stable: " << (CheckSortIsStable([&pool](auto& v) {
+				ads::ParallelMergeSort(v.begin(), v.end(), pool, [](const auto& a, const auto& b) { return a.first < b.first; });
+			}) ? "yes" : "no") << std::endl;
+	}
+
+	// an exception thrown inside a forked task reaches the caller
+	ads::ThreadPool pool(4);
+	std::vector<int> values = SortTestPatterns(200000, 2)[5];
+	bool thrown = false;
+	try {
+		size_t calls = 0;
+		ads::ParallelMergeSort(values.begin(), values.end(), pool, [&calls](int a, int b) {
+			if (std::atomic_ref<size_t>(calls).fetch_add(1, std::memory_order_relaxed) == 1000000)
+				throw std::runtime_error("comparator failed");
+			return a < b;
+		});
+	} catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	os << "comparator exception propagated: " << (thrown ? "yes" : "no") << std::endl;
+
+	ads::LinkedList<std::string> list;
+	for (const char* word : { "delta", "alpha", "echo", "charlie", "bravo" })
+		list.Append(word);
+	ads::ParallelMergeSort(list.begin(), list.end(), pool);
+	os << "linked list:";
+	for (const std::string& word : list)
+		os << " " << word;
+	os << std::endl;
+}
+
+#endif // TESTS_SORT_TESTS_H
\ No newline at end of file
@@ -0,0 +1,159 @@
+#ifndef TESTS_STRING_SEARCH_TESTS_H
+#define TESTS_STRING_SEARCH_TESTS_H
+
+#include "pch.h"
+#include "algorithms/string/aho_corasick.h"
+#include "algorithms/string/substring_search.h"
+#include "algorithms/string/two_way_search.h"
+
+// every occurrence of needle in text, overlapping ones included, the way std::string_view::find finds them
+std::vector<size_t> AllOccurrences(std::string_view text, std::string_view needle) {
+	std::vector<size_t> positions;
+	for (size_t pos = text.find(needle); pos != std::string_view::npos; pos = text.find(needle, pos + 1))
+		positions.push_back(pos);
+	return positions;
+}
+
+// random texts over a small alphabet so needles of every length actually occur, both with one Find loop and streamed in random chunks
+template<class Searcher>
+bool CheckSubstringSearcher(uint32_t seed) {
+	std::mt19937 rng(seed);
+	for (int round = 0; round < 200; ++round) {
+		const char alphabetSize = static_cast<char>(2 + rng() % 3);
+		std::string text(rng() % 300, 'a');
+		for (char& c : text)
+			c = static_cast<char>('a' + rng() % alphabetSize);
+		std::string needle(1 + rng() % 12, 'a');
+		for (char& c : needle)
+			c = static_cast<char>('a' + rng() % alphabetSize);
+
+		const std::vector<size_t> expected = AllOccurrences(text, needle);
+		const Searcher searcher(needle);
+		std::vector<size_t> found;
+		for (size_t pos = searcher.Find(text); pos != std::string_view::npos; pos = searcher.Find(text, pos + 1))
+			found.push_back(pos);
+		if (found != expected)
+			return false;
+
+		ads::StreamingSearch<Searcher> stream{ Searcher(needle) };
+		std::vector<size_t> streamed;
+		for (size_t begin = 0; begin < text.size();) {
+			const size_t length = std::min<size_t>(rng() % 20, text.size() - begin);
+			stream.Feed(std::string_view(text).substr(begin, length), [&streamed](uint64_t pos) { streamed.push_back(static_cast<size_t>(pos)); });
+			begin += length;
+		}
+		if (streamed != expected)
+			return false;
+	}
+	return true;
+}
+
+void TestSubstringSearcher(std::ostream& os) {
+	os << ":: TestSubstringSearcher ::\n";
+
+	os << "random texts match std::string_view::find, whole and streamed: " << (CheckSubstringSearcher<ads::SubstringSearcher>(1) ? "yes" : "no") << std::endl;
+
+	// long enough for several vector blocks, the match sits past the last full block
+	std::string log(1000, '.');
+	log += "ERROR disk full";
+	const ads::SubstringSearcher error("ERROR");
+	os << "ERROR found at " << error.Find(log) << ", from past it: " << (error.Find(log, 1001) == std::string_view::npos ? "npos" : "found")
+		<< ", empty needle at 7: " << ads::SubstringSearcher("").Find(log, 7) << std::endl;
+
+	// bytes above 0x7F compare as bytes, not as signed lane values
+	const std::string binary = std::string(40, '\x01') + "\xFF\x80\xFF" + std::string(40, '\x02');
+	os << "high bytes found at " << ads::SubstringSearcher("\xFF\x80\xFF").Find(binary) << std::endl;
+
+	// a match split over three one byte chunks
+	ads::StreamingSearch<ads::SubstringSearcher> stream{ ads::SubstringSearcher("abc") };
+	os << "streamed matches:";
+	for (std::string_view chunk : { "xxa", "b", "c", "abcab", "c" })
+		stream.Feed(chunk, [&os](uint64_t pos) { os << " " << pos; });
+	os << std::endl;
+}
+
+void TestTwoWaySearcher(std::ostream& os) {
+	os << ":: TestTwoWaySearcher ::\n";
+
+	os << "random texts match std::string_view::find, whole and streamed: " << (CheckSubstringSearcher<ads::TwoWaySearcher>(2) ? "yes" : "no") << std::endl;
+
+	// periodic needles exercise the memory of the periodic case
+	bool periodic = true;
+	for (std::string_view needle : { "aaaa", "abab", "abaabaab", "aabaabaa", "abcabcabcx", "zzzzzzzzzy" }) {
+		const std::string text = "abaabaabaabaaabaabaab abcabcabcabcx aaaaaaa zzzzzzzzzzzzzy ababab";
+		std::vector<size_t> found;
+		const ads::TwoWaySearcher searcher(needle);
+		for (size_t pos = searcher.Find(text); pos != std::string_view::npos; pos = searcher.Find(text, pos + 1))
+			found.push_back(pos);
+		periodic &= found == AllOccurrences(text, needle);
+	}
+	os << "periodic needles: " << (periodic ? "yes" : "no") << std::endl;
+
+	// the input that makes a first and last byte filter verify at every position stays linear
+	const std::string text(200000, 'a');
+	const std::string needle = std::string(1000, 'a') + "b" + std::string(1000, 'a');
+	const auto begin = std::chrono::steady_clock::now();
+	const size_t pos = ads::TwoWaySearcher(needle).Find(text);
+	const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+	os << "a^n against a^k b a^k: " << (pos == std::string_view::npos ? "npos" : "found") << ", linear time: " << (ms < 200.0 ? "yes" : "no") << std::endl;
+}
+
+void TestAhoCorasick(std::ostream& os) {
+	os << ":: TestAhoCorasick ::\n";
+
+	const ads::AhoCorasick classic({ "he", "she", "his", "hers" });
+	os << "ushers:";
+	classic.FindAll("ushers", [&os](size_t pattern, uint64_t pos) { os << " " << pattern << "@" << pos; });
+	os << ", states " << classic.StateCount() << ", classes " << classic.ClassCount() << std::endl;
+
+	// many random patterns against brute force, once with every state dense and once with only the root dense
+	std::mt19937 rng(4);
+	std::vector<std::string> patterns(2000);
+	for (std::string& pattern : patterns) {
+		pattern.resize(1 + rng() % 8);
+		for (char& c : pattern)
+			c = static_cast<char>('a' + rng() % 6);
+	}
+	patterns.push_back("");
+	patterns.push_back(patterns[5]);
+	std::string text(20000, 'a');
+	for (char& c : text)
+		c = static_cast<char>('a' + rng() % 7);
+
+	std::vector<std::pair<size_t, uint64_t>> expected;
+	for (size_t p = 0; p < patterns.size(); ++p) {
+		if (!patterns[p].empty()) {
+			for (size_t pos : AllOccurrences(text, patterns[p]))
+				expected.emplace_back(p, pos);
+		}
+	}
+	std::sort(expected.begin(), expected.end());
+
+	bool matches = true;
+	for (size_t denseBytes : { size_t(1) << 30, size_t(0) }) {
+		const ads::AhoCorasick automaton(patterns, denseBytes);
+		std::vector<std::pair<size_t, uint64_t>> found;
+		automaton.FindAll(text, [&found](size_t pattern, uint64_t pos) { found.emplace_back(pattern, pos); });
+		std::sort(found.begin(), found.end());
+		matches &= found == expected;
+
+		// the same through a stream of uneven chunks
+		ads::AhoCorasick::Stream stream(automaton);
+		std::vector<std::pair<size_t, uint64_t>> streamed;
+		for (size_t begin = 0; begin < text.size();) {
+			const size_t length = std::min<size_t>(rng() % 50, text.size() - begin);
+			stream.Feed(std::string_view(text).substr(begin, length), [&streamed](size_t pattern, uint64_t pos) { streamed.emplace_back(pattern, pos); });
+			begin += length;
+		}
+		std::sort(streamed.begin(), streamed.end());
+		matches &= streamed == expected;
+	}
+	os << "2000 patterns match brute force, dense and sparse, whole and streamed: " << (matches ? "yes" : "no") << std::endl;
+
+	// the default dense budget keeps the table small no matter how many states there are
+	const ads::AhoCorasick compact(patterns);
+	os << "automaton bytes within the dense budget plus the sparse edges: "
+		<< (compact.AutomatonBytes() < ads::AhoCorasick::defaultDenseBytes + 16 * compact.StateCount() + 1024 ? "yes" : "no") << std::endl;
+}
+
+#endif // TESTS_STRING_SEARCH_TESTS_H
\ No newline at end of file
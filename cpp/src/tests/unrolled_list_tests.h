@@ -0,0 +1,74 @@
+#ifndef TESTS_UNROLLED_LIST_TESTS_H
+#define TESTS_UNROLLED_LIST_TESTS_H
+
+#include "pch.h"
+#include "data_structures/unrolled_list.h"
+
+void TestUnrolledList_Int(std::ostream& os) {
+	typedef ads::UnrolledList<int, 64> iList;
+
+	os << ":: TestUnrolledList_Int ::\n";
+	os << "values per block: " << iList::blockCapacity << ", block bytes: " << sizeof(iList::Block) << std::endl;
+
+	iList list;
+	for (int i = 1; i <= 20; ++i)
+		list.Append(i % 4 == 0 ? 2 : i);
+	list.Prepend(0);
+	list.Prepend(2);
+
+	os << "list values from head -> end, one line per block:\n";
+	for (iList::Block* pBlock = list.Head(); pBlock != nullptr; pBlock = pBlock->next) {
+		for (size_t i = 0; i < pBlock->count; ++i)
+			os << (*pBlock)[i] << " ";
+		os << std::endl;
+	}
+
+	os << "remove all 2 values\n";
+	list.Remove(2);
+
+	os << "list values from head -> end, one line per block:\n";
+	for (iList::Block* pBlock = list.Head(); pBlock != nullptr; pBlock = pBlock->next) {
+		for (size_t i = 0; i < pBlock->count; ++i)
+			os << (*pBlock)[i] << " ";
+		os << std::endl;
+	}
+
+	int sum = 0;
+	list.ForEach([&sum](int val) { sum += val; });
+	os << "size: " << list.Size() << ", sum: " << sum << std::endl;
+
+	static_assert(std::bidirectional_iterator<iList::iterator>);
+	os << "sum through iterators: " << std::accumulate(list.begin(), list.end(), 0) << std::endl;
+	os << "last three values from end -> head: ";
+	auto it = list.rbegin();
+	for (int i = 0; i < 3; ++i, ++it)
+		os << *it << " ";
+	os << std::endl;
+}
+
+void TestUnrolledList_String(std::ostream& os) {
+	os << ":: TestUnrolledList_String ::\n";
+
+	ads::UnrolledList<std::string> list;
+	list.Append("b");
+	list.Append("remove me");
+	list.Append("c");
+	list.Prepend("a");
+	list.Remove("remove me");
+
+	os << "list values:\n";
+	list.ForEach([&os](const std::string& val) { os << val << std::endl; });
+
+	ads::UnrolledList<std::string> moved(std::move(list));
+	moved.EmplaceBack(2, 'd');
+	os << "moved list size: " << moved.Size() << ", moved-from size: " << list.Size() << std::endl;
+
+	moved.Remove("a");
+	moved.Remove("b");
+	moved.Remove("c");
+	moved.Remove("dd");
+	list = std::move(moved);
+	os << "empty after removing everything: " << (list.IsEmpty() && list.Head() == nullptr ? "yes" : "no") << std::endl;
+}
+
+#endif // TESTS_UNROLLED_LIST_TESTS_H
\ No newline at end of file